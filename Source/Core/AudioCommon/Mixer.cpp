@@ -7,6 +7,14 @@
 #include <cmath>
 #include <cstring>
 
+#if defined(_M_X86) || defined(_M_X86_64)
+#define USE_SSE
+#include <emmintrin.h>
+#elif defined(_M_ARM_64)
+#define USE_NEON
+#include <arm_neon.h>
+#endif
+
 #include "AudioCommon/Enums.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
@@ -58,10 +66,90 @@ void Mixer::DoState(PointerWrap& p)
     mixer.DoState(p);
 }
 
+namespace
+{
+// Polynomial Interpolators for High-Quality Resampling of
+// Over Sampled Audio by Olli Niemitalo, October 2001.
+// Page 43 -- 6-point, 3rd-order Hermite:
+// https://yehar.com/blog/wp-content/uploads/2009/08/deip.pdf
+// The weights of the six samples are c0 + c1 * t + c2 * t^2 + c3 * t^3.
+constexpr std::array<std::array<float, 6>, 4> HERMITE_COEFFICIENTS{{
+    {0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f},
+    {1.0f / 12.0f, -8.0f / 12.0f, 0.0f, 2.0f / 3.0f, -1.0f / 12.0f, 0.0f},
+    {-2.0f / 12.0f, 15.0f / 12.0f, -7.0f / 3.0f, 5.0f / 3.0f, -6.0f / 12.0f, 1.0f / 12.0f},
+    {1.0f / 12.0f, -7.0f / 12.0f, 4.0f / 3.0f, -4.0f / 3.0f, 7.0f / 12.0f, -1.0f / 12.0f},
+}};
+}  // namespace
+
+// Interpolates between samples[2] and samples[3], where t is the position between them.
+Mixer::StereoPair Mixer::MixerFifo::Interpolate(const StereoPair* samples, float t)
+{
+#if defined(USE_SSE)
+  const auto weights = [t](std::size_t first) {
+    const auto coefficients = [first](std::size_t power) {
+      return _mm_loadu_ps(&HERMITE_COEFFICIENTS[power][first]);
+    };
+    const __m128 t_vec = _mm_set1_ps(t);
+    __m128 result = coefficients(3);
+    result = _mm_add_ps(_mm_mul_ps(result, t_vec), coefficients(2));
+    result = _mm_add_ps(_mm_mul_ps(result, t_vec), coefficients(1));
+    return _mm_add_ps(_mm_mul_ps(result, t_vec), coefficients(0));
+  };
+  // The weights of samples 4 and 5 are loaded along with two more, which are ignored.
+  const __m128 weights_0123 = weights(0);
+  const __m128 weights_45 = weights(2);
+
+  const float* data = &samples[0].l;
+  __m128 sum = _mm_mul_ps(_mm_loadu_ps(data), _mm_unpacklo_ps(weights_0123, weights_0123));
+  sum = _mm_add_ps(sum,
+                   _mm_mul_ps(_mm_loadu_ps(data + 4), _mm_unpackhi_ps(weights_0123, weights_0123)));
+  sum = _mm_add_ps(sum,
+                   _mm_mul_ps(_mm_loadu_ps(data + 8), _mm_unpackhi_ps(weights_45, weights_45)));
+  sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+
+  StereoPair result;
+  _mm_storel_pi(reinterpret_cast<__m64*>(&result.l), sum);
+  return result;
+#elif defined(USE_NEON)
+  const auto weights = [t](std::size_t first) {
+    const auto coefficients = [first](std::size_t power) {
+      return vld1q_f32(&HERMITE_COEFFICIENTS[power][first]);
+    };
+    float32x4_t result = coefficients(3);
+    result = vfmaq_n_f32(coefficients(2), result, t);
+    result = vfmaq_n_f32(coefficients(1), result, t);
+    return vfmaq_n_f32(coefficients(0), result, t);
+  };
+  // The weights of samples 4 and 5 are loaded along with two more, which are ignored.
+  const float32x4_t weights_0123 = weights(0);
+  const float32x4_t weights_45 = weights(2);
+
+  const float* data = &samples[0].l;
+  float32x4_t sum = vmulq_f32(vld1q_f32(data), vzip1q_f32(weights_0123, weights_0123));
+  sum = vfmaq_f32(sum, vld1q_f32(data + 4), vzip2q_f32(weights_0123, weights_0123));
+  sum = vfmaq_f32(sum, vld1q_f32(data + 8), vzip2q_f32(weights_45, weights_45));
+  const float32x2_t pair = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+  return StereoPair(vget_lane_f32(pair, 0), vget_lane_f32(pair, 1));
+#else
+  StereoPair result;
+  for (std::size_t i = 0; i < 6; ++i)
+  {
+    const float weight =
+        ((HERMITE_COEFFICIENTS[3][i] * t + HERMITE_COEFFICIENTS[2][i]) * t +
+         HERMITE_COEFFICIENTS[1][i]) *
+            t +
+        HERMITE_COEFFICIENTS[0][i];
+    result = result + samples[i] * StereoPair{weight};
+  }
+  return result;
+#endif
+}
+
 // Executed from sound stream thread
-void Mixer::MixerFifo::Mix(s16* samples, std::size_t num_samples)
+void Mixer::MixerFifo::Mix(StereoPair* samples, std::size_t num_samples)
 {
   constexpr u32 INDEX_HALF = 0x80000000;
+  constexpr u32 FRAC_MASK = (1 << GRANULE_FRAC_BITS) - 1;
   constexpr DT_s FADE_IN_RC = DT_s(0.008);
   constexpr DT_s FADE_OUT_RC = DT_s(0.064);
 
@@ -97,66 +185,60 @@ void Mixer::MixerFifo::Mix(s16* samples, std::size_t num_samples)
 
   m_granule_queue_size.store(buffer_size_granules, std::memory_order_relaxed);
 
-  while (num_samples-- > 0)
+  while (num_samples > 0)
   {
     // The indexes for the front and back buffers are offset by 50% of the granule size.
     // We use the modular nature of 32-bit integers to wrap around the granule size.
-    m_current_index += index_jump;
-    const u32 front_index = m_current_index;
-    const u32 back_index = m_current_index + INDEX_HALF;
+    u32 front_index = m_current_index + index_jump;
+    const u32 back_index = front_index + INDEX_HALF;
 
     // If either index is less than the index jump, that means we reached
     // the end of the of the buffer and need to load the next granule.
     if (front_index < index_jump)
+    {
       fade_audio = Dequeue(&m_front);
+      UpdateTaps();
+    }
     else if (back_index < index_jump)
+    {
       fade_audio = Dequeue(&m_back);
+      UpdateTaps();
+    }
 
-    // The Granules are pre-windowed, so we can just add them together
-    const std::size_t ft = front_index >> GRANULE_FRAC_BITS;
-    const std::size_t bt = back_index >> GRANULE_FRAC_BITS;
-    const StereoPair s0 = m_front[(ft - 2) & GRANULE_MASK] + m_back[(bt - 2) & GRANULE_MASK];
-    const StereoPair s1 = m_front[(ft - 1) & GRANULE_MASK] + m_back[(bt - 1) & GRANULE_MASK];
-    const StereoPair s2 = m_front[(ft + 0) & GRANULE_MASK] + m_back[(bt + 0) & GRANULE_MASK];
-    const StereoPair s3 = m_front[(ft + 1) & GRANULE_MASK] + m_back[(bt + 1) & GRANULE_MASK];
-    const StereoPair s4 = m_front[(ft + 2) & GRANULE_MASK] + m_back[(bt + 2) & GRANULE_MASK];
-    const StereoPair s5 = m_front[(ft + 3) & GRANULE_MASK] + m_back[(bt + 3) & GRANULE_MASK];
-
-    // Polynomial Interpolators for High-Quality Resampling of
-    // Over Sampled Audio by Olli Niemitalo, October 2001.
-    // Page 43 -- 6-point, 3rd-order Hermite:
-    // https://yehar.com/blog/wp-content/uploads/2009/08/deip.pdf
-    const u32 t_frac = m_current_index & ((1 << GRANULE_FRAC_BITS) - 1);
-    const float t1 = t_frac / static_cast<float>(1 << GRANULE_FRAC_BITS);
-    const float t2 = t1 * t1;
-    const float t3 = t2 * t1;
-
-    StereoPair sample = (s0 * StereoPair{(+0.0f + 1.0f * t1 - 2.0f * t2 + 1.0f * t3) / 12.0f} +
-                         s1 * StereoPair{(+0.0f - 8.0f * t1 + 15.0f * t2 - 7.0f * t3) / 12.0f} +
-                         s2 * StereoPair{(+3.0f + 0.0f * t1 - 7.0f * t2 + 4.0f * t3) / 3.0f} +
-                         s3 * StereoPair{(+0.0f + 2.0f * t1 + 5.0f * t2 - 4.0f * t3) / 3.0f} +
-                         s4 * StereoPair{(+0.0f - 1.0f * t1 - 6.0f * t2 + 7.0f * t3) / 12.0f} +
-                         s5 * StereoPair{(+0.0f + 0.0f * t1 + 1.0f * t2 - 1.0f * t3) / 12.0f});
-
-    // Apply Fade In / Fade Out depending on if we are looping
-    if (fade_audio)
-      m_fade_volume += fade_out_mul * (0.0f - m_fade_volume);
-    else
-      m_fade_volume += fade_in_mul * (1.0f - m_fade_volume);
-
-    // Apply the fade volume and the regular volume to the sample
-    sample = sample * volume * StereoPair{m_fade_volume};
-
-    // This quantization method prevents accumulated error but does not do noise shaping.
-    sample.l += samples[0] - m_quantization_error.l;
-    samples[0] = MathUtil::SaturatingCast<s16>(std::lround(sample.l));
-    m_quantization_error.l = std::clamp(samples[0] - sample.l, -1.0f, 1.0f);
-
-    sample.r += samples[1] - m_quantization_error.r;
-    samples[1] = MathUtil::SaturatingCast<s16>(std::lround(sample.r));
-    m_quantization_error.r = std::clamp(samples[1] - sample.r, -1.0f, 1.0f);
+    // The granules stay the same until the index reaches the next half of them, so the samples
+    // up to there can be resampled in one go.
+    std::size_t count = num_samples;
+    if (index_jump != 0)
+    {
+      const u32 steps_left = (INDEX_HALF - 1 - (front_index & (INDEX_HALF - 1))) / index_jump;
+      count = std::min<std::size_t>(count, std::size_t{steps_left} + 1);
+    }
+    num_samples -= count;
 
-    samples += 2;
+    for (; count > 0; --count)
+    {
+      // Apply Fade In / Fade Out depending on if we are looping
+      if (fade_audio)
+        m_fade_volume += fade_out_mul * (0.0f - m_fade_volume);
+      else
+        m_fade_volume += fade_in_mul * (1.0f - m_fade_volume);
+
+      // Silence stays silent no matter the volume, so only the fade needs to be kept going.
+      if (!m_taps_silent)
+      {
+        // The Granules are pre-windowed, so we can just add them together
+        const std::size_t ft = front_index >> GRANULE_FRAC_BITS;
+        const float t = (front_index & FRAC_MASK) / static_cast<float>(1 << GRANULE_FRAC_BITS);
+        const StereoPair sample = Interpolate(&m_taps[ft], t);
+
+        // Apply the fade volume and the regular volume to the sample
+        *samples = *samples + sample * volume * StereoPair{m_fade_volume};
+      }
+
+      m_current_index = front_index;
+      front_index += index_jump;
+      ++samples;
+    }
   }
 }
 
@@ -165,14 +247,34 @@ std::size_t Mixer::Mix(s16* samples, std::size_t num_samples)
   if (!samples)
     return 0;
 
-  memset(samples, 0, num_samples * 2 * sizeof(s16));
+  // The sources are added up as floats, so that the result only has to be rounded once.
+  for (std::size_t offset = 0; offset < num_samples; offset += MIX_BUFFER_SIZE)
+  {
+    const std::size_t count = std::min(num_samples - offset, MIX_BUFFER_SIZE);
+    std::fill_n(m_mix_buffer.begin(), count, StereoPair{});
+
+    m_dma_mixer.Mix(m_mix_buffer.data(), count);
+    m_streaming_mixer.Mix(m_mix_buffer.data(), count);
+    m_wiimote_speaker_mixer.Mix(m_mix_buffer.data(), count);
+    m_skylander_portal_mixer.Mix(m_mix_buffer.data(), count);
+    for (auto& mixer : m_gba_mixers)
+      mixer.Mix(m_mix_buffer.data(), count);
+
+    s16* out = samples + offset * 2;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      // This quantization method prevents accumulated error but does not do noise shaping.
+      const float l = m_mix_buffer[i].l - m_quantization_error.l;
+      out[0] = MathUtil::SaturatingCast<s16>(std::lround(l));
+      m_quantization_error.l = std::clamp(out[0] - l, -1.0f, 1.0f);
 
-  m_dma_mixer.Mix(samples, num_samples);
-  m_streaming_mixer.Mix(samples, num_samples);
-  m_wiimote_speaker_mixer.Mix(samples, num_samples);
-  m_skylander_portal_mixer.Mix(samples, num_samples);
-  for (auto& mixer : m_gba_mixers)
-    mixer.Mix(samples, num_samples);
+      const float r = m_mix_buffer[i].r - m_quantization_error.r;
+      out[1] = MathUtil::SaturatingCast<s16>(std::lround(r));
+      m_quantization_error.r = std::clamp(out[1] - r, -1.0f, 1.0f);
+
+      out += 2;
+    }
+  }
 
   return num_samples;
 }
@@ -585,3 +687,20 @@ bool Mixer::MixerFifo::Dequeue(Granule* granule)
 
   return m_queue_fading.load(std::memory_order_relaxed);
 }
+
+void Mixer::MixerFifo::UpdateTaps()
+{
+  bool silent = true;
+  for (std::size_t i = 0; i < GRANULE_SIZE; ++i)
+  {
+    const StereoPair sample = m_front[i] + m_back[(i + GRANULE_OVERLAP) & GRANULE_MASK];
+    m_taps[i + 2] = sample;
+    silent &= sample.l == 0.0f && sample.r == 0.0f;
+  }
+  m_taps[0] = m_taps[GRANULE_SIZE];
+  m_taps[1] = m_taps[GRANULE_SIZE + 1];
+  m_taps[GRANULE_SIZE + 2] = m_taps[2];
+  m_taps[GRANULE_SIZE + 3] = m_taps[3];
+  m_taps[GRANULE_SIZE + 4] = m_taps[4];
+  m_taps_silent = silent;
+}
@@ -60,37 +60,40 @@ public:
 private:
   const std::size_t SURROUND_CHANNELS = 6;
 
+  // The sources are mixed this many samples at a time.
+  static constexpr std::size_t MIX_BUFFER_SIZE = 256;
+
+  struct StereoPair final
+  {
+    float l = 0.f;
+    float r = 0.f;
+
+    constexpr StereoPair() = default;
+    constexpr StereoPair(const StereoPair&) = default;
+    constexpr StereoPair& operator=(const StereoPair&) = default;
+    constexpr StereoPair(StereoPair&&) = default;
+    constexpr StereoPair& operator=(StereoPair&&) = default;
+
+    constexpr StereoPair(float mono) : l(mono), r(mono) {}
+    constexpr StereoPair(float left, float right) : l(left), r(right) {}
+    constexpr StereoPair(s16 left, s16 right) : l(left), r(right) {}
+
+    StereoPair operator+(const StereoPair& other) const
+    {
+      return StereoPair(l + other.l, r + other.r);
+    }
+
+    StereoPair operator*(const StereoPair& other) const
+    {
+      return StereoPair(l * other.l, r * other.r);
+    }
+  };
+
   class MixerFifo final
   {
     static constexpr std::size_t MAX_GRANULE_QUEUE_SIZE = 256;
     static constexpr std::size_t GRANULE_QUEUE_MASK = MAX_GRANULE_QUEUE_SIZE - 1;
 
-    struct StereoPair final
-    {
-      float l = 0.f;
-      float r = 0.f;
-
-      constexpr StereoPair() = default;
-      constexpr StereoPair(const StereoPair&) = default;
-      constexpr StereoPair& operator=(const StereoPair&) = default;
-      constexpr StereoPair(StereoPair&&) = default;
-      constexpr StereoPair& operator=(StereoPair&&) = default;
-
-      constexpr StereoPair(float mono) : l(mono), r(mono) {}
-      constexpr StereoPair(float left, float right) : l(left), r(right) {}
-      constexpr StereoPair(s16 left, s16 right) : l(left), r(right) {}
-
-      StereoPair operator+(const StereoPair& other) const
-      {
-        return StereoPair(l + other.l, r + other.r);
-      }
-
-      StereoPair operator*(const StereoPair& other) const
-      {
-        return StereoPair(l * other.l, r * other.r);
-      }
-    };
-
     static constexpr std::size_t GRANULE_SIZE = 256;
     static constexpr std::size_t GRANULE_OVERLAP = GRANULE_SIZE / 2;
     static constexpr std::size_t GRANULE_MASK = GRANULE_SIZE - 1;
@@ -107,7 +110,8 @@ private:
     }
     void DoState(PointerWrap& p);
     void PushSamples(const s16* samples, std::size_t num_samples);
-    void Mix(s16* samples, std::size_t num_samples);
+    // Adds the resampled audio to the samples.
+    void Mix(StereoPair* samples, std::size_t num_samples);
     void SetInputSampleRateDivisor(u32 rate_divisor);
     u32 GetInputSampleRateDivisor() const;
     void SetVolume(u32 lvolume, u32 rvolume);
@@ -132,14 +136,21 @@ private:
     std::atomic<bool> m_queue_looping{false};
     float m_fade_volume = 1.0;
 
+    // The front and back granules summed up, since they're always read at the same positions.
+    // The first two and last three samples are repeated around the ends, so that all of the
+    // samples the interpolation needs for a position are next to each other.
+    std::array<StereoPair, GRANULE_SIZE + 5> m_taps{};
+    bool m_taps_silent = true;
+
     void Enqueue();
     bool Dequeue(Granule* granule);
+    void UpdateTaps();
+
+    static StereoPair Interpolate(const StereoPair* samples, float t);
 
     // Volume ranges from 0-256
     std::atomic<s32> m_LVolume{256};
     std::atomic<s32> m_RVolume{256};
-
-    StereoPair m_quantization_error;
   };
 
   void RefreshConfig();
@@ -154,6 +165,9 @@ private:
                                         MixerFifo{this, FIXED_SAMPLE_RATE_DIVIDEND / 48000, true}};
   u32 m_output_sample_rate;
 
+  std::array<StereoPair, MIX_BUFFER_SIZE> m_mix_buffer;
+  StereoPair m_quantization_error;
+
   AudioCommon::SurroundDecoder m_surround_decoder;
 
   WaveFileWriter m_wave_writer_dtk;
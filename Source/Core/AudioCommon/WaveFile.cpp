@@ -3,7 +3,9 @@
 
 #include "AudioCommon/WaveFile.h"
 
+#include <algorithm>
 #include <string>
+#include <utility>
 
 #include <fmt/format.h>
 
@@ -29,6 +31,34 @@ WaveFileWriter::~WaveFileWriter()
 }
 
 bool WaveFileWriter::Start(const std::string& filename, u32 sample_rate_divisor)
+{
+  if (!PrepareFile(filename) || !OpenFile(filename, sample_rate_divisor))
+    return false;
+
+  std::lock_guard lk(m_pending_lock);
+  if (m_basename.empty())
+    SplitPath(filename, nullptr, &m_basename, nullptr);
+  m_pending_block.sample_rate_divisor = sample_rate_divisor;
+  m_pending_block.new_filename.reset();
+  m_started = true;
+  m_writer.Reset("Audio dump", [this](SampleBlock block) { WriteBlock(std::move(block)); });
+  return true;
+}
+
+void WaveFileWriter::Stop()
+{
+  {
+    std::lock_guard lk(m_pending_lock);
+    QueuePendingBlock();
+    m_started = false;
+  }
+
+  // Wait for all of the samples to be written before finishing the file.
+  m_writer.Shutdown();
+  CloseFile();
+}
+
+bool WaveFileWriter::PrepareFile(const std::string& filename)
 {
   // Ask to delete file
   if (File::Exists(filename))
@@ -45,6 +75,11 @@ bool WaveFileWriter::Start(const std::string& filename, u32 sample_rate_divisor)
     }
   }
 
+  return true;
+}
+
+bool WaveFileWriter::OpenFile(const std::string& filename, u32 sample_rate_divisor)
+{
   // Check if the file is already open
   if (m_file)
   {
@@ -64,11 +99,6 @@ bool WaveFileWriter::Start(const std::string& filename, u32 sample_rate_divisor)
 
   m_audio_size = 0;
 
-  if (m_basename.empty())
-    SplitPath(filename, nullptr, &m_basename, nullptr);
-
-  m_current_sample_rate_divisor = sample_rate_divisor;
-
   // -----------------
   // Write file header
   // -----------------
@@ -95,7 +125,7 @@ bool WaveFileWriter::Start(const std::string& filename, u32 sample_rate_divisor)
   return true;
 }
 
-void WaveFileWriter::Stop()
+void WaveFileWriter::CloseFile()
 {
   m_file.Seek(4, File::SeekOrigin::Begin);
   Write(m_audio_size + 36);
@@ -119,53 +149,91 @@ void WaveFileWriter::Write4(const char* ptr)
 void WaveFileWriter::AddStereoSamplesBE(const short* sample_data, u32 count,
                                         u32 sample_rate_divisor, int l_volume, int r_volume)
 {
-  if (!m_file)
+  std::unique_lock lk(m_pending_lock);
+
+  if (!m_started)
   {
     ERROR_LOG_FMT(AUDIO, "WaveFileWriter - file not open.");
     return;
   }
 
-  if (count * 2 > BUFFER_SIZE)
+  if (m_skip_silence &&
+      std::all_of(sample_data, sample_data + count * 2, [](short sample) { return sample == 0; }))
   {
-    ERROR_LOG_FMT(AUDIO, "WaveFileWriter - buffer too small (count = {}).", count);
     return;
   }
 
-  if (m_skip_silence)
+  // Each sample rate change starts a new file.
+  if (sample_rate_divisor != m_pending_block.sample_rate_divisor)
   {
-    bool all_zero = true;
+    QueuePendingBlock();
+    m_file_index++;
+    std::string filename =
+        fmt::format("{}{}{}.wav", File::GetUserPath(D_DUMPAUDIO_IDX), m_basename, m_file_index);
 
-    for (u32 i = 0; i < count * 2; i++)
-    {
-      if (sample_data[i])
-        all_zero = false;
-    }
+    // Stop() may be waiting for the lock on the thread which has to answer the question.
+    lk.unlock();
+    if (!PrepareFile(filename))
+      filename.clear();
+    lk.lock();
 
-    if (all_zero)
+    if (!m_started)
       return;
+
+    m_pending_block.sample_rate_divisor = sample_rate_divisor;
+    m_pending_block.new_filename = std::move(filename);
   }
 
+  const size_t offset = m_pending_block.samples.size();
+  m_pending_block.samples.resize(offset + count * 2);
+  short* const conv_buffer = m_pending_block.samples.data() + offset;
   for (u32 i = 0; i < count; i++)
   {
     // Flip the audio channels from RL to LR
-    m_conv_buffer[2 * i] = Common::swap16((u16)sample_data[2 * i + 1]);
-    m_conv_buffer[2 * i + 1] = Common::swap16((u16)sample_data[2 * i]);
+    conv_buffer[2 * i] = Common::swap16((u16)sample_data[2 * i + 1]);
+    conv_buffer[2 * i + 1] = Common::swap16((u16)sample_data[2 * i]);
 
     // Apply volume (volume ranges from 0 to 256)
-    m_conv_buffer[2 * i] = m_conv_buffer[2 * i] * l_volume / 256;
-    m_conv_buffer[2 * i + 1] = m_conv_buffer[2 * i + 1] * r_volume / 256;
+    conv_buffer[2 * i] = conv_buffer[2 * i] * l_volume / 256;
+    conv_buffer[2 * i + 1] = conv_buffer[2 * i + 1] * r_volume / 256;
+  }
+
+  if (m_pending_block.samples.size() >= BUFFER_SIZE)
+    QueuePendingBlock();
+}
+
+void WaveFileWriter::QueuePendingBlock()
+{
+  if (m_pending_block.samples.empty())
+    return;
+
+  // Rather than using more and more memory when the disk can't keep up, wait for it.
+  m_writer.WaitForQueueSize(MAX_QUEUED_BLOCKS - 1);
+
+  SampleBlock block{std::move(m_pending_block.samples), m_pending_block.sample_rate_divisor,
+                    std::move(m_pending_block.new_filename)};
+  m_pending_block.samples = {};
+  m_pending_block.samples.reserve(BUFFER_SIZE);
+  m_pending_block.new_filename.reset();
+  m_writer.Push(std::move(block));
+}
+
+void WaveFileWriter::WriteBlock(SampleBlock block)
+{
+  if (block.new_filename)
+  {
+    CloseFile();
+    if (!block.new_filename->empty())
+      OpenFile(*block.new_filename, block.sample_rate_divisor);
   }
 
-  if (sample_rate_divisor != m_current_sample_rate_divisor)
+  if (!m_file)
   {
-    Stop();
-    m_file_index++;
-    const std::string filename =
-        fmt::format("{}{}{}.wav", File::GetUserPath(D_DUMPAUDIO_IDX), m_basename, m_file_index);
-    Start(filename, sample_rate_divisor);
-    m_current_sample_rate_divisor = sample_rate_divisor;
+    ERROR_LOG_FMT(AUDIO, "WaveFileWriter - file not open.");
+    return;
   }
 
-  m_file.WriteBytes(m_conv_buffer.data(), count * 4);
-  m_audio_size += count * 4;
+  const size_t size = block.samples.size() * sizeof(short);
+  m_file.WriteBytes(block.samples.data(), size);
+  m_audio_size += static_cast<u32>(size);
 }
@@ -9,15 +9,20 @@
 // The float variant will convert from -1.0-1.0 range and clamp.
 // Alternatively, AddSamplesBE for big endian wave data.
 // If Stop is not called when it destructs, the destructor will call Stop().
+// The samples are written to disk on a separate thread, so that adding them only has to wait for
+// the disk when it falls far behind.
 // ---------------------------------------------------------------------------------
 
 #pragma once
 
-#include <array>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
+#include "Common/WorkQueueThread.h"
 
 class WaveFileWriter
 {
@@ -37,21 +42,48 @@ public:
   // big endian
   void AddStereoSamplesBE(const short* sample_data, u32 count, u32 sample_rate_divisor,
                           int l_volume, int r_volume);
-  u32 GetAudioSize() const { return m_audio_size; }
 
 private:
   static constexpr size_t BUFFER_SIZE = 32 * 1024;
 
+  // How many blocks of BUFFER_SIZE samples may be waiting for the writer thread.
+  static constexpr size_t MAX_QUEUED_BLOCKS = 8;
+
+  struct SampleBlock
+  {
+    // Little endian, left channel first.
+    std::vector<short> samples;
+    u32 sample_rate_divisor = 0;
+    // Only set for the first block of a new file. The string is empty if the existing file must
+    // not be overwritten, in which case no samples are written until the next file.
+    std::optional<std::string> new_filename;
+  };
+
+  // Asks whether to overwrite the file if it exists. Never called on the writer thread, because
+  // asking may have to wait for the UI thread, which may be waiting for the writer in Stop().
+  static bool PrepareFile(const std::string& filename);
+
+  void QueuePendingBlock();
+
+  // NOTE: The methods below are called on the writer thread while it runs.
+  bool OpenFile(const std::string& filename, u32 sample_rate_divisor);
+  void CloseFile();
+  void WriteBlock(SampleBlock block);
   void Write(u32 value);
   void Write4(const char* ptr);
 
+  // Owned by the writer thread while it runs.
   File::IOFile m_file;
+  u32 m_audio_size = 0;
+
+  // The samples which are collected until there are enough to hand them to the writer thread.
+  std::mutex m_pending_lock;
+  SampleBlock m_pending_block;
+  bool m_started = false;
   std::string m_basename;
   u32 m_file_index = 0;
-  u32 m_audio_size = 0;
 
-  u32 m_current_sample_rate_divisor;
-  std::array<short, BUFFER_SIZE> m_conv_buffer{};
+  Common::WorkQueueThread<SampleBlock> m_writer;
 
   bool m_skip_silence = false;
 };
@@ -0,0 +1,125 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/MappedFile.h"
+
+#include <utility>
+
+#include "Common/CommonFuncs.h"
+#include "Common/Logging/Log.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include "Common/StringUtil.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Common
+{
+MappedFile::~MappedFile()
+{
+  Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other)
+    : m_data(std::exchange(other.m_data, nullptr)), m_size(std::exchange(other.m_size, 0))
+{
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other)
+{
+  Close();
+  m_data = std::exchange(other.m_data, nullptr);
+  m_size = std::exchange(other.m_size, 0);
+  return *this;
+}
+
+bool MappedFile::Open(const std::string& path)
+{
+  Close();
+
+#ifdef _WIN32
+  const HANDLE file = CreateFileW(UTF8ToWString(path).c_str(), GENERIC_READ, FILE_SHARE_READ,
+                                  nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+  {
+    ERROR_LOG_FMT(COMMON, "MappedFile: Failed to open {}: {}", path, GetLastErrorString());
+    return false;
+  }
+
+  LARGE_INTEGER file_size{};
+  if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0)
+  {
+    CloseHandle(file);
+    return false;
+  }
+
+  const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+  CloseHandle(file);
+  if (mapping == nullptr)
+  {
+    ERROR_LOG_FMT(COMMON, "MappedFile: Failed to create mapping for {}: {}", path,
+                  GetLastErrorString());
+    return false;
+  }
+
+  void* const data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+  CloseHandle(mapping);
+  if (data == nullptr)
+  {
+    ERROR_LOG_FMT(COMMON, "MappedFile: Failed to map {}: {}", path, GetLastErrorString());
+    return false;
+  }
+
+  m_size = static_cast<size_t>(file_size.QuadPart);
+#else
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd == -1)
+  {
+    ERROR_LOG_FMT(COMMON, "MappedFile: Failed to open {}: {}", path, LastStrerrorString());
+    return false;
+  }
+
+  struct stat file_info;
+  if (fstat(fd, &file_info) != 0 || file_info.st_size == 0)
+  {
+    close(fd);
+    return false;
+  }
+
+  void* const data =
+      mmap(nullptr, static_cast<size_t>(file_info.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE,
+           fd, 0);
+  close(fd);
+  if (data == MAP_FAILED)
+  {
+    ERROR_LOG_FMT(COMMON, "MappedFile: Failed to map {}: {}", path, LastStrerrorString());
+    return false;
+  }
+
+  m_size = static_cast<size_t>(file_info.st_size);
+#endif
+
+  m_data = static_cast<u8*>(data);
+  return true;
+}
+
+void MappedFile::Close()
+{
+  if (!m_data)
+    return;
+
+#ifdef _WIN32
+  UnmapViewOfFile(m_data);
+#else
+  munmap(m_data, m_size);
+#endif
+
+  m_data = nullptr;
+  m_size = 0;
+}
+}  // namespace Common
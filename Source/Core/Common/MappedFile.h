@@ -0,0 +1,38 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+// Maps a whole file into memory with copy-on-write semantics.
+// The mapped memory may be modified, but modifications are never written back to the file.
+class MappedFile final
+{
+public:
+  MappedFile() = default;
+  explicit MappedFile(const std::string& path) { Open(path); }
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  MappedFile(MappedFile&& other);
+  MappedFile& operator=(MappedFile&& other);
+
+  bool Open(const std::string& path);
+  void Close();
+
+  bool IsOpen() const { return m_data != nullptr; }
+  std::span<u8> GetData() const { return {m_data, m_size}; }
+
+private:
+  u8* m_data = nullptr;
+  size_t m_size = 0;
+};
+}  // namespace Common
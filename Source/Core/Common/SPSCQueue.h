@@ -54,6 +54,12 @@ public:
       m_size.wait(old_size, std::memory_order_acquire);
   }
 
+  void WaitForSizeAtMost(std::size_t max_size) requires(IncludeWaitFunctionality)
+  {
+    for (std::size_t old_size = Size(); old_size > max_size; old_size = Size())
+      m_size.wait(old_size, std::memory_order_acquire);
+  }
+
   // The following are only safe from the "consumer thread":
   T& Front() { return m_read_ptr->value.Ref(); }
   const T& Front() const { return m_read_ptr->value.Ref(); }
@@ -98,6 +98,16 @@ public:
       m_items.WaitForEmpty();
   }
 
+  // Blocks until at most max_size items are in the queue, counting the one being processed.
+  // Lets producers keep the queue bounded when the work is slower than they are.
+  // Does nothing if thread isn't running.
+  void WaitForQueueSize(std::size_t max_size)
+  {
+    auto lg = GetLockGuard();
+    if (IsRunning())
+      m_items.WaitForSizeAtMost(max_size);
+  }
+
 private:
   using CommandFunction = std::function<void()>;
 
@@ -65,6 +65,7 @@ extern const Info<bool> GFX_CACHE_HIRES_TEXTURES;
 extern const Info<bool> GFX_DUMP_EFB_TARGET;
 extern const Info<bool> GFX_DUMP_XFB_TARGET;
 extern const Info<bool> GFX_DUMP_FRAMES_AS_IMAGES;
+extern const Info<bool> GFX_DUMP_FRAMES_AS_Y4M;
 extern const Info<bool> GFX_USE_LOSSLESS;
 extern const Info<std::string> GFX_DUMP_FORMAT;
 extern const Info<std::string> GFX_DUMP_CODEC;
@@ -75,6 +76,9 @@ extern const Info<int> GFX_BITRATE_KBPS;
 extern const Info<FrameDumpResolutionType> GFX_FRAME_DUMPS_RESOLUTION_TYPE;
 extern const Info<int> GFX_PNG_COMPRESSION_LEVEL;
 extern const Info<bool> GFX_ENABLE_GPU_TEXTURE_DECODING;
+extern const Info<int> GFX_TEXTURE_DECODING_THREADS;
+extern const Info<bool> GFX_PREFETCH_TEXTURES;
+extern const Info<int> GFX_VERTEX_LOADING_THREADS;
 extern const Info<bool> GFX_ENABLE_PIXEL_LIGHTING;
 extern const Info<bool> GFX_FAST_DEPTH_CALC;
 extern const Info<u32> GFX_MSAA;
@@ -104,6 +108,9 @@ extern const Info<TriState> GFX_MTL_USE_PRESENT_DRAWABLE;
 extern const Info<bool> GFX_SW_DUMP_OBJECTS;
 extern const Info<bool> GFX_SW_DUMP_TEV_STAGES;
 extern const Info<bool> GFX_SW_DUMP_TEV_TEX_FETCHES;
+// Number of worker threads which rasterize in addition to the video thread. Parallel rasterization
+// is opt-in until it has seen more testing. -1 picks a number based on the CPU.
+extern const Info<int> GFX_SW_RASTERIZER_THREADS;
 
 extern const Info<bool> GFX_PREFER_GLES;
 
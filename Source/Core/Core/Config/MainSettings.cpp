@@ -39,6 +39,8 @@ const Info<bool> MAIN_SKIP_IPL{{System::Main, "Core", "SkipIPL"}, true};
 const Info<PowerPC::CPUCore> MAIN_CPU_CORE{{System::Main, "Core", "CPUCore"},
                                            PowerPC::DefaultCPUCore()};
 const Info<bool> MAIN_JIT_FOLLOW_BRANCH{{System::Main, "Core", "JITFollowBranch"}, true};
+const Info<bool> MAIN_JIT_BLOCK_DISK_CACHE{{System::Main, "Core", "JITBlockDiskCache"}, false};
+const Info<int> MAIN_JIT_COMPILE_THRESHOLD{{System::Main, "Core", "JITCompileThreshold"}, 0};
 const Info<bool> MAIN_FASTMEM{{System::Main, "Core", "Fastmem"}, true};
 const Info<bool> MAIN_FASTMEM_ARENA{{System::Main, "Core", "FastmemArena"}, true};
 const Info<bool> MAIN_LARGE_ENTRY_POINTS_MAP{{System::Main, "Core", "LargeEntryPointsMap"}, true};
@@ -277,6 +279,14 @@ const Info<DiscIO::Region> MAIN_FALLBACK_REGION{{System::Main, "Core", "Fallback
 const Info<bool> MAIN_AUTO_DISC_CHANGE{{System::Main, "Core", "AutoDiscChange"}, false};
 const Info<bool> MAIN_ALLOW_SD_WRITES{{System::Main, "Core", "WiiSDCardAllowWrites"}, true};
 const Info<bool> MAIN_ENABLE_SAVESTATES{{System::Main, "Core", "EnableSaveStates"}, false};
+const Info<StateCompressionMode> MAIN_STATE_COMPRESSION{
+    {System::Main, "Core", "StateCompression"}, StateCompressionMode::LZ4};
+const Info<int> MAIN_STATE_COMPRESSION_LEVEL{{System::Main, "Core", "StateCompressionLevel"}, 3};
+const Info<bool> MAIN_REWIND_ENABLE{{System::Main, "Core", "EnableRewind"}, false};
+const Info<u32> MAIN_REWIND_FREQUENCY{{System::Main, "Core", "RewindFrequency"}, 60};
+const Info<u32> MAIN_REWIND_MEMORY_BUDGET_MB{{System::Main, "Core", "RewindMemoryBudgetMB"}, 512};
+const Info<bool> MAIN_AUTOSAVE_ENABLE{{System::Main, "Core", "EnableAutosave"}, false};
+const Info<u32> MAIN_AUTOSAVE_FREQUENCY{{System::Main, "Core", "AutosaveFrequency"}, 60};
 const Info<bool> MAIN_REAL_WII_REMOTE_REPEAT_REPORTS{
     {System::Main, "Core", "RealWiiRemoteRepeatReports"}, true};
 const Info<bool> MAIN_WII_WIILINK_ENABLE{{System::Main, "Core", "EnableWiiLink"}, false};
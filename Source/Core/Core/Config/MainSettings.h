@@ -56,6 +56,8 @@ namespace Config
 extern const Info<bool> MAIN_SKIP_IPL;
 extern const Info<PowerPC::CPUCore> MAIN_CPU_CORE;
 extern const Info<bool> MAIN_JIT_FOLLOW_BRANCH;
+extern const Info<bool> MAIN_JIT_BLOCK_DISK_CACHE;
+extern const Info<int> MAIN_JIT_COMPILE_THRESHOLD;
 extern const Info<bool> MAIN_FASTMEM;
 extern const Info<bool> MAIN_FASTMEM_ARENA;
 extern const Info<bool> MAIN_LARGE_ENTRY_POINTS_MAP;
@@ -162,6 +164,23 @@ extern const Info<u32> MAIN_CUSTOM_RTC_VALUE;
 extern const Info<bool> MAIN_AUTO_DISC_CHANGE;
 extern const Info<bool> MAIN_ALLOW_SD_WRITES;
 extern const Info<bool> MAIN_ENABLE_SAVESTATES;
+
+enum class StateCompressionMode
+{
+  Uncompressed,
+  LZ4,
+  Zstd,
+};
+extern const Info<StateCompressionMode> MAIN_STATE_COMPRESSION;
+// Only used by Zstd. Higher levels produce smaller states at the cost of save time.
+extern const Info<int> MAIN_STATE_COMPRESSION_LEVEL;
+extern const Info<bool> MAIN_REWIND_ENABLE;
+// Number of emulated fields between rewind points.
+extern const Info<u32> MAIN_REWIND_FREQUENCY;
+extern const Info<u32> MAIN_REWIND_MEMORY_BUDGET_MB;
+extern const Info<bool> MAIN_AUTOSAVE_ENABLE;
+// Number of emulated fields between autosaves.
+extern const Info<u32> MAIN_AUTOSAVE_FREQUENCY;
 extern const Info<DiscIO::Region> MAIN_FALLBACK_REGION;
 extern const Info<bool> MAIN_REAL_WII_REMOTE_REPEAT_REPORTS;
 extern const Info<s32> MAIN_OVERRIDE_BOOT_IOS;
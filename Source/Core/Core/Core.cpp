@@ -151,6 +151,9 @@ void FrameUpdateOnCPUThread()
 
 void OnFrameEnd(Core::System& system)
 {
+  State::OnFrameEnd(system);
+  system.GetJitInterface().PrecompileCachedBlocks();
+
 #ifdef USE_MEMORYWATCHER
   if (s_memory_watcher)
   {
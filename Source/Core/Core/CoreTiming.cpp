@@ -7,6 +7,7 @@
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <fmt/format.h>
@@ -36,6 +37,10 @@ namespace CoreTiming
 {
 static constexpr int MAX_SLICE_LENGTH = 20000;
 
+// Removed events are purged from the queue once there are more of them than this,
+// and they outnumber the events which haven't been removed.
+static constexpr size_t MIN_REMOVED_EVENTS_TO_PURGE = 32;
+
 static void EmptyTimedCallback(Core::System& system, u64 userdata, s64 cyclesLate)
 {
 }
@@ -186,6 +191,9 @@ void CoreTimingManager::DoState(PointerWrap& p)
   p.DoMarker("CoreTimingData");
 
   MoveEvents();
+  if (!p.IsReadMode())
+    PurgeRemovedEvents();
+
   p.DoEachElement(m_event_queue, [this](PointerWrap& pw, Event& ev) {
     pw.Do(ev.time);
     pw.Do(ev.fifo_order);
@@ -226,6 +234,10 @@ void CoreTimingManager::DoState(PointerWrap& p)
     // and library version specific.
     std::ranges::make_heap(m_event_queue, std::ranges::greater{});
 
+    ResetEventTypeCounters();
+    for (const Event& ev : m_event_queue)
+      ++ev.type->pending_count;
+
     // The stave state has changed the time, so our previous Throttle targets are invalid.
     // Especially when global_time goes down; So we create a fake throttle update.
     ResetThrottle(m_globals.global_timer);
@@ -253,6 +265,54 @@ u64 CoreTimingManager::GetIdleTicks() const
 void CoreTimingManager::ClearPendingEvents()
 {
   m_event_queue.clear();
+  ResetEventTypeCounters();
+}
+
+void CoreTimingManager::ResetEventTypeCounters()
+{
+  m_removed_event_count = 0;
+  for (auto& [name, event_type] : m_event_types)
+  {
+    event_type.removed_before_fifo_order = 0;
+    event_type.pending_count = 0;
+  }
+}
+
+void CoreTimingManager::PushEvent(const Event& event)
+{
+  m_event_queue.emplace_back(event);
+  std::ranges::push_heap(m_event_queue, std::ranges::greater{});
+  ++event.type->pending_count;
+}
+
+void CoreTimingManager::PopEvent()
+{
+  const Event& event = m_event_queue.front();
+  if (event.IsRemoved())
+    --m_removed_event_count;
+  else
+    --event.type->pending_count;
+
+  std::ranges::pop_heap(m_event_queue, std::ranges::greater{});
+  m_event_queue.pop_back();
+}
+
+void CoreTimingManager::DiscardRemovedEventsAtFront()
+{
+  while (!m_event_queue.empty() && m_event_queue.front().IsRemoved())
+    PopEvent();
+}
+
+void CoreTimingManager::PurgeRemovedEvents()
+{
+  if (m_removed_event_count == 0)
+    return;
+
+  std::erase_if(m_event_queue, [](const Event& e) { return e.IsRemoved(); });
+  m_removed_event_count = 0;
+
+  // Removing random items breaks the invariant so we have to re-establish it.
+  std::ranges::make_heap(m_event_queue, std::ranges::greater{});
 }
 
 void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_type, u64 userdata,
@@ -281,8 +341,7 @@ void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_t
     if (!m_is_global_timer_sane)
       ForceExceptionCheck(cycles_into_future);
 
-    m_event_queue.emplace_back(Event{timeout, m_event_fifo_id++, userdata, event_type});
-    std::ranges::push_heap(m_event_queue, std::ranges::greater{});
+    PushEvent(Event{timeout, m_event_fifo_id++, userdata, event_type});
   }
   else
   {
@@ -301,13 +360,22 @@ void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_t
 
 void CoreTimingManager::RemoveEvent(EventType* event_type)
 {
-  const size_t erased =
-      std::erase_if(m_event_queue, [&](const Event& e) { return e.type == event_type; });
+  if (event_type->pending_count == 0)
+    return;
 
-  // Removing random items breaks the invariant so we have to re-establish it.
-  if (erased != 0)
+  // Every queued event of this type has a lower fifo_order than the next event to be queued.
+  event_type->removed_before_fifo_order = m_event_fifo_id;
+  m_removed_event_count += std::exchange(event_type->pending_count, 0);
+
+  // Don't let removed events pile up in the queue, and never leave one at the front.
+  if (m_removed_event_count > MIN_REMOVED_EVENTS_TO_PURGE &&
+      m_removed_event_count * 2 > m_event_queue.size())
   {
-    std::ranges::make_heap(m_event_queue, std::ranges::greater{});
+    PurgeRemovedEvents();
+  }
+  else
+  {
+    DiscardRemovedEventsAtFront();
   }
 }
 
@@ -334,13 +402,13 @@ void CoreTimingManager::MoveEvents()
 {
   while (!m_ts_queue.Empty())
   {
-    auto& ev = m_event_queue.emplace_back(m_ts_queue.Front());
+    Event ev = m_ts_queue.Front();
     m_ts_queue.Pop();
 
     ev.fifo_order = m_event_fifo_id++;
     ev.time += m_globals.global_timer;
 
-    std::ranges::push_heap(m_event_queue, std::ranges::greater{});
+    PushEvent(ev);
   }
 }
 
@@ -363,9 +431,9 @@ void CoreTimingManager::Advance()
 
   while (!m_event_queue.empty() && m_event_queue.front().time <= m_globals.global_timer)
   {
-    Event evt = std::move(m_event_queue.front());
-    std::ranges::pop_heap(m_event_queue, std::ranges::greater{});
-    m_event_queue.pop_back();
+    Event evt = m_event_queue.front();
+    PopEvent();
+    DiscardRemovedEventsAtFront();
     evt.type->callback(m_system, evt.userdata, m_globals.global_timer - evt.time);
   }
 
@@ -547,6 +615,7 @@ bool CoreTimingManager::UseSyncOnSkipIdle() const
 void CoreTimingManager::LogPendingEvents() const
 {
   auto clone = m_event_queue;
+  std::erase_if(clone, [](const Event& e) { return e.IsRemoved(); });
   std::ranges::sort(clone);
   for (const Event& ev : clone)
   {
@@ -593,6 +662,7 @@ std::string CoreTimingManager::GetScheduledEventsSummary() const
   text.reserve(1000);
 
   auto clone = m_event_queue;
+  std::erase_if(clone, [](const Event& e) { return e.IsRemoved(); });
   std::ranges::sort(clone);
   for (const Event& ev : clone)
   {
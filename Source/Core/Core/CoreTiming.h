@@ -53,6 +53,12 @@ struct EventType
 {
   TimedCallback callback;
   const std::string* name;
+
+  // RemoveEvent() doesn't search the queue. Instead, queued events of this type with a fifo_order
+  // lower than this value are considered removed, and are discarded once they reach the front.
+  u64 removed_before_fifo_order = 0;
+  // Number of queued events of this type which haven't been removed.
+  u32 pending_count = 0;
 };
 
 struct Event
@@ -71,6 +77,8 @@ struct Event
   {
     return std::tie(time, fifo_order) == std::tie(other.time, other.fifo_order);
   }
+
+  bool IsRemoved() const { return fifo_order < type->removed_before_fifo_order; }
 };
 
 enum class FromThread
@@ -119,6 +127,8 @@ public:
                      FromThread from = FromThread::CPU);
 
   // We only permit one event of each type in the queue at a time.
+  // Removal is O(1): removed events stay in the queue until they reach the front or until they
+  // make up most of the queue, but they never fire and aren't saved to savestates.
   void RemoveEvent(EventType* event_type);
   void RemoveAllEvents(EventType* event_type);
 
@@ -182,10 +192,13 @@ private:
   // STATE_TO_SAVE
   // The queue is a min-heap using std::ranges::make_heap/push_heap/pop_heap.
   // We don't use std::priority_queue because we need to be able to serialize, unserialize and
-  // erase arbitrary events (RemoveEvent()) regardless of the queue order. These aren't accommodated
-  // by the standard adaptor class.
+  // erase arbitrary events (PurgeRemovedEvents()) regardless of the queue order. These aren't
+  // accommodated by the standard adaptor class.
   std::vector<Event> m_event_queue;
   u64 m_event_fifo_id = 0;
+  // Number of events in m_event_queue which have been removed by RemoveEvent().
+  // The event at the front of the queue is never a removed one.
+  size_t m_removed_event_count = 0;
   std::mutex m_ts_write_lock;
 
   // Event objects created from other threads.
@@ -225,6 +238,12 @@ private:
   TimePoint CalculateTargetHostTimeInternal(s64 target_cycle);
   void UpdateVISkip(TimePoint current_time, TimePoint target_time);
 
+  void PushEvent(const Event& event);
+  void PopEvent();
+  void DiscardRemovedEventsAtFront();
+  void PurgeRemovedEvents();
+  void ResetEventTypeCounters();
+
   int DowncountToCycles(int downcount) const;
   int CyclesToDowncount(int cycles) const;
 
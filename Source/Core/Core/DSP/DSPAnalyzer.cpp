@@ -83,6 +83,7 @@ void Analyzer::AnalyzeRange(const SDSP& dsp, u16 start_addr, u16 end_addr)
 
   // Next, we'll scan for potential idle skips.
   FindIdleSkips(dsp, start_addr, end_addr);
+  FindMailboxWaitLoops(dsp, start_addr, end_addr);
 
   INFO_LOG_FMT(DSPLLE, "Finished analysis.");
 }
@@ -172,4 +173,76 @@ void Analyzer::FindIdleSkips(const SDSP& dsp, u16 start_addr, u16 end_addr)
     }
   }
 }
+
+// Looks for the loops which every known ucode uses to wait for the CPU, such as
+//   LRS   $AC0.M, @CMBH
+//   ANDCF $AC0.M, #0x8000
+//   JLNZ  <the LRS>
+// Unlike the signatures above, this only matches loops which branch back to the mailbox read, so
+// the DSP can't get out of them before the CPU accesses the mailbox.
+void Analyzer::FindMailboxWaitLoops(const SDSP& dsp, u16 start_addr, u16 end_addr)
+{
+  for (u16 addr = start_addr; addr < end_addr; addr++)
+  {
+    if (!IsStartOfInstruction(addr))
+      continue;
+
+    u16 next_addr = addr;
+    const UDSPInstruction load = dsp.ReadIMEM(next_addr);
+    u16 reg;
+    u16 mailbox_addr;
+    if ((load & 0xf800) == 0x2000)
+    {
+      // LRS $(0x18+D), @M
+      reg = 0x18 + ((load >> 8) & 0x7);
+      mailbox_addr = 0xff00 | (load & 0xff);
+      next_addr += 1;
+    }
+    else if ((load & 0xffe0) == 0x00c0)
+    {
+      // LR $D, @M
+      reg = load & 0x1f;
+      mailbox_addr = dsp.ReadIMEM(next_addr + 1);
+      next_addr += 2;
+    }
+    else
+    {
+      continue;
+    }
+
+    const bool is_cpu_mailbox = mailbox_addr == (0xff00 | DSP_CMBH);
+    if (!is_cpu_mailbox && mailbox_addr != (0xff00 | DSP_DMBH))
+      continue;
+
+    // ANDCF/ANDF $acD.m, #0x8000
+    const UDSPInstruction test = dsp.ReadIMEM(next_addr);
+    const bool is_andcf = (test & 0xfeff) == 0x02c0;
+    const bool is_andf = (test & 0xfeff) == 0x02a0;
+    if ((!is_andcf && !is_andf) || DSP_REG_ACM0 + ((test >> 8) & 1) != reg ||
+        dsp.ReadIMEM(next_addr + 1) != 0x8000)
+    {
+      continue;
+    }
+    next_addr += 2;
+
+    // JLNZ/JLZ back to the load
+    const UDSPInstruction jump = dsp.ReadIMEM(next_addr);
+    if ((jump != 0x029c && jump != 0x029d) || dsp.ReadIMEM(next_addr + 1) != addr)
+      continue;
+    const bool is_jlz = jump == 0x029d;
+
+    // ANDCF sets LZ if the full bit is set, and ANDF sets it if the bit is clear.
+    const bool loops_while_full = is_jlz == is_andcf;
+    if (is_cpu_mailbox && !loops_while_full)
+    {
+      INFO_LOG_FMT(DSPLLE, "Wait for mail loop found at {:04x}", addr);
+      m_code_flags[addr] |= CODE_IDLE_SKIP | CODE_WAIT_FOR_MAIL;
+    }
+    else if (!is_cpu_mailbox && loops_while_full)
+    {
+      INFO_LOG_FMT(DSPLLE, "Wait for mail read loop found at {:04x}", addr);
+      m_code_flags[addr] |= CODE_IDLE_SKIP | CODE_WAIT_FOR_MAIL_READ;
+    }
+  }
+}
 }  // namespace DSP
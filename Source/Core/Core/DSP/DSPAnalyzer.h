@@ -55,6 +55,20 @@ public:
     return (GetCodeFlags(address) & CODE_IDLE_SKIP) != 0;
   }
 
+  // Whether or not the address is the start of a loop which polls the CPU mailbox until the CPU
+  // sends mail.
+  [[nodiscard]] bool IsWaitForMail(u16 address) const
+  {
+    return (GetCodeFlags(address) & CODE_WAIT_FOR_MAIL) != 0;
+  }
+
+  // Whether or not the address is the start of a loop which polls the DSP mailbox until the CPU
+  // has read the mail the DSP sent.
+  [[nodiscard]] bool IsWaitForMailRead(u16 address) const
+  {
+    return (GetCodeFlags(address) & CODE_WAIT_FOR_MAIL_READ) != 0;
+  }
+
   // Whether or not the address indicates the start of a loop.
   [[nodiscard]] bool IsLoopStart(u16 address) const
   {
@@ -93,6 +107,8 @@ private:
     CODE_LOOP_END = 8,
     CODE_UPDATE_SR = 16,
     CODE_CHECK_EXC = 32,
+    CODE_WAIT_FOR_MAIL = 64,
+    CODE_WAIT_FOR_MAIL_READ = 128,
   };
 
   // Flushes all analyzed state.
@@ -110,6 +126,9 @@ private:
   // Finds locations within the range [start_addr, end_addr) that may contain idle skips.
   void FindIdleSkips(const SDSP& dsp, u16 start_addr, u16 end_addr);
 
+  // Finds loops within the range [start_addr, end_addr) that do nothing but poll a mailbox.
+  void FindMailboxWaitLoops(const SDSP& dsp, u16 start_addr, u16 end_addr);
+
   // Retrieves the flags set during analysis for code in memory.
   [[nodiscard]] u8 GetCodeFlags(u16 address) const { return m_code_flags[address]; }
 
@@ -429,6 +429,9 @@ bool DSPCore::Initialize(const DSPInitOptions& opts)
   if (!m_dsp.Initialize(opts))
     return false;
 
+  // IRAM and IROM were just filled in.
+  m_dsp_interpreter->ClearBlockCache();
+
   m_init_hax = false;
 
   // Initialize JIT, if necessary
@@ -504,6 +507,8 @@ void DSPCore::Reset()
 
 void DSPCore::ClearIRAM()
 {
+  m_dsp_interpreter->ClearBlockCache();
+
   if (!m_dsp_jit)
     return;
 
@@ -559,6 +564,23 @@ u32 DSPCore::PeekMailbox(Mailbox mailbox) const
   return m_dsp.PeekMailbox(mailbox);
 }
 
+bool DSPCore::IsWaitingForMail() const
+{
+  const Analyzer& analyzer = m_dsp.GetAnalyzer();
+  const u16 pc = m_dsp.pc;
+
+  bool waiting;
+  if (analyzer.IsWaitForMail(pc))
+    waiting = (m_dsp.PeekMailbox(Mailbox::CPU) & 0x80000000) == 0;
+  else if (analyzer.IsWaitForMailRead(pc))
+    waiting = (m_dsp.PeekMailbox(Mailbox::DSP) & 0x80000000) != 0;
+  else
+    return false;
+
+  return waiting && m_core_state == State::Running && m_dsp.exceptions == 0 &&
+         !m_dsp.external_interrupt_waiting.load(std::memory_order_acquire);
+}
+
 u16 DSPCore::ReadMailboxLow(Mailbox mailbox)
 {
   return m_dsp.ReadMailboxLow(mailbox);
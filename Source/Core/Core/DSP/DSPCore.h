@@ -541,6 +541,11 @@ public:
   // Checks the value within a mailbox.
   u32 PeekMailbox(Mailbox mailbox) const;
 
+  // Whether the DSP is in a loop which waits for the CPU to send mail or to read the DSP's mail.
+  // Running it doesn't change anything until the CPU accesses the mailboxes or the control
+  // register, so it can be left alone until then.
+  bool IsWaitingForMail() const;
+
   // Reads the low part of the specified mailbox register.
   u16 ReadMailboxLow(Mailbox mailbox);
 
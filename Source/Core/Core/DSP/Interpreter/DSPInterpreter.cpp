@@ -4,6 +4,8 @@
 
 #include "Core/DSP/Interpreter/DSPInterpreter.h"
 
+#include <optional>
+
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
@@ -41,6 +43,23 @@ namespace DSP::Interpreter
 // extended opcodes "win" over the main opcode).
 // #define PRECISE_BACKLOG
 
+namespace
+{
+// Index into the decoded instructions. Only IRAM and IROM contain code.
+std::optional<size_t> GetDecodedIndex(u16 addr)
+{
+  switch (addr >> 12)
+  {
+  case 0x0:
+    return addr & DSP_IRAM_MASK;
+  case 0x8:
+    return DSP_IRAM_SIZE + (addr & DSP_IROM_MASK);
+  default:
+    return std::nullopt;
+  }
+}
+}  // namespace
+
 Interpreter::Interpreter(DSPCore& dsp) : m_dsp_core{dsp}
 {
   InitInstructionTables();
@@ -65,6 +84,62 @@ void Interpreter::ExecuteInstruction(const UDSPInstruction inst)
   }
 }
 
+void Interpreter::ExecuteInstruction(const DecodedInstruction& decoded)
+{
+  if (decoded.ext_op != nullptr)
+  {
+    (this->*decoded.ext_op)(decoded.inst);
+    (this->*decoded.op)(decoded.inst);
+    ApplyWriteBackLog();
+  }
+  else
+  {
+    (this->*decoded.op)(decoded.inst);
+  }
+}
+
+const Interpreter::DecodedInstruction* Interpreter::GetDecodedInstruction(u16 addr)
+{
+  const std::optional<size_t> index = GetDecodedIndex(addr);
+  if (!index) [[unlikely]]
+    return nullptr;
+
+  const DecodedInstruction* decoded = &m_decoded_instructions[*index];
+  if (decoded->op == nullptr) [[unlikely]]
+    DecodeBlock(addr);
+  return decoded;
+}
+
+// Decodes the instructions from addr up to the next branch.
+void Interpreter::DecodeBlock(u16 addr)
+{
+  const auto& state = m_dsp_core.DSPState();
+
+  while (true)
+  {
+    const std::optional<size_t> index = GetDecodedIndex(addr);
+    if (!index || m_decoded_instructions[*index].op != nullptr)
+      return;
+
+    const UDSPInstruction inst = state.ReadIMEM(addr);
+    const DSPOPCTemplate* opcode_template = GetOpTemplate(inst);
+
+    DecodedInstruction& decoded = m_decoded_instructions[*index];
+    decoded.op = GetOp(inst);
+    decoded.ext_op = opcode_template->extended ? GetExtOp(inst) : nullptr;
+    decoded.inst = inst;
+
+    if (opcode_template->branch)
+      return;
+    addr += opcode_template->size;
+  }
+}
+
+void Interpreter::ClearBlockCache()
+{
+  m_decoded_instructions.fill({});
+}
+
 void Interpreter::Step()
 {
   auto& state = m_dsp_core.DSPState();
@@ -72,8 +147,16 @@ void Interpreter::Step()
   m_dsp_core.CheckExceptions();
   state.AdvanceStepCounter();
 
-  const u16 opc = state.FetchInstruction();
-  ExecuteInstruction(UDSPInstruction{opc});
+  if (const DecodedInstruction* decoded = GetDecodedInstruction(state.pc))
+  {
+    state.pc++;
+    ExecuteInstruction(*decoded);
+  }
+  else
+  {
+    const u16 opc = state.FetchInstruction();
+    ExecuteInstruction(UDSPInstruction{opc});
+  }
 
   const auto pc = state.pc;
   if (state.GetAnalyzer().IsLoopEnd(static_cast<u16>(pc - 1)))
@@ -99,6 +182,10 @@ int Interpreter::RunCyclesThread(int cycles)
     cycles--;
     if (cycles <= 0)
       return 0;
+
+    // The rest of the cycles would be spent polling the mailbox.
+    if (m_dsp_core.IsWaitingForMail())
+      return 0;
   }
 }
 
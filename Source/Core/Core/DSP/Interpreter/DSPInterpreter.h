@@ -8,6 +8,7 @@
 
 #include "Core/DSP/DSPCommon.h"
 #include "Core/DSP/DSPCore.h"
+#include "Core/DSP/Interpreter/DSPIntTables.h"
 
 namespace DSP::Interpreter
 {
@@ -40,6 +41,9 @@ public:
 
   void ApplyWriteBackLog();
 
+  // Forgets all decoded instructions. Must be called whenever IRAM or IROM is written to.
+  void ClearBlockCache();
+
   // All the opcode functions.
   void abs(UDSPInstruction opc);
   void add(UDSPInstruction opc);
@@ -190,7 +194,21 @@ public:
   void nop_ext(UDSPInstruction opc);
 
 private:
+  // An instruction with its opcode functions looked up ahead of time.
+  struct DecodedInstruction
+  {
+    InterpreterFunction op = nullptr;
+    // Only set if the instruction has an extended opcode.
+    InterpreterFunction ext_op = nullptr;
+    UDSPInstruction inst = 0;
+  };
+
   void ExecuteInstruction(UDSPInstruction inst);
+  void ExecuteInstruction(const DecodedInstruction& decoded);
+
+  // Returns nullptr if the address is outside of IRAM and IROM.
+  const DecodedInstruction* GetDecodedInstruction(u16 addr);
+  void DecodeBlock(u16 addr);
 
   bool CheckCondition(u8 condition) const;
 
@@ -240,6 +258,10 @@ private:
 
   DSPCore& m_dsp_core;
 
+  // IRAM followed by IROM.
+  static constexpr size_t DECODED_INSTRUCTIONS_SIZE = size_t{DSP_IRAM_SIZE} + DSP_IROM_SIZE;
+  std::array<DecodedInstruction, DECODED_INSTRUCTIONS_SIZE> m_decoded_instructions{};
+
   static constexpr size_t WRITEBACK_LOG_SIZE = 5;
   std::array<u16, WRITEBACK_LOG_SIZE> m_write_back_log{};
   std::array<int, WRITEBACK_LOG_SIZE> m_write_back_log_idx{-1, -1, -1, -1, -1};
@@ -0,0 +1,166 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/DSPHLE/UCodes/AXMix.h"
+
+#include <algorithm>
+
+#if defined(_M_X86) || defined(_M_X86_64)
+#define USE_SSE
+#include <emmintrin.h>
+#elif defined(_M_ARM_64)
+#define USE_NEON
+#include <arm_neon.h>
+#endif
+
+#include "Common/CommonTypes.h"
+
+namespace DSP::HLE::AXMix
+{
+namespace
+{
+s16 ScaleSample(s16 sample, u16 volume, bool signed_volume)
+{
+  const s32 product = signed_volume ? s32(sample) * s16(volume) : s32(sample) * volume;
+  return static_cast<s16>(std::clamp(product >> 15, -0x8000, 0x7FFF));
+}
+
+#if defined(USE_SSE)
+// The volumes of the next eight samples.
+__m128i GetVolumes(u16 volume, u16 volume_delta)
+{
+  const __m128i steps = _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7);
+  return _mm_add_epi16(_mm_set1_epi16(static_cast<s16>(volume)),
+                       _mm_mullo_epi16(_mm_set1_epi16(static_cast<s16>(volume_delta)), steps));
+}
+
+__m128i ScaleSamples(__m128i samples, __m128i volumes, bool signed_volume)
+{
+  // The products don't fit in 16 bits, so put them together from their low and high halves.
+  const __m128i lo = _mm_mullo_epi16(samples, volumes);
+  __m128i hi = _mm_mulhi_epi16(samples, volumes);
+  // The signed multiplication took volumes of 0x8000 and above as negative, which is off by
+  // (sample << 16) for those.
+  if (!signed_volume)
+    hi = _mm_add_epi16(hi, _mm_and_si128(samples, _mm_srai_epi16(volumes, 15)));
+
+  const __m128i products_lo = _mm_srai_epi32(_mm_unpacklo_epi16(lo, hi), 15);
+  const __m128i products_hi = _mm_srai_epi32(_mm_unpackhi_epi16(lo, hi), 15);
+  return _mm_packs_epi32(products_lo, products_hi);
+}
+#elif defined(USE_NEON)
+uint16x8_t GetVolumes(u16 volume, u16 volume_delta)
+{
+  static constexpr u16 steps[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+  return vmlaq_n_u16(vdupq_n_u16(volume), vld1q_u16(steps), volume_delta);
+}
+
+int16x8_t ScaleSamples(int16x8_t samples, uint16x8_t volumes, bool signed_volume)
+{
+  int32x4_t products_lo;
+  int32x4_t products_hi;
+  if (signed_volume)
+  {
+    const int16x8_t signed_volumes = vreinterpretq_s16_u16(volumes);
+    products_lo = vmull_s16(vget_low_s16(samples), vget_low_s16(signed_volumes));
+    products_hi = vmull_high_s16(samples, signed_volumes);
+  }
+  else
+  {
+    products_lo = vmulq_s32(vmovl_s16(vget_low_s16(samples)),
+                            vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(volumes))));
+    products_hi = vmulq_s32(vmovl_high_s16(samples),
+                            vreinterpretq_s32_u32(vmovl_high_u16(volumes)));
+  }
+  return vcombine_s16(vqmovn_s32(vshrq_n_s32(products_lo, 15)),
+                      vqmovn_s32(vshrq_n_s32(products_hi, 15)));
+}
+#endif
+}  // namespace
+
+void ApplyVolume(s16* samples, u32 count, u16* volume, u16 volume_delta, bool signed_volume)
+{
+  u32 i = 0;
+  u16 current_volume = *volume;
+
+#if defined(USE_SSE)
+  __m128i volumes = GetVolumes(current_volume, volume_delta);
+  const __m128i volume_step = _mm_set1_epi16(static_cast<s16>(volume_delta * 8));
+  for (; i + 8 <= count; i += 8)
+  {
+    __m128i* const ptr = reinterpret_cast<__m128i*>(samples + i);
+    _mm_storeu_si128(ptr, ScaleSamples(_mm_loadu_si128(ptr), volumes, signed_volume));
+    volumes = _mm_add_epi16(volumes, volume_step);
+  }
+#elif defined(USE_NEON)
+  uint16x8_t volumes = GetVolumes(current_volume, volume_delta);
+  const uint16x8_t volume_step = vdupq_n_u16(static_cast<u16>(volume_delta * 8));
+  for (; i + 8 <= count; i += 8)
+  {
+    vst1q_s16(samples + i, ScaleSamples(vld1q_s16(samples + i), volumes, signed_volume));
+    volumes = vaddq_u16(volumes, volume_step);
+  }
+#endif
+  current_volume += static_cast<u16>(volume_delta * i);
+
+  for (; i < count; ++i)
+  {
+    samples[i] = ScaleSample(samples[i], current_volume, signed_volume);
+    current_volume += volume_delta;
+  }
+
+  *volume = current_volume;
+}
+
+void MixAdd(int* out, const s16* input, u32 count, u16* volume, u16 volume_delta,
+            s16* last_sample)
+{
+  u32 i = 0;
+  u16 current_volume = *volume;
+
+#if defined(USE_SSE)
+  __m128i volumes = GetVolumes(current_volume, volume_delta);
+  const __m128i volume_step = _mm_set1_epi16(static_cast<s16>(volume_delta * 8));
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128i samples = ScaleSamples(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i)), volumes, false);
+    volumes = _mm_add_epi16(volumes, volume_step);
+
+    // Sign extend the samples to 32 bits.
+    const __m128i samples_lo = _mm_srai_epi32(_mm_unpacklo_epi16(samples, samples), 16);
+    const __m128i samples_hi = _mm_srai_epi32(_mm_unpackhi_epi16(samples, samples), 16);
+    __m128i* const out_lo = reinterpret_cast<__m128i*>(out + i);
+    __m128i* const out_hi = reinterpret_cast<__m128i*>(out + i + 4);
+    _mm_storeu_si128(out_lo, _mm_add_epi32(_mm_loadu_si128(out_lo), samples_lo));
+    _mm_storeu_si128(out_hi, _mm_add_epi32(_mm_loadu_si128(out_hi), samples_hi));
+
+    *last_sample = static_cast<s16>(_mm_extract_epi16(samples, 7));
+  }
+#elif defined(USE_NEON)
+  uint16x8_t volumes = GetVolumes(current_volume, volume_delta);
+  const uint16x8_t volume_step = vdupq_n_u16(static_cast<u16>(volume_delta * 8));
+  for (; i + 8 <= count; i += 8)
+  {
+    const int16x8_t samples = ScaleSamples(vld1q_s16(input + i), volumes, false);
+    volumes = vaddq_u16(volumes, volume_step);
+
+    vst1q_s32(out + i, vaddw_s16(vld1q_s32(out + i), vget_low_s16(samples)));
+    vst1q_s32(out + i + 4, vaddw_high_s16(vld1q_s32(out + i + 4), samples));
+
+    *last_sample = vgetq_lane_s16(samples, 7);
+  }
+#endif
+  current_volume += static_cast<u16>(volume_delta * i);
+
+  for (; i < count; ++i)
+  {
+    const s16 sample = ScaleSample(input[i], current_volume, false);
+    out[i] += sample;
+    current_volume += volume_delta;
+    *last_sample = sample;
+  }
+
+  *volume = current_volume;
+}
+}  // namespace DSP::HLE::AXMix
@@ -0,0 +1,21 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+// Block-wise sample operations of the AX voice processing, shared by AX GC and AX Wii. They give
+// the same results as the DSP processing one sample at a time.
+namespace DSP::HLE::AXMix
+{
+// Multiplies each sample by the volume and clamps the result, as in clamp((sample * volume) >> 15).
+// The volume is increased by volume_delta after each sample, and is left at the value after the
+// last sample. The volume is signed if signed_volume is set, and unsigned otherwise.
+void ApplyVolume(s16* samples, u32 count, u16* volume, u16 volume_delta, bool signed_volume);
+
+// Adds the samples, multiplied by the unsigned volume like in ApplyVolume(), to out. The volume
+// is updated like in ApplyVolume(), and last_sample is set to the last sample which was added.
+void MixAdd(int* out, const s16* input, u32 count, u16* volume, u16 volume_delta,
+            s16* last_sample);
+}  // namespace DSP::HLE::AXMix
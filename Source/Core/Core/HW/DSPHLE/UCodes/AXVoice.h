@@ -12,8 +12,8 @@
 #endif
 
 #include <algorithm>
+#include <array>
 #include <bit>
-#include <functional>
 #include <memory>
 
 #include "Common/CommonTypes.h"
@@ -21,6 +21,7 @@
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/DSP.h"
 #include "Core/HW/DSPHLE/UCodes/AX.h"
+#include "Core/HW/DSPHLE/UCodes/AXMix.h"
 #include "Core/HW/DSPHLE/UCodes/AXStructs.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
@@ -35,6 +36,10 @@ namespace DSP::HLE
 #define MAX_SAMPLES_PER_FRAME 96
 #endif
 
+// Input samples which are decoded ahead of resampling them. This covers ratios up to 8; voices
+// with higher ratios read their samples one at a time.
+#define MAX_INPUT_SAMPLES_PER_FRAME (MAX_SAMPLES_PER_FRAME * 8)
+
 // Use an inline namespace to prevent stupid compilers and debuggers from merging
 // functions from AX GC and AX Wii.
 #ifdef AX_GC
@@ -215,7 +220,8 @@ u16 AcceleratorGetSample(HLEAccelerator* accelerator)
 // We start getting samples not from sample 0, but 0.<curr_pos_frac>. This
 // avoids discontinuities in the audio stream, especially with very low ratios
 // which interpolate a lot of values between two "real" samples.
-u32 ResampleAudio(std::function<s16(u32)> input_callback, s16* output, u32 count, s16* last_samples,
+template <typename InputCallback>
+u32 ResampleAudio(InputCallback input_callback, s16* output, u32 count, s16* last_samples,
                   u32 curr_pos, u32 ratio, int srctype, const s16* coeffs)
 {
   int read_samples_count = 0;
@@ -327,6 +333,22 @@ u32 ResampleAudio(std::function<s16(u32)> input_callback, s16* output, u32 count
   return curr_pos;
 }
 
+// Returns how many input samples ResampleAudio() reads to produce <count> output samples.
+u32 GetResampleInputCount(u32 count, u32 curr_pos, u32 ratio, int srctype)
+{
+  if (srctype != SRCTYPE_LINEAR && srctype != SRCTYPE_POLYPHASE)
+    return count;
+
+  u32 input_count = 0;
+  for (u32 i = 0; i < count; ++i)
+  {
+    curr_pos += ratio;
+    input_count += curr_pos >> 16;
+    curr_pos &= 0xFFFF;
+  }
+  return input_count;
+}
+
 // Read <count> input samples from ARAM, decoding and converting rate
 // if required.
 void GetInputSamples(HLEAccelerator* accelerator, PB_TYPE& pb, s16* samples, u16 count,
@@ -336,9 +358,26 @@ void GetInputSamples(HLEAccelerator* accelerator, PB_TYPE& pb, s16* samples, u16
 
   if (coeffs)
     coeffs += pb.coef_select * 0x200;
-  u32 curr_pos = ResampleAudio([accelerator](u32) { return AcceleratorGetSample(accelerator); },
-                               samples, count, pb.src.last_samples, pb.src.cur_addr_frac,
-                               HILO_TO_32(pb.src.ratio), pb.src_type, coeffs);
+
+  const u32 ratio = HILO_TO_32(pb.src.ratio);
+  const u32 input_count = GetResampleInputCount(count, pb.src.cur_addr_frac, ratio, pb.src_type);
+  u32 curr_pos;
+  if (input_count <= MAX_INPUT_SAMPLES_PER_FRAME) [[likely]]
+  {
+    // Decode all of the input ahead of resampling it, which keeps both loops simple.
+    std::array<s16, MAX_INPUT_SAMPLES_PER_FRAME> input;
+    for (u32 i = 0; i < input_count; ++i)
+      input[i] = AcceleratorGetSample(accelerator);
+
+    curr_pos = ResampleAudio([&input](u32 i) { return input[i]; }, samples, count,
+                             pb.src.last_samples, pb.src.cur_addr_frac, ratio, pb.src_type, coeffs);
+  }
+  else
+  {
+    curr_pos = ResampleAudio([accelerator](u32) { return AcceleratorGetSample(accelerator); },
+                             samples, count, pb.src.last_samples, pb.src.cur_addr_frac, ratio,
+                             pb.src_type, coeffs);
+  }
   pb.src.cur_addr_frac = (curr_pos & 0xFFFF);
 
   // Update current position, YN1, YN2 and pred scale in the PB.
@@ -357,27 +396,8 @@ s16 ClampS16(s64 sample)
 // Add samples to an output buffer, with optional volume ramping.
 void MixAdd(int* out, const s16* input, u32 count, VolumeData* vd, s16* dpop, bool ramp)
 {
-  u16& volume = vd->volume;
-  u16 volume_delta = vd->volume_delta;
-
-  // If volume ramping is disabled, set volume_delta to 0. That way, the
-  // mixing loop can avoid testing if volume ramping is enabled at each step,
-  // and just add volume_delta.
-  if (!ramp)
-    volume_delta = 0;
-
-  for (u32 i = 0; i < count; ++i)
-  {
-    s64 sample = input[i];
-    sample *= volume;
-    sample >>= 15;
-    s16 sample16 = ClampS16((s32)sample);
-
-    out[i] += sample16;
-    volume += volume_delta;
-
-    *dpop = sample16;
-  }
+  // If volume ramping is disabled, the volume stays the same.
+  AXMix::MixAdd(out, input, count, &vd->volume, ramp ? vd->volume_delta : 0, dpop);
 }
 
 // Execute a low pass filter on the samples using one history value.
@@ -430,19 +450,17 @@ void ProcessVoice(HLEAccelerator* accelerator, PB_TYPE& pb, const AXBuffers& buf
   GetInputSamples(accelerator, pb, samples, count, coeffs);
 
   // Apply a global volume ramp using the volume envelope parameters.
-  for (u32 i = 0; i < count; ++i)
-  {
 #ifdef AX_GC
-    // signed on GameCube
-    const s32 volume = (s16)pb.vol_env.cur_volume;
+  // signed on GameCube
+  constexpr bool signed_volume = true;
 #else
-    // unsigned on Wii
-    const s32 volume = (u16)pb.vol_env.cur_volume;
+  // unsigned on Wii
+  constexpr bool signed_volume = false;
 #endif
-    const s32 sample = ((s32)samples[i] * volume) >> 15;
-    samples[i] = ClampS16(sample);
-    pb.vol_env.cur_volume += pb.vol_env.cur_volume_delta;
-  }
+  u16 volume = static_cast<u16>(pb.vol_env.cur_volume);
+  AXMix::ApplyVolume(samples, count, &volume, static_cast<u16>(pb.vol_env.cur_volume_delta),
+                     signed_volume);
+  pb.vol_env.cur_volume = static_cast<s16>(volume);
 
   // Optionally, execute a low-pass and/or biquad filter.
   if (pb.lpf.on != 0)
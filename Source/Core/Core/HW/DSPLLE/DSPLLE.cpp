@@ -267,6 +267,10 @@ void DSPLLE::DSP_Update(int cycles)
   // If we're not on a thread, run cycles here.
   if (!m_is_dsp_on_thread)
   {
+    // Nothing would happen until the CPU accesses the mailboxes.
+    if (m_dsp_core.IsWaitingForMail())
+      return;
+
     // ~1/6th as many cycles as the period PPC-side.
     m_dsp_core.RunCycles(dsp_cycles);
   }
@@ -274,6 +278,15 @@ void DSPLLE::DSP_Update(int cycles)
   {
     // Wait for DSP thread to complete its cycle. Note: this logic should be thought through.
     m_ppc_event.Wait();
+
+    // The DSP thread is done with its cycles, so it's safe to look at the DSP state. Leave the
+    // thread asleep while the DSP is only waiting for mail.
+    if (m_dsp_core.IsWaitingForMail())
+    {
+      m_ppc_event.Set();
+      return;
+    }
+
     m_cycle_count.fetch_add(dsp_cycles);
     m_dsp_event.Set();
   }
@@ -293,6 +293,9 @@ void CachedInterpreter::Jit(u32 em_address, bool clear_cache_and_retry_on_failur
       analyzer.Analyze(em_address, &code_block, &m_code_buffer, m_code_buffer.size());
   if (code_block.m_memory_exception)
   {
+    if (m_precompiling)
+      return;
+
     // Address of instruction could not be translated
     m_ppc_state.npc = nextPC;
     m_ppc_state.Exceptions |= EXCEPTION_ISI;
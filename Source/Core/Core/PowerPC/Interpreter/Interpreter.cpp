@@ -269,20 +269,23 @@ void Interpreter::Run()
     {
       // "fast" version of inner loop. well, it's not so fast.
       while (m_ppc_state.downcount > 0)
-      {
-        m_end_block = false;
-
-        int cycles = 0;
-        while (!m_end_block)
-        {
-          cycles += SingleStepInner();
-        }
-        m_ppc_state.downcount -= cycles;
-      }
+        RunBlock();
     }
   }
 }
 
+void Interpreter::RunBlock()
+{
+  m_end_block = false;
+
+  int cycles = 0;
+  while (!m_end_block)
+  {
+    cycles += SingleStepInner();
+  }
+  m_ppc_state.downcount -= cycles;
+}
+
 void Interpreter::unknown_instruction(Interpreter& interpreter, UGeckoInstruction inst)
 {
   ASSERT(Core::IsCPUThread());
@@ -36,6 +36,9 @@ public:
   void Shutdown() override;
   void SingleStep() override;
   int SingleStepInner();
+  // Runs instructions up to the end of the current block and subtracts their cycles from the
+  // downcount, like a single iteration of the fast run loop.
+  void RunBlock();
 
   void Run() override;
   void ClearCache() override;
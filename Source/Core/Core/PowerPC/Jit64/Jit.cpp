@@ -305,6 +305,7 @@ void Jit64::ClearCache()
 {
   blocks.Clear();
   blocks.ClearRangesToFree();
+  m_interpreted_block_counts.clear();
   trampolines.ClearCodeSpace();
   m_far_code.ClearCodeSpace();
   m_const_pool.Clear();
@@ -573,6 +574,9 @@ void Jit64::MSRUpdated(const OpArg& msr, X64Reg scratch_reg)
 
 void Jit64::WriteExit(u32 destination, bool bl, u32 after)
 {
+  // The registers have just been flushed, so this is what is still in the pinned host registers.
+  const BitSet32 pinned_gprs = gpr.GetPinnedRegistersAtFlush();
+
   if (!m_enable_blr_optimization)
     bl = false;
 
@@ -586,10 +590,10 @@ void Jit64::WriteExit(u32 destination, bool bl, u32 after)
 
   SUB(32, PPCSTATE(downcount), Imm32(js.downcountAmount));
 
-  JustWriteExit(destination, bl, after);
+  JustWriteExit(destination, bl, after, pinned_gprs);
 }
 
-void Jit64::JustWriteExit(u32 destination, bool bl, u32 after)
+void Jit64::JustWriteExit(u32 destination, bool bl, u32 after, BitSet32 pinned_gprs)
 {
   // If nobody has taken care of this yet (this can be removed when all branches are done)
   JitBlock* b = js.curBlock;
@@ -597,6 +601,7 @@ void Jit64::JustWriteExit(u32 destination, bool bl, u32 after)
   linkData.exitAddress = destination;
   linkData.linkStatus = false;
   linkData.call = bl;
+  linkData.pinned_gprs = pinned_gprs;
 
   MOV(32, PPCSTATE(pc), Imm32(destination));
 
@@ -777,6 +782,27 @@ void Jit64::Trace()
                 m_ppc_state.msr.Hex, m_ppc_state.spr[8], regs, fregs);
 }
 
+void Jit64::CompileOrInterpret(Jit64& jit, u32 em_address)
+{
+  if (jit.UsesTieredCompilation())
+  {
+    // The BLR optimization may have to be disabled before running anything.
+    jit.CleanUpAfterStackFault();
+
+    const u64 key = (u64{jit.m_ppc_state.feature_flags} << 32) | em_address;
+    int& count = jit.m_interpreted_block_counts[key];
+    if (count < jit.m_compile_threshold)
+    {
+      ++count;
+      jit.m_system.GetInterpreter().RunBlock();
+      return;
+    }
+    jit.m_interpreted_block_counts.erase(key);
+  }
+
+  jit.Jit(em_address);
+}
+
 void Jit64::Jit(u32 em_address)
 {
   Jit(em_address, true);
@@ -817,6 +843,7 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
         analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CROR_MERGE);
         analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CARRY_MERGE);
         analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW);
+        analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CONDITIONAL_BRANCH_FOLLOW);
       }
       Trace();
     }
@@ -829,6 +856,9 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
 
   if (code_block.m_memory_exception)
   {
+    if (m_precompiling)
+      return;
+
     // Address of instruction could not be translated
     m_ppc_state.npc = nextPC;
     m_ppc_state.Exceptions |= EXCEPTION_ISI;
@@ -924,6 +954,12 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   // TODO: Test if this or AlignCode16 make a difference from GetCodePtr
   b->normalEntry = AlignCode4();
 
+  // Linked blocks pass the pinned registers in host registers, so only the dispatcher has to load
+  // the ones this block reads.
+  b->pinned_gprs = code_block.m_gpr_inputs & GPRRegCache::GetPinnedRegisters();
+  gpr.LoadPinnedRegisters(b->pinned_gprs);
+  b->pinned_entry = GetWritableCodePtr();
+
   // Used to get a trace of the last few blocks before a crash, sometimes VERY useful
   if (m_im_here_debug)
   {
@@ -945,6 +981,7 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   // They use the information in gpa/fpa to preload commonly used registers.
   gpr.Start();
   fpr.Start();
+  gpr.SetPinnedRegistersLoaded(b->pinned_gprs);
 
   m_constant_propagation.Clear();
 
@@ -1324,6 +1361,7 @@ void Jit64::EnableOptimization()
   analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_CROR_MERGE);
   analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_CARRY_MERGE);
   analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW);
+  analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_CONDITIONAL_BRANCH_FOLLOW);
 }
 
 void Jit64::IntializeSpeculativeConstants()
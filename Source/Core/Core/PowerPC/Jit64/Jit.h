@@ -18,6 +18,7 @@
 #pragma once
 
 #include <optional>
+#include <unordered_map>
 
 #include <rangeset/rangesizeset.h>
 
@@ -66,6 +67,12 @@ public:
   void Jit(u32 em_address, bool clear_cache_and_retry_on_failure);
   bool DoJit(u32 em_address, JitBlock* b, u32 nextPC);
 
+  // With tiered compilation, the dispatcher interprets blocks the first few times they run and
+  // only compiles them once they have run often enough, so that code which only runs a handful
+  // of times (like initialization code) doesn't have to pay for being compiled.
+  bool UsesTieredCompilation() const { return m_compile_threshold > 0 && !IsDebuggingEnabled(); }
+  static void CompileOrInterpret(Jit64& jit, u32 em_address);
+
   void EraseSingleBlock(const JitBlock& block) override;
   std::vector<MemoryStats> GetMemoryStats() const override;
 
@@ -102,7 +109,7 @@ public:
   void MSRUpdated(const Gen::OpArg& msr, Gen::X64Reg scratch_reg);
   void FakeBLCall(u32 after);
   void WriteExit(u32 destination, bool bl = false, u32 after = 0);
-  void JustWriteExit(u32 destination, bool bl, u32 after);
+  void JustWriteExit(u32 destination, bool bl, u32 after, BitSet32 pinned_gprs = {});
   void WriteExitDestInRSCRATCH(bool bl = false, u32 after = 0);
   void WriteBLRExit();
   void WriteExceptionExit();
@@ -303,5 +310,9 @@ private:
   const bool m_im_here_debug = false;
   const bool m_im_here_log = false;
   std::map<u32, int> m_been_here;
+  // How many times each block that hasn't been compiled yet has been interpreted. Like the block
+  // cache, this tells blocks apart by their feature flags (upper 32 bits of the key) and their
+  // effective address (lower 32 bits).
+  std::unordered_map<u64, int> m_interpreted_block_counts;
   std::unique_ptr<HostDisassembler> m_disassembler;
 };
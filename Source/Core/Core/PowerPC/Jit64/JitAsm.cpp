@@ -211,15 +211,28 @@ void Jit64AsmRoutineManager::Generate()
   ABI_PushRegistersAndAdjustStack({}, 0);
   MOV(64, R(ABI_PARAM1), Imm64(reinterpret_cast<u64>(&m_jit)));
   MOV(32, R(ABI_PARAM2), PPCSTATE(pc));
-  ABI_CallFunction(JitTrampoline);
+  if (m_jit.UsesTieredCompilation())
+    ABI_CallFunction(Jit64::CompileOrInterpret);
+  else
+    ABI_CallFunction(JitTrampoline);
   ABI_PopRegistersAndAdjustStack({}, 0);
 
   // If jitting triggered an ISI exception, MSR.DR may have changed
   MOV(64, R(RMEM), PPCSTATE(mem_ptr));
 
+  // Interpreting a block uses up cycles, so the timing check can't be skipped in that case.
+  FixupBranch interpreted_bail;
+  if (m_jit.UsesTieredCompilation())
+  {
+    CMP(32, PPCSTATE(downcount), Imm8(0));
+    interpreted_bail = J_CC(CC_LE);
+  }
+
   JMP(dispatcher_no_check);
 
   SetJumpTarget(bail);
+  if (m_jit.UsesTieredCompilation())
+    SetJumpTarget(interpreted_bail);
   do_timing = GetCodePtr();
 
   // make sure npc contains the next pc (needed for exception checking in CoreTiming::Advance)
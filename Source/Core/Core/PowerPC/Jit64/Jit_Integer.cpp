@@ -472,6 +472,22 @@ void Jit64::DoMergedBranchCondition()
     break;
   }
 
+  if (js.op[1].branchIsFollowed)
+  {
+    // The block continues at the branch target, so only the not taken path exits.
+    SwitchToFarCode();
+    SetJumpTarget(pDontBranch);
+    {
+      RCForkGuard gpr_guard = gpr.Fork();
+      RCForkGuard fpr_guard = fpr.Fork();
+      gpr.Flush();
+      fpr.Flush();
+      WriteExit(nextPC + 4);
+    }
+    SwitchToNearCode();
+    return;
+  }
+
   {
     RCForkGuard gpr_guard = gpr.Fork();
     RCForkGuard fpr_guard = fpr.Fork();
@@ -530,7 +546,17 @@ void Jit64::DoMergedBranchImmediate(s64 val)
     break;
   }
 
-  if (branch)
+  if (js.op[1].branchIsFollowed)
+  {
+    // The block continues at the branch target, so only the not taken path exits.
+    if (!branch)
+    {
+      gpr.Flush();
+      fpr.Flush();
+      WriteExit(nextPC + 4);
+    }
+  }
+  else if (branch)
   {
     gpr.Flush();
     fpr.Flush();
@@ -75,6 +75,11 @@ std::span<const X64Reg> FPURegCache::GetAllocationOrder() const
   return allocation_order;
 }
 
+X64Reg FPURegCache::GetPinnedXReg(preg_t preg) const
+{
+  return INVALID_REG;
+}
+
 OpArg FPURegCache::GetDefaultLocation(preg_t preg) const
 {
   return PPCSTATE_PS0(preg);
@@ -24,6 +24,7 @@ protected:
   void LoadRegister(preg_t preg, Gen::X64Reg newLoc) override;
   void DiscardImm(preg_t preg) override;
   std::span<const Gen::X64Reg> GetAllocationOrder() const override;
+  Gen::X64Reg GetPinnedXReg(preg_t preg) const override;
   BitSet32 GetRegUtilization() const override;
   BitSet32 CountRegsIn(preg_t preg, u32 lookahead) const override;
 };
@@ -93,17 +93,54 @@ OpArg GPRRegCache::GetDefaultLocation(preg_t preg) const
 std::span<const X64Reg> GPRRegCache::GetAllocationOrder() const
 {
   static constexpr X64Reg allocation_order[] = {
+  // The pinned registers come last, so that they are usually free for their guest registers.
 #ifdef _WIN32
-      RSI, RDI, R13, R14, R15, R8,
-      R9,  R10, R11, R12, RCX
+      RSI, RDI, R13, R8,  R9,  R10,
+      R11, R12, R14, R15, RCX
 #else
-      R12, R13, R14, R15, RSI, RDI,
-      R8,  R9,  R10, R11, RCX
+      R12, R13, RSI, RDI, R8,  R9,
+      R10, R11, R14, R15, RCX
 #endif
   };
   return allocation_order;
 }
 
+X64Reg GPRRegCache::GetPinnedXReg(preg_t preg) const
+{
+  // These have to be callee-saved, so that they survive the function calls of block exits.
+  switch (preg)
+  {
+  case 1:  // Stack pointer
+    return R15;
+  case 13:  // Small data area pointer
+    return R14;
+  default:
+    return INVALID_REG;
+  }
+}
+
+BitSet32 GPRRegCache::GetPinnedRegisters()
+{
+  return BitSet32{1, 13};
+}
+
+void GPRRegCache::LoadPinnedRegisters(BitSet32 pregs)
+{
+  for (preg_t preg : pregs)
+    m_emitter->MOV(32, ::Gen::R(GetPinnedXReg(preg)), GetDefaultLocation(preg));
+}
+
+void GPRRegCache::SetPinnedRegistersLoaded(BitSet32 pregs)
+{
+  for (preg_t preg : pregs)
+  {
+    const X64Reg xr = GetPinnedXReg(preg);
+    ASSERT(m_xregs[xr].IsFree() && !m_regs[preg].IsInHostRegister());
+    m_xregs[xr].SetBoundTo(preg);
+    m_regs[preg].SetInHostRegister(xr, false);
+  }
+}
+
 void GPRRegCache::SetImmediate32(preg_t preg, u32 imm_value, bool dirty)
 {
   // "dirty" can be false to avoid redundantly flushing an immediate when
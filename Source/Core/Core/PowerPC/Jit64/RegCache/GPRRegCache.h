@@ -18,6 +18,14 @@ public:
 
   void SetImmediate32(preg_t preg, u32 imm_value, bool dirty = true);
 
+  // Linked blocks pass the values of these guest registers to each other in fixed host registers,
+  // in addition to storing them in ppcState. These are base registers which most blocks use.
+  static BitSet32 GetPinnedRegisters();
+  // Loads pregs into their pinned host registers without changing the state of the cache.
+  void LoadPinnedRegisters(BitSet32 pregs);
+  // Marks pregs as being loaded into their pinned host registers, like at the start of a block.
+  void SetPinnedRegistersLoaded(BitSet32 pregs);
+
 protected:
   Gen::OpArg R(preg_t preg) const override;
   Gen::OpArg GetDefaultLocation(preg_t preg) const override;
@@ -26,6 +34,7 @@ protected:
   void LoadRegister(preg_t preg, Gen::X64Reg new_loc) override;
   void DiscardImm(preg_t preg) override;
   std::span<const Gen::X64Reg> GetAllocationOrder() const override;
+  Gen::X64Reg GetPinnedXReg(preg_t preg) const override;
   BitSet32 GetRegUtilization() const override;
   BitSet32 CountRegsIn(preg_t preg, u32 lookahead) const override;
 };
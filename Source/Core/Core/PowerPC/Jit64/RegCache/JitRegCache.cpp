@@ -228,6 +228,7 @@ void RCForkGuard::EndFork()
   ASSERT(!rc->IsAnyConstraintActive());
   rc->m_regs = m_regs;
   rc->m_xregs = m_xregs;
+  rc->m_pinned_at_flush = {};
   rc = nullptr;
 }
 
@@ -237,6 +238,7 @@ RegCache::RegCache(Jit64& jit) : m_jit{jit}
 
 void RegCache::Start()
 {
+  m_pinned_at_flush = {};
   m_xregs.fill({});
   for (size_t i = 0; i < m_regs.size(); i++)
   {
@@ -305,6 +307,7 @@ RCX64Reg RegCache::Scratch()
 
 RCX64Reg RegCache::Scratch(X64Reg xr)
 {
+  m_pinned_at_flush = {};
   FlushX(xr);
   return RCX64Reg{this, xr};
 }
@@ -335,6 +338,7 @@ void RegCache::Flush(BitSet32 pregs, IgnoreDiscardedRegisters ignore_discarded_r
   ASSERT_MSG(DYNA_REC, std::ranges::none_of(m_xregs, &X64CachedReg::IsLocked),
              "Someone forgot to unlock a X64 reg");
 
+  m_pinned_at_flush = {};
   for (preg_t i : pregs)
   {
     ASSERT_MSG(DYNA_REC, !m_regs[i].IsLocked(), "Someone forgot to unlock PPC reg {} (X64 reg {}).",
@@ -342,6 +346,10 @@ void RegCache::Flush(BitSet32 pregs, IgnoreDiscardedRegisters ignore_discarded_r
     ASSERT_MSG(DYNA_REC, !m_regs[i].IsRevertable(), "Register transaction is in progress for {}!",
                i);
 
+    // Flushing doesn't change the contents of the host register.
+    if (m_regs[i].IsInHostRegister() && m_regs[i].GetHostRegister() == GetPinnedXReg(i))
+      m_pinned_at_flush[i] = true;
+
     StoreFromRegister(i, FlushMode::Full, ignore_discarded_registers);
   }
 }
@@ -417,6 +425,8 @@ void RegCache::FlushX(X64Reg reg)
 
 void RegCache::DiscardRegister(preg_t preg)
 {
+  m_pinned_at_flush = {};
+
   if (m_regs[preg].IsInHostRegister())
   {
     X64Reg xr = m_regs[preg].GetHostRegister();
@@ -428,9 +438,13 @@ void RegCache::DiscardRegister(preg_t preg)
 
 void RegCache::BindToRegister(preg_t i, bool doLoad, bool makeDirty)
 {
+  m_pinned_at_flush = {};
+
   if (!m_regs[i].IsInHostRegister())
   {
-    X64Reg xr = GetFreeXReg();
+    X64Reg xr = GetPinnedXReg(i);
+    if (xr == INVALID_REG || !m_xregs[xr].IsFree())
+      xr = GetFreeXReg();
 
     ASSERT_MSG(DYNA_REC, !m_xregs[xr].IsLocked(), "GetFreeXReg returned locked register");
     ASSERT_MSG(DYNA_REC, !m_regs[i].IsRevertable(), "Invalid transaction state");
@@ -603,6 +617,8 @@ void RegCache::Realize(preg_t preg)
   if (m_constraints[preg].IsRealized())
     return;
 
+  m_pinned_at_flush = {};
+
   const bool load = m_constraints[preg].ShouldLoad();
   const bool dirty = m_constraints[preg].ShouldDirty();
   const bool kill_imm = m_constraints[preg].ShouldKillImmediate();
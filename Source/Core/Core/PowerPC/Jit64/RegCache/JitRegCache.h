@@ -186,6 +186,10 @@ public:
   void PreloadRegisters(BitSet32 pregs);
   BitSet32 RegistersInUse() const;
 
+  // Returns the registers which were still in their pinned host registers when they were flushed
+  // by the last flush. Anything which changes the register cache after that flush clears this.
+  BitSet32 GetPinnedRegistersAtFlush() const { return m_pinned_at_flush; }
+
 protected:
   friend class RCOpArg;
   friend class RCX64Reg;
@@ -198,6 +202,8 @@ protected:
   virtual void DiscardImm(preg_t preg) = 0;
 
   virtual std::span<const Gen::X64Reg> GetAllocationOrder() const = 0;
+  // Returns the host register which linked blocks pass preg in, or INVALID_REG.
+  virtual Gen::X64Reg GetPinnedXReg(preg_t preg) const = 0;
 
   virtual BitSet32 GetRegUtilization() const = 0;
   virtual BitSet32 CountRegsIn(preg_t preg, u32 lookahead) const = 0;
@@ -231,4 +237,5 @@ protected:
   std::array<X64CachedReg, NUM_XREGS> m_xregs;
   std::array<RCConstraint, 32> m_constraints;
   Gen::XEmitter* m_emitter = nullptr;
+  BitSet32 m_pinned_at_flush;
 };
@@ -14,7 +14,13 @@ JitBlockCache::JitBlockCache(JitBase& jit) : JitBaseBlockCache{jit}
 void JitBlockCache::WriteLinkBlock(const JitBlock::LinkData& source, const JitBlock* dest)
 {
   u8* location = source.exitPtrs;
-  const u8* address = dest ? dest->normalEntry : m_jit.GetAsmRoutines()->dispatcher_no_timing_check;
+  const u8* address = m_jit.GetAsmRoutines()->dispatcher_no_timing_check;
+  if (dest)
+  {
+    // Skip loading the pinned registers of the destination if this exit already has them loaded.
+    const bool has_pinned_gprs = (dest->pinned_gprs & ~source.pinned_gprs) == BitSet32{};
+    address = has_pinned_gprs ? dest->pinned_entry : dest->normalEntry;
+  }
   if (source.call)
   {
     Gen::XEmitter emit(location, location + 5);
@@ -45,9 +51,16 @@ void JitBlockCache::WriteLinkBlock(const JitBlock::LinkData& source, const JitBl
 
 void JitBlockCache::WriteDestroyBlock(const JitBlock& block)
 {
-  // Only clear the entry point as we might still be within this block.
+  // Only clear the entry points as we might still be within this block.
   Gen::XEmitter emit(block.normalEntry, block.normalEntry + 1);
   emit.INT3();
+
+  // Linked blocks may enter after the pinned registers are loaded.
+  if (block.pinned_entry && block.pinned_entry != block.normalEntry)
+  {
+    Gen::XEmitter pinned_emit(block.pinned_entry, block.pinned_entry + 1);
+    pinned_emit.INT3();
+  }
 }
 
 void JitBlockCache::Init()
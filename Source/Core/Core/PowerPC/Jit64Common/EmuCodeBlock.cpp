@@ -3,6 +3,7 @@
 
 #include "Core/PowerPC/Jit64Common/EmuCodeBlock.h"
 
+#include <array>
 #include <functional>
 
 #include "Common/Assert.h"
@@ -137,6 +138,60 @@ FixupBranch EmuCodeBlock::CheckIfSafeAddress(const OpArg& reg_value, X64Reg reg_
   return J_CC(CC_Z, m_far_code.Enabled() ? Jump::Near : Jump::Short);
 }
 
+template <typename EmitAccess>
+FixupBranch EmuCodeBlock::FastTLBAccess(X64Reg reg_addr, int access_size, bool write,
+                                        BitSet32 registers_in_use, BitSet32 reserved_regs,
+                                        EmitAccess emit_access)
+{
+  // Get ourselves two registers which don't hold the address or the value to write
+  reserved_regs[reg_addr] = true;
+  std::array<X64Reg, 2> tmp{};
+  size_t tmp_count = 0;
+  for (const X64Reg reg : {RSCRATCH, RSCRATCH2, RSCRATCH_EXTRA, R11})
+  {
+    if (tmp_count < tmp.size() && !reserved_regs[reg])
+      tmp[tmp_count++] = reg;
+  }
+  const X64Reg host = tmp[0];
+  const X64Reg last_page = tmp[1];
+
+  if (registers_in_use[host])
+    PUSH(host);
+  if (registers_in_use[last_page])
+    PUSH(last_page);
+  const auto pop_registers = [&] {
+    if (registers_in_use[last_page])
+      POP(last_page);
+    if (registers_in_use[host])
+      POP(host);
+  };
+
+  // The entry of a page can't have the tag of the next page, so comparing against the page of the
+  // last byte also makes accesses which cross into the next page miss.
+  static_assert(sizeof(PowerPC::FastTLBEntry) == 16);
+  const int entry_offset = PPCSTATE_OFF(fast_tlb);
+  const int tag_offset = static_cast<int>(write ? offsetof(PowerPC::FastTLBEntry, write_tag) :
+                                                  offsetof(PowerPC::FastTLBEntry, read_tag));
+  LEA(32, last_page, MDisp(reg_addr, access_size / 8 - 1));
+  SHR(32, R(last_page), Imm8(PowerPC::HW_PAGE_INDEX_SHIFT));
+  MOV(32, R(host), R(reg_addr));
+  SHR(32, R(host), Imm8(PowerPC::HW_PAGE_INDEX_SHIFT - 4));
+  AND(32, R(host), Imm32(PowerPC::HW_PAGE_INDEX_MASK << 4));
+  CMP(32, R(last_page), MComplex(RPPCSTATE, host, SCALE_1, entry_offset + tag_offset));
+  FixupBranch miss = J_CC(CC_NE);
+
+  MOV(64, R(host),
+      MComplex(RPPCSTATE, host, SCALE_1,
+               entry_offset + static_cast<int>(offsetof(PowerPC::FastTLBEntry, host_offset))));
+  emit_access(MRegSum(host, reg_addr));
+  pop_registers();
+  FixupBranch hit = J(Jump::Near);
+
+  SetJumpTarget(miss);
+  pop_registers();
+  return hit;
+}
+
 void EmuCodeBlock::UnsafeWriteRegToReg(OpArg reg_value, X64Reg reg_addr, int accessSize, s32 offset,
                                        bool swap, MovInfo* info)
 {
@@ -392,6 +447,18 @@ void EmuCodeBlock::SafeLoadToReg(X64Reg reg_value, const Gen::OpArg& opAddress,
     SetJumpTarget(slow);
   }
 
+  // Page table translations are slow and can't always be covered by fastmem mappings.
+  FixupBranch fast_tlb_hit;
+  const bool use_fast_tlb =
+      dr_set && m_jit.m_system.IsMMUMode() && !m_jit.m_ppc_state.m_enable_dcache;
+  if (use_fast_tlb)
+  {
+    fast_tlb_hit = FastTLBAccess(reg_addr, accessSize, false, registersInUse, {},
+                                 [&](const OpArg& host_address) {
+                                   LoadAndSwap(accessSize, reg_value, host_address, signExtend);
+                                 });
+  }
+
   // In the case of Jit64AsmCommon routines, the state we want to store here isn't known
   // when compiling the routine, so the caller has to store it themselves.
   if (!(flags & SAFE_LOADSTORE_NO_UPDATE_PC))
@@ -438,6 +505,8 @@ void EmuCodeBlock::SafeLoadToReg(X64Reg reg_value, const Gen::OpArg& opAddress,
     }
     SetJumpTarget(exit);
   }
+  if (use_fast_tlb)
+    SetJumpTarget(fast_tlb_hit);
 }
 
 void EmuCodeBlock::SafeLoadToRegImmediate(X64Reg reg_value, u32 address, int accessSize,
@@ -562,6 +631,34 @@ void EmuCodeBlock::SafeWriteRegToReg(OpArg reg_value, X64Reg reg_addr, int acces
     SetJumpTarget(slow);
   }
 
+  // Page table translations are slow and can't always be covered by fastmem mappings.
+  FixupBranch fast_tlb_hit;
+  const bool use_fast_tlb =
+      dr_set && m_jit.m_system.IsMMUMode() && !m_jit.m_ppc_state.m_enable_dcache;
+  if (use_fast_tlb)
+  {
+    BitSet32 reserved_regs;
+    if (reg_value.IsSimpleReg())
+      reserved_regs[reg_value.GetSimpleReg()] = true;
+    fast_tlb_hit = FastTLBAccess(reg_addr, accessSize, true, registersInUse, reserved_regs,
+                                 [&](const OpArg& host_address) {
+                                   if (reg_value.IsImm())
+                                   {
+                                     MOV(accessSize, host_address,
+                                         swap ? SwapImmediate(accessSize, reg_value) : reg_value);
+                                   }
+                                   else if (swap)
+                                   {
+                                     SwapAndStore(accessSize, host_address,
+                                                  reg_value.GetSimpleReg());
+                                   }
+                                   else
+                                   {
+                                     MOV(accessSize, host_address, reg_value);
+                                   }
+                                 });
+  }
+
   // In the case of Jit64AsmCommon routines, the state we want to store here isn't known
   // when compiling the routine, so the caller has to store it themselves.
   if (!(flags & SAFE_LOADSTORE_NO_UPDATE_PC))
@@ -615,6 +712,8 @@ void EmuCodeBlock::SafeWriteRegToReg(OpArg reg_value, X64Reg reg_addr, int acces
     }
     SetJumpTarget(exit);
   }
+  if (use_fast_tlb)
+    SetJumpTarget(fast_tlb_hit);
 }
 
 void EmuCodeBlock::SafeWriteRegToReg(Gen::X64Reg reg_value, Gen::X64Reg reg_addr, int accessSize,
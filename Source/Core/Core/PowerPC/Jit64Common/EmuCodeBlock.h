@@ -57,6 +57,14 @@ public:
 
   Gen::FixupBranch CheckIfSafeAddress(const Gen::OpArg& reg_value, Gen::X64Reg reg_addr,
                                       BitSet32 registers_in_use);
+
+  // Looks up reg_addr in the fast TLB (see PowerPC::FastTLBEntry) and on a hit, calls
+  // emit_access with the host address to access. Returns the branch taken after the access.
+  // Misses fall through with all registers in registers_in_use and reserved_regs preserved.
+  template <typename EmitAccess>
+  Gen::FixupBranch FastTLBAccess(Gen::X64Reg reg_addr, int access_size, bool write,
+                                 BitSet32 registers_in_use, BitSet32 reserved_regs,
+                                 EmitAccess emit_access);
   // these return the address of the MOV, for backpatching
   void UnsafeWriteRegToReg(Gen::OpArg reg_value, Gen::X64Reg reg_addr, int accessSize,
                            s32 offset = 0, bool swap = true, Gen::MovInfo* info = nullptr);
@@ -78,7 +86,7 @@ public:
     // This indicates that the write being generated cannot be patched (and thus can't use fastmem)
     SAFE_LOADSTORE_NO_FASTMEM = 4,
     SAFE_LOADSTORE_CLOBBER_RSCRATCH_INSTEAD_OF_ADDR = 8,
-    // Always call into C++ (used when generating fallbacks in trampolines)
+    // Skip the inline fastmem check (used when generating fallbacks in trampolines)
     SAFE_LOADSTORE_FORCE_SLOW_ACCESS = 16,
     SAFE_LOADSTORE_DR_ON = 32,
     // Generated from a context that doesn't have the PC of the instruction that caused it
@@ -114,9 +114,10 @@ JitBase::~JitBase()
 
 bool JitBase::DoesConfigNeedRefresh() const
 {
-  return std::ranges::any_of(JIT_SETTINGS, [this](const auto& pair) {
-    return this->*pair.first != Config::Get(*pair.second);
-  });
+  return m_compile_threshold != std::max(Config::Get(Config::MAIN_JIT_COMPILE_THRESHOLD), 0) ||
+         std::ranges::any_of(JIT_SETTINGS, [this](const auto& pair) {
+           return this->*pair.first != Config::Get(*pair.second);
+         });
 }
 
 void JitBase::RefreshConfig()
@@ -125,6 +126,7 @@ void JitBase::RefreshConfig()
 
   for (const auto& [member, config_info] : JIT_SETTINGS)
     this->*member = Config::Get(*config_info);
+  m_compile_threshold = std::max(Config::Get(Config::MAIN_JIT_COMPILE_THRESHOLD), 0);
 
   if (m_accurate_cpu_cache_enabled)
   {
@@ -153,6 +155,17 @@ void JitBase::RefreshConfig()
   }
 }
 
+bool JitBase::PrecompileBlock(u32 em_address)
+{
+  m_precompiling = true;
+  analyzer.SetPeekInstructionsEnabled(true);
+  Jit(em_address);
+  analyzer.SetPeekInstructionsEnabled(false);
+  m_precompiling = false;
+
+  return !code_block.m_memory_exception;
+}
+
 bool JitBase::WantsPageTableMappings() const
 {
   return jo.fastmem;
@@ -161,6 +161,11 @@ protected:
   bool m_accurate_fmadds = false;
   bool m_fastmem_enabled = false;
   bool m_accurate_cpu_cache_enabled = false;
+  // How many times a block is interpreted before it gets compiled. Only used by Jit64.
+  int m_compile_threshold = 0;
+
+  // Set by PrecompileBlock, in which case Jit() must not raise exceptions.
+  bool m_precompiling = false;
 
   bool m_enable_blr_optimization = false;
   bool m_cleanup_after_stackfault = false;
@@ -206,6 +211,10 @@ public:
 
   virtual void Jit(u32 em_address) = 0;
 
+  // Compiles the block at em_address ahead of time. Unlike Jit(), this leaves the emulated state
+  // as it is, and returns false instead of raising an ISI if the code can't be read.
+  bool PrecompileBlock(u32 em_address);
+
   virtual void EraseSingleBlock(const JitBlock& block) = 0;
 
   // Memory region name, free size, and fragmentation ratio
@@ -0,0 +1,192 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/PowerPC/JitCommon/JitBlockDiskCache.h"
+
+#include <chrono>
+#include <utility>
+
+#include "Common/FileUtil.h"
+#include "Common/Hash.h"
+#include "Common/Logging/Log.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/ConfigManager.h"
+#include "Core/Movie.h"
+#include "Core/NetPlayProto.h"
+#include "Core/PowerPC/JitCommon/JitBase.h"
+#include "Core/PowerPC/JitCommon/JitCache.h"
+#include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+
+// Limits on the work done by a single call to PrecompileBlocks, which happens once per frame.
+static constexpr auto PRECOMPILE_TIME_BUDGET = std::chrono::milliseconds(1);
+static constexpr size_t MAX_ENTRIES_CHECKED_PER_PRECOMPILE = 1024;
+// How many times the code of an entry may be found missing before the entry is dropped.
+static constexpr u32 MAX_FAILED_CHECKS = 256;
+
+class JitBlockDiskCache::Reader final : public Common::LinearDiskCacheReader<Key, u32>
+{
+public:
+  explicit Reader(JitBlockDiskCache& cache) : m_cache(cache) {}
+
+  void Read(const Key& key, const u32* value, u32 value_size) override
+  {
+    if (value_size == 0 || value_size % 2 != 0 || !m_cache.m_known_keys.insert(key).second)
+      return;
+
+    m_cache.m_pending_entries.push_back({key, std::vector<u32>(value, value + value_size)});
+  }
+
+private:
+  JitBlockDiskCache& m_cache;
+};
+
+JitBlockDiskCache::JitBlockDiskCache(JitBase& jit) : m_jit(jit)
+{
+}
+
+JitBlockDiskCache::~JitBlockDiskCache()
+{
+  Close();
+}
+
+void JitBlockDiskCache::Update()
+{
+  std::string game_id;
+  if (Config::Get(Config::MAIN_JIT_BLOCK_DISK_CACHE))
+    game_id = SConfig::GetInstance().GetGameID();
+
+  if (game_id == m_game_id)
+    return;
+
+  Close();
+  m_game_id = std::move(game_id);
+  if (m_game_id.empty() || m_game_id == "00000000")
+    return;
+
+  const std::string filename = File::GetUserPath(D_CACHE_IDX) + m_game_id + ".jitblocks";
+  Reader reader(*this);
+  const u32 entry_count = m_disk_cache.OpenAndRead(filename, reader);
+  m_is_open = true;
+
+  INFO_LOG_FMT(DYNA_REC, "Loaded {} of {} blocks from {}", m_pending_entries.size(), entry_count,
+               filename);
+}
+
+void JitBlockDiskCache::Close()
+{
+  if (m_is_open)
+  {
+    m_disk_cache.Sync();
+    m_disk_cache.Close();
+    m_is_open = false;
+  }
+
+  m_game_id.clear();
+  m_known_keys.clear();
+  m_pending_entries.clear();
+  m_next_pending_entry = 0;
+}
+
+void JitBlockDiskCache::RecordBlock(const JitBlock& block,
+                                    const PPCAnalyst::CodeBuffer& code_buffer)
+{
+  // Blocks compiled while debugging may be cut short, e.g. for single stepping.
+  if (!m_is_open || m_jit.IsDebuggingEnabled())
+    return;
+
+  m_record_buffer.clear();
+  for (u32 i = 0; i < block.originalSize; ++i)
+  {
+    m_record_buffer.push_back(code_buffer[i].address);
+    m_record_buffer.push_back(code_buffer[i].inst.hex);
+  }
+
+  const u32 size = static_cast<u32>(m_record_buffer.size());
+  const Key key{block.effectiveAddress, static_cast<u32>(block.feature_flags),
+                Common::GetHash64(reinterpret_cast<const u8*>(m_record_buffer.data()),
+                                  size * sizeof(u32), 0)};
+  if (!m_known_keys.insert(key).second)
+    return;
+
+  m_disk_cache.Append(key, m_record_buffer.data(), size);
+}
+
+bool JitBlockDiskCache::IsCodePresent(const Entry& entry) const
+{
+  PowerPC::MMU& mmu = m_jit.m_mmu;
+  for (size_t i = 0; i < entry.instructions.size(); i += 2)
+  {
+    const PowerPC::TryReadInstResult result = mmu.TryPeekInstruction(entry.instructions[i]);
+    if (!result.valid || result.hex != entry.instructions[i + 1])
+      return false;
+  }
+
+  return true;
+}
+
+void JitBlockDiskCache::PrecompileBlocks()
+{
+  Update();
+
+  if (m_pending_entries.empty() || m_jit.IsDebuggingEnabled())
+    return;
+
+  // Compiling ahead of time doesn't change the emulated state, but the JIT and the interpreter
+  // aren't guaranteed to behave exactly alike, and a precompiled block is never interpreted (see
+  // MAIN_JIT_COMPILE_THRESHOLD). Movies and netplay need every user to run the same code.
+  Core::System& system = m_jit.m_system;
+  if (system.GetMovie().IsMovieActive() || NetPlay::IsNetPlayRunning())
+    return;
+
+  JitBaseBlockCache& block_cache = *m_jit.GetBlockCache();
+  const CPUEmuFeatureFlags feature_flags = m_jit.m_ppc_state.feature_flags;
+  const auto start_time = std::chrono::steady_clock::now();
+
+  for (size_t i = 0; i < MAX_ENTRIES_CHECKED_PER_PRECOMPILE && !m_pending_entries.empty(); ++i)
+  {
+    if (std::chrono::steady_clock::now() - start_time >= PRECOMPILE_TIME_BUDGET)
+      return;
+
+    if (m_next_pending_entry >= m_pending_entries.size())
+      m_next_pending_entry = 0;
+
+    Entry& entry = m_pending_entries[m_next_pending_entry];
+    if (entry.key.feature_flags != static_cast<u32>(feature_flags))
+    {
+      ++m_next_pending_entry;
+      continue;
+    }
+
+    // Code which isn't loaded yet may still be loaded later, but not every entry is worth checking
+    // over and over again for the rest of the session.
+    const bool present = IsCodePresent(entry);
+    if (!present && ++entry.failed_checks < MAX_FAILED_CHECKS)
+    {
+      ++m_next_pending_entry;
+      continue;
+    }
+
+    const u32 address = entry.key.effective_address;
+    if (&entry != &m_pending_entries.back())
+      entry = std::move(m_pending_entries.back());
+    m_pending_entries.pop_back();
+
+    if (!present || block_cache.GetBlockFromStartAddress(address, feature_flags))
+      continue;
+
+    const size_t block_count = block_cache.GetBlockCount();
+    if (!m_jit.PrecompileBlock(address))
+      continue;
+
+    if (block_cache.GetBlockCount() <= block_count)
+    {
+      // The JIT ran out of space and cleared its cache. Compiling any more blocks ahead of time
+      // would only push out the blocks that are actually being run.
+      WARN_LOG_FMT(DYNA_REC, "JIT cache is full, not compiling any more blocks ahead of time");
+      m_pending_entries.clear();
+      return;
+    }
+  }
+}
@@ -0,0 +1,77 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <compare>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/LinearDiskCache.h"
+#include "Core/PowerPC/PPCAnalyst.h"
+
+class JitBase;
+struct JitBlock;
+
+// Remembers the blocks that were compiled while running a game, so that the next session of that
+// game can compile them ahead of time instead of stalling the first time each of them runs.
+//
+// For every block, the cache stores the address and contents of all instructions the analyzer
+// put into it, including the targets of followed branches. A block is only compiled ahead of time
+// if all of these instructions are present in memory again. The analysis itself is not reused:
+// compiling the block re-runs it on the current memory contents, so a stale entry can only waste
+// time, never produce wrong code.
+class JitBlockDiskCache final
+{
+public:
+  explicit JitBlockDiskCache(JitBase& jit);
+  ~JitBlockDiskCache();
+
+  // Opens the cache of the running game if the cache is enabled, closing the previous one if the
+  // game or the setting changed.
+  void Update();
+  void Close();
+
+  void RecordBlock(const JitBlock& block, const PPCAnalyst::CodeBuffer& code_buffer);
+
+  // Compiles blocks from previous sessions whose code has been loaded. Must be called on the CPU
+  // thread while no JIT code is running, and only does a bounded amount of work per call.
+  void PrecompileBlocks();
+
+private:
+  struct Key
+  {
+    u32 effective_address;
+    u32 feature_flags;
+    // Hash of the instructions (addresses and contents) of the block.
+    u64 code_hash;
+
+    auto operator<=>(const Key&) const = default;
+  };
+
+  struct Entry
+  {
+    Key key;
+    // Pairs of instruction addresses and instructions.
+    std::vector<u32> instructions;
+    u32 failed_checks = 0;
+  };
+
+  class Reader;
+
+  bool IsCodePresent(const Entry& entry) const;
+
+  JitBase& m_jit;
+
+  Common::LinearDiskCache<Key, u32> m_disk_cache;
+  std::string m_game_id;
+  bool m_is_open = false;
+
+  std::set<Key> m_known_keys;
+  std::vector<Entry> m_pending_entries;
+  size_t m_next_pending_entry = 0;
+
+  std::vector<u32> m_record_buffer;
+};
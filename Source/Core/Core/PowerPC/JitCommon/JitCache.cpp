@@ -8,6 +8,7 @@
 #include <cstring>
 #include <functional>
 #include <map>
+#include <optional>
 #include <ranges>
 #include <set>
 #include <span>
@@ -47,7 +48,191 @@ void JitBlock::ProfileData::EndProfiling(ProfileData* data, u32 downcount_amount
   data->time_spent += Clock::now() - data->time_start;
 }
 
-JitBaseBlockCache::JitBaseBlockCache(JitBase& jit) : m_jit{jit}
+void JitBlockLinkMap::Insert(u32 address, JitBlock* block)
+{
+  size_t slot = FindSlot(address);
+  if (slot == INVALID_INDEX)
+  {
+    if ((m_used_slot_count + 1) * 4 > m_slots.size() * 3)
+      Grow();
+
+    slot = GetIdealSlot(address);
+    while (m_slots[slot].head != INVALID_INDEX)
+      slot = (slot + 1) & (m_slots.size() - 1);
+
+    m_slots[slot] = {address, AllocateNode(block, INVALID_INDEX)};
+    ++m_used_slot_count;
+    return;
+  }
+
+  for (u32 node = m_slots[slot].head; node != INVALID_INDEX; node = m_nodes[node].next)
+  {
+    if (m_nodes[node].block == block)
+      return;
+  }
+  m_slots[slot].head = AllocateNode(block, m_slots[slot].head);
+}
+
+void JitBlockLinkMap::Erase(u32 address, JitBlock* block)
+{
+  const size_t slot = FindSlot(address);
+  if (slot == INVALID_INDEX)
+    return;
+
+  u32* link = &m_slots[slot].head;
+  while (*link != INVALID_INDEX && m_nodes[*link].block != block)
+    link = &m_nodes[*link].next;
+  if (*link == INVALID_INDEX)
+    return;
+
+  const u32 node = *link;
+  *link = m_nodes[node].next;
+  FreeNode(node);
+
+  if (m_slots[slot].head == INVALID_INDEX)
+    EraseSlot(slot);
+}
+
+void JitBlockLinkMap::Clear()
+{
+  m_slots.clear();
+  m_slot_count_log2 = 0;
+  m_used_slot_count = 0;
+  m_nodes.clear();
+  m_first_free_node = INVALID_INDEX;
+}
+
+size_t JitBlockLinkMap::GetIdealSlot(u32 address) const
+{
+  // Fibonacci hashing. Block addresses are word aligned, so the low bits carry no information and
+  // have to be mixed into the high bits which are used as the index.
+  return static_cast<u32>(address * 0x9E3779B9u) >> (32 - m_slot_count_log2);
+}
+
+size_t JitBlockLinkMap::FindSlot(u32 address) const
+{
+  if (m_used_slot_count == 0)
+    return INVALID_INDEX;
+
+  for (size_t slot = GetIdealSlot(address); m_slots[slot].head != INVALID_INDEX;
+       slot = (slot + 1) & (m_slots.size() - 1))
+  {
+    if (m_slots[slot].address == address)
+      return slot;
+  }
+  return INVALID_INDEX;
+}
+
+void JitBlockLinkMap::EraseSlot(size_t slot)
+{
+  // Backward shift deletion: move later entries of the same probe sequence into the hole, so that
+  // lookups never need tombstones.
+  const size_t mask = m_slots.size() - 1;
+  size_t hole = slot;
+  for (size_t i = (hole + 1) & mask; m_slots[i].head != INVALID_INDEX; i = (i + 1) & mask)
+  {
+    const size_t ideal = GetIdealSlot(m_slots[i].address);
+    if (((i - ideal) & mask) >= ((i - hole) & mask))
+    {
+      m_slots[hole] = m_slots[i];
+      hole = i;
+    }
+  }
+  m_slots[hole].head = INVALID_INDEX;
+  --m_used_slot_count;
+}
+
+void JitBlockLinkMap::Grow()
+{
+  std::vector<Slot> old_slots = std::move(m_slots);
+  m_slot_count_log2 = std::max(m_slot_count_log2 + 1, MIN_SLOT_COUNT_LOG2);
+  m_slots.assign(size_t(1) << m_slot_count_log2, Slot{});
+
+  for (const Slot& old_slot : old_slots)
+  {
+    if (old_slot.head == INVALID_INDEX)
+      continue;
+
+    size_t slot = GetIdealSlot(old_slot.address);
+    while (m_slots[slot].head != INVALID_INDEX)
+      slot = (slot + 1) & (m_slots.size() - 1);
+    m_slots[slot] = old_slot;
+  }
+}
+
+u32 JitBlockLinkMap::AllocateNode(JitBlock* block, u32 next)
+{
+  if (m_first_free_node == INVALID_INDEX)
+  {
+    m_nodes.push_back({block, next});
+    return static_cast<u32>(m_nodes.size() - 1);
+  }
+
+  const u32 node = m_first_free_node;
+  m_first_free_node = m_nodes[node].next;
+  m_nodes[node] = {block, next};
+  return node;
+}
+
+void JitBlockLinkMap::FreeNode(u32 node)
+{
+  m_nodes[node] = {nullptr, m_first_free_node};
+  m_first_free_node = node;
+}
+
+JitBlockRangeMap::JitBlockRangeMap() : m_pages(PAGE_COUNT)
+{
+}
+
+void JitBlockRangeMap::Insert(u32 range_index, JitBlock* block)
+{
+  std::unique_ptr<Page>& page = m_pages[range_index >> RANGES_PER_PAGE_SHIFT];
+  if (!page)
+    page = std::make_unique<Page>();
+
+  (*page)[range_index & (RANGES_PER_PAGE - 1)].push_back(block);
+}
+
+void JitBlockRangeMap::Erase(u32 range_index, JitBlock* block)
+{
+  Page* page = m_pages[range_index >> RANGES_PER_PAGE_SHIFT].get();
+  if (!page)
+    return;
+
+  // The order of the blocks doesn't matter, so swap the block with the last one and pop it.
+  std::vector<JitBlock*>& blocks = (*page)[range_index & (RANGES_PER_PAGE - 1)];
+  const auto it = std::ranges::find(blocks, block);
+  if (it == blocks.end())
+    return;
+
+  *it = blocks.back();
+  blocks.pop_back();
+}
+
+void JitBlockRangeMap::Clear()
+{
+  for (std::unique_ptr<Page>& page : m_pages)
+    page.reset();
+}
+
+// Calls the callback once for every range which contains any of the block's instructions.
+template <typename Callback>
+static void ForEachBlockRange(const JitBlock& block, Callback callback)
+{
+  // physical_addresses is sorted, so the instructions in the same range are next to each other.
+  std::optional<u32> previous_range_index;
+  for (const u32 addr : block.physical_addresses)
+  {
+    const u32 range_index = JitBlockRangeMap::GetRangeIndex(addr);
+    if (range_index == previous_range_index)
+      continue;
+
+    callback(range_index);
+    previous_range_index = range_index;
+  }
+}
+
+JitBaseBlockCache::JitBaseBlockCache(JitBase& jit) : m_jit{jit}, m_disk_cache{jit}
 {
 }
 
@@ -63,6 +248,8 @@ void JitBaseBlockCache::Init()
     m_entry_points_ptr = static_cast<u8**>(m_entry_points_arena.Create(FAST_BLOCK_MAP_SIZE));
 #endif
 
+  m_disk_cache.Update();
+
   Clear();
 }
 
@@ -70,6 +257,7 @@ void JitBaseBlockCache::Shutdown()
 {
   Common::JitRegister::Shutdown();
 
+  m_disk_cache.Close();
   m_entry_points_arena.Release();
 }
 
@@ -88,8 +276,8 @@ void JitBaseBlockCache::Clear()
     DestroyBlock(e.second);
   }
   block_map.clear();
-  links_to.clear();
-  block_range_map.clear();
+  links_to.Clear();
+  block_range_map.Clear();
 
   valid_block.ClearAll();
 
@@ -172,21 +360,21 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
   }
 
   for (u32 addr : block.physical_addresses)
-  {
     valid_block.Set(addr / 32);
-    block_range_map[addr & BLOCK_RANGE_MAP_MASK].insert(&block);
-  }
+  ForEachBlockRange(block, [&](u32 range_index) { block_range_map.Insert(range_index, &block); });
 
   if (block_link)
   {
     for (const auto& e : block.linkData)
     {
-      links_to[e.exitAddress].insert(&block);
+      links_to.Insert(e.exitAddress, &block);
     }
 
     LinkBlock(block);
   }
 
+  m_disk_cache.RecordBlock(block, code_buffer);
+
   const Common::Symbol* symbol = nullptr;
   if (Common::JitRegister::IsEnabled() &&
       (symbol = m_jit.m_ppc_symbol_db.GetSymbolFromAddr(block.effectiveAddress)) != nullptr)
@@ -263,6 +451,11 @@ const u8* JitBaseBlockCache::Dispatch()
   return block->normalEntry;
 }
 
+void JitBaseBlockCache::PrecompileCachedBlocks()
+{
+  m_disk_cache.PrecompileBlocks();
+}
+
 void JitBaseBlockCache::InvalidateICacheLine(u32 address)
 {
   const u32 cache_line_address = address & ~0x1f;
@@ -348,50 +541,43 @@ void JitBaseBlockCache::InvalidateICacheInternal(u32 physical_address, u32 addre
 
 void JitBaseBlockCache::ErasePhysicalRange(u32 address, u32 length)
 {
+  if (length == 0)
+    return;
+
   // Iterate over all macro blocks which overlap the given range.
-  auto start = block_range_map.lower_bound(address & BLOCK_RANGE_MAP_MASK);
-  auto end = block_range_map.lower_bound(address + length);
-  while (start != end)
-  {
-    // Iterate over all blocks in the macro block.
-    auto iter = start->second.begin();
-    while (iter != start->second.end())
-    {
-      JitBlock* block = *iter;
-      if (block->OverlapsPhysicalRange(address, length))
-      {
-        // If the block overlaps, also remove all other occupied slots in the other macro blocks.
-        // This will leak empty macro blocks, but they may be reused or cleared later on.
-        for (u32 addr : block->physical_addresses)
-          if ((addr & BLOCK_RANGE_MAP_MASK) != start->first)
-            block_range_map[addr & BLOCK_RANGE_MAP_MASK].erase(block);
-
-        // And remove the block.
-        DestroyBlock(*block);
-        auto block_map_iter = block_map.equal_range(block->physicalAddress);
-        while (block_map_iter.first != block_map_iter.second)
+  const u32 last_address = static_cast<u32>(std::min<u64>(u64(address) + length - 1, 0xFFFFFFFF));
+  block_range_map.ForEachRange(
+      JitBlockRangeMap::GetRangeIndex(address), JitBlockRangeMap::GetRangeIndex(last_address),
+      [&](std::vector<JitBlock*>& blocks) {
+        // Iterate over all blocks in the macro block.
+        size_t i = 0;
+        while (i < blocks.size())
         {
-          if (&block_map_iter.first->second == block)
+          JitBlock* block = blocks[i];
+          if (!block->OverlapsPhysicalRange(address, length))
           {
-            block_map.erase(block_map_iter.first);
-            break;
+            ++i;
+            continue;
           }
-          block_map_iter.first++;
-        }
-        iter = start->second.erase(iter);
-      }
-      else
-      {
-        iter++;
-      }
-    }
 
-    // If the macro block is empty, drop it.
-    if (start->second.empty())
-      start = block_range_map.erase(start);
-    else
-      start++;
-  }
+          // If the block overlaps, remove it from all macro blocks. This moves another block into
+          // the current slot, so i is not incremented.
+          EraseBlockFromRanges(*block);
+
+          // And remove the block.
+          DestroyBlock(*block);
+          auto block_map_iter = block_map.equal_range(block->physicalAddress);
+          while (block_map_iter.first != block_map_iter.second)
+          {
+            if (&block_map_iter.first->second == block)
+            {
+              block_map.erase(block_map_iter.first);
+              break;
+            }
+            block_map_iter.first++;
+          }
+        }
+      });
 }
 
 void JitBaseBlockCache::EraseSingleBlock(const JitBlock& block)
@@ -404,13 +590,17 @@ void JitBaseBlockCache::EraseSingleBlock(const JitBlock& block)
 
   JitBlock& mutable_block = block_map_iter->second;
 
-  for (const u32 addr : mutable_block.physical_addresses)
-    block_range_map[addr & BLOCK_RANGE_MAP_MASK].erase(&mutable_block);
+  EraseBlockFromRanges(mutable_block);
 
   DestroyBlock(mutable_block);
   block_map.erase(block_map_iter);  // The original JitBlock reference is now dangling.
 }
 
+void JitBaseBlockCache::EraseBlockFromRanges(JitBlock& block)
+{
+  ForEachBlockRange(block, [&](u32 range_index) { block_range_map.Erase(range_index, &block); });
+}
+
 u32* JitBaseBlockCache::GetBlockBitSet() const
 {
   return valid_block.m_valid_block.get();
@@ -445,15 +635,10 @@ void JitBaseBlockCache::LinkBlockExits(JitBlock& block)
 void JitBaseBlockCache::LinkBlock(JitBlock& block)
 {
   LinkBlockExits(block);
-  const auto it = links_to.find(block.effectiveAddress);
-  if (it == links_to.end())
-    return;
-
-  for (JitBlock* b2 : it->second)
-  {
+  links_to.ForEachSource(block.effectiveAddress, [&](JitBlock* b2) {
     if (block.feature_flags == b2->feature_flags)
       LinkBlockExits(*b2);
-  }
+  });
 }
 
 void JitBaseBlockCache::UnlinkBlock(const JitBlock& block)
@@ -465,13 +650,9 @@ void JitBaseBlockCache::UnlinkBlock(const JitBlock& block)
   }
 
   // Unlink all exits of other blocks which points to this block
-  const auto it = links_to.find(block.effectiveAddress);
-  if (it == links_to.end())
-    return;
-  for (JitBlock* sourceBlock : it->second)
-  {
+  links_to.ForEachSource(block.effectiveAddress, [&](JitBlock* sourceBlock) {
     if (sourceBlock->feature_flags != block.feature_flags)
-      continue;
+      return;
 
     for (auto& e : sourceBlock->linkData)
     {
@@ -481,7 +662,7 @@ void JitBaseBlockCache::UnlinkBlock(const JitBlock& block)
         e.linkStatus = false;
       }
     }
-  }
+  });
 }
 
 void JitBaseBlockCache::DestroyBlock(JitBlock& block)
@@ -505,14 +686,7 @@ void JitBaseBlockCache::DestroyBlock(JitBlock& block)
 
   // Delete linking addresses
   for (const auto& e : block.linkData)
-  {
-    auto it = links_to.find(e.exitAddress);
-    if (it == links_to.end())
-      continue;
-    it->second.erase(&block);
-    if (it->second.empty())
-      links_to.erase(it);
-  }
+    links_to.Erase(e.exitAddress, &block);
 
   // Raise an signal if we are going to call this block again
   WriteDestroyBlock(block);
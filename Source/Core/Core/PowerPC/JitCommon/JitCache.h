@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <bitset>
 #include <chrono>
@@ -12,13 +13,13 @@
 #include <memory>
 #include <set>
 #include <type_traits>
-#include <unordered_map>
-#include <unordered_set>
 #include <vector>
 
+#include "Common/BitSet.h"
 #include "Common/CommonTypes.h"
 #include "Core/HW/Memmap.h"
 #include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/JitCommon/JitBlockDiskCache.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 
 class JitBase;
@@ -97,9 +98,16 @@ struct JitBlock : public JitBlockData
     u32 exitAddress;
     bool linkStatus;  // is it already linked?
     bool call;
+    // Guest GPRs which are in their pinned host registers at this exit (Jit64 only).
+    BitSet32 pinned_gprs;
   };
   std::vector<LinkData> linkData;
 
+  // Entry point for linked blocks which skips loading pinned_gprs into their pinned host
+  // registers. It may only be used by exits which have all of these loaded (Jit64 only).
+  u8* pinned_entry = nullptr;
+  BitSet32 pinned_gprs;
+
   // This set stores all physical addresses of all occupied instructions.
   std::set<u32> physical_addresses;
 
@@ -142,6 +150,118 @@ public:
   bool Test(u32 bit) const { return (m_valid_block[bit / 32] & (1u << (bit % 32))) != 0; }
 };
 
+// Maps the exit addresses of blocks to the blocks which exit to them. This is used to (un)link
+// blocks whose destination gets compiled or destroyed.
+//
+// The addresses are kept in an open addressing hash table, and each of them refers to a linked list
+// of blocks whose nodes all live in one arena. Once the arena and the table have grown large
+// enough, adding and removing links doesn't allocate anything.
+class JitBlockLinkMap final
+{
+public:
+  // Adding a link which already exists does nothing.
+  void Insert(u32 address, JitBlock* block);
+  void Erase(u32 address, JitBlock* block);
+  void Clear();
+
+  // The callback must not modify the map.
+  template <typename Callback>
+  void ForEachSource(u32 address, Callback callback) const
+  {
+    const size_t slot = FindSlot(address);
+    if (slot == INVALID_INDEX)
+      return;
+
+    for (u32 node = m_slots[slot].head; node != INVALID_INDEX; node = m_nodes[node].next)
+      callback(m_nodes[node].block);
+  }
+
+private:
+  static constexpr u32 INVALID_INDEX = 0xFFFFFFFF;
+  static constexpr u32 MIN_SLOT_COUNT_LOG2 = 10;
+
+  struct Slot
+  {
+    u32 address;
+    // Index of the first node in m_nodes, or INVALID_INDEX if the slot is empty.
+    u32 head = INVALID_INDEX;
+  };
+
+  struct Node
+  {
+    JitBlock* block;
+    // Index of the next node of the same list, or of the next free node.
+    u32 next;
+  };
+
+  size_t GetIdealSlot(u32 address) const;
+  size_t FindSlot(u32 address) const;
+  void EraseSlot(size_t slot);
+  void Grow();
+  u32 AllocateNode(JitBlock* block, u32 next);
+  void FreeNode(u32 node);
+
+  std::vector<Slot> m_slots;
+  u32 m_slot_count_log2 = 0;
+  size_t m_used_slot_count = 0;
+
+  std::vector<Node> m_nodes;
+  u32 m_first_free_node = INVALID_INDEX;
+};
+
+// Lists the blocks which overlap each BLOCK_RANGE_SIZE bytes of physical memory. This is used for
+// invalidation of memory regions.
+//
+// The lists are grouped in pages which are allocated when the first block in them is added, so
+// finding the blocks in a range is only a couple of array lookups, and untouched parts of the
+// address space cost nearly nothing.
+class JitBlockRangeMap final
+{
+public:
+  static constexpr u32 BLOCK_RANGE_SHIFT = 8;
+  static constexpr u32 BLOCK_RANGE_SIZE = 1u << BLOCK_RANGE_SHIFT;
+
+  JitBlockRangeMap();
+
+  static u32 GetRangeIndex(u32 physical_address) { return physical_address >> BLOCK_RANGE_SHIFT; }
+
+  // Adding a block to a range which already contains it is not allowed.
+  void Insert(u32 range_index, JitBlock* block);
+  void Erase(u32 range_index, JitBlock* block);
+  void Clear();
+
+  // Calls the callback with the list of blocks of every non-empty range from first_range_index to
+  // last_range_index (inclusive). The callback may erase blocks from any range.
+  template <typename Callback>
+  void ForEachRange(u32 first_range_index, u32 last_range_index, Callback callback)
+  {
+    u32 range_index = first_range_index;
+    while (range_index <= last_range_index)
+    {
+      const u32 last_in_page = std::min(range_index | (RANGES_PER_PAGE - 1), last_range_index);
+      if (Page* page = m_pages[range_index >> RANGES_PER_PAGE_SHIFT].get())
+      {
+        for (u32 i = range_index; i <= last_in_page; ++i)
+        {
+          std::vector<JitBlock*>& blocks = (*page)[i & (RANGES_PER_PAGE - 1)];
+          if (!blocks.empty())
+            callback(blocks);
+        }
+      }
+      range_index = last_in_page + 1;
+    }
+  }
+
+private:
+  static constexpr u32 RANGES_PER_PAGE_SHIFT = 10;
+  static constexpr u32 RANGES_PER_PAGE = 1u << RANGES_PER_PAGE_SHIFT;
+  static constexpr u32 PAGE_COUNT = (1ull << 32) >> (BLOCK_RANGE_SHIFT + RANGES_PER_PAGE_SHIFT);
+
+  using Page = std::array<std::vector<JitBlock*>, RANGES_PER_PAGE>;
+
+  std::vector<std::unique_ptr<Page>> m_pages;
+};
+
 class JitBaseBlockCache
 {
 public:
@@ -181,6 +301,9 @@ public:
   // assembly version.)
   const u8* Dispatch();
 
+  // Compiles some of the blocks that were compiled in previous sessions of the running game.
+  void PrecompileCachedBlocks();
+
   void InvalidateICache(u32 address, u32 length, bool forced);
   void InvalidateICacheLine(u32 address);
   void ErasePhysicalRange(u32 address, u32 length);
@@ -201,6 +324,7 @@ private:
   void LinkBlock(JitBlock& block);
   void UnlinkBlock(const JitBlock& block);
   void InvalidateICacheInternal(u32 physical_address, u32 address, u32 length, bool forced);
+  void EraseBlockFromRanges(JitBlock& block);
 
   JitBlock* MoveBlockIntoFastCache(u32 em_address, CPUEmuFeatureFlags feature_flags);
 
@@ -209,7 +333,7 @@ private:
 
   // links_to hold all exit points of all valid blocks in a reverse way.
   // It is used to query all blocks which links to an address.
-  std::unordered_map<u32, std::unordered_set<JitBlock*>> links_to;  // destination_PC -> number
+  JitBlockLinkMap links_to;  // destination_PC -> blocks
 
   // Map indexed by the physical address of the entry point.
   // This is used to query the block based on the current PC in a slow way.
@@ -218,8 +342,7 @@ private:
   // Range of overlapping code indexed by a masked physical address.
   // This is used for invalidation of memory regions. The range is grouped
   // in macro blocks of each 0x100 bytes.
-  static constexpr u32 BLOCK_RANGE_MAP_MASK = ~(0x100 - 1);
-  std::map<u32, std::unordered_set<JitBlock*>> block_range_map;
+  JitBlockRangeMap block_range_map;
 
   // This bitsets shows which cachelines overlap with any blocks.
   // It is used to provide a fast way to query if no icache invalidation is needed.
@@ -235,4 +358,6 @@ private:
   // in case the shm memory region couldn't be allocated.
   std::array<JitBlock*, FAST_BLOCK_MAP_FALLBACK_ELEMENTS>
       m_fast_block_map_fallback{};  // start_addr & mask -> number
+
+  JitBlockDiskCache m_disk_cache;
 };
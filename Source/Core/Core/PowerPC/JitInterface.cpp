@@ -296,6 +296,12 @@ void JitInterface::InvalidateICacheLines(u32 address, u32 count)
     InvalidateICache(address & ~0x1f, 32 * count, false);
 }
 
+void JitInterface::PrecompileCachedBlocks()
+{
+  if (m_jit)
+    m_jit->GetBlockCache()->PrecompileCachedBlocks();
+}
+
 void JitInterface::InvalidateICacheLineFromJIT(JitInterface& jit_interface, u32 address)
 {
   jit_interface.InvalidateICacheLine(address);
@@ -89,6 +89,10 @@ public:
   static void InvalidateICacheLineFromJIT(JitInterface& jit_interface, u32 address);
   static void InvalidateICacheLinesFromJIT(JitInterface& jit_interface, u32 address, u32 count);
 
+  // Compiles some of the blocks that the JIT block disk cache knows from previous sessions.
+  // Must be called on the CPU thread, outside of JIT code.
+  void PrecompileCachedBlocks();
+
   enum class ExceptionType
   {
     FIFOWrite,
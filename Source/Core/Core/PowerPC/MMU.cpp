@@ -547,6 +547,31 @@ TryReadInstResult MMU::TryReadInstruction(u32 address)
   return TryReadInstResult{true, from_bat, hex, address};
 }
 
+TryReadInstResult MMU::TryPeekInstruction(u32 address)
+{
+  bool from_bat = true;
+  if (m_ppc_state.msr.IR)
+  {
+    auto tlb_addr = TranslateAddress<XCheckTLBFlag::OpcodeNoException>(address);
+    if (!tlb_addr.Success())
+      return TryReadInstResult{false, false, 0, 0};
+
+    address = tlb_addr.address;
+    from_bat = tlb_addr.result == TranslateAddressResultEnum::BAT_TRANSLATED;
+  }
+
+  // Reading anything but RAM would show an alert.
+  if (!IsPhysicalRAMAddress(address))
+    return TryReadInstResult{false, false, 0, 0};
+
+  u32 hex;
+  if (m_memory.GetFakeVMEM() && ((address & 0xFE000000) == 0x7E000000))
+    hex = Common::swap32(&m_memory.GetFakeVMEM()[address & m_memory.GetFakeVMemMask()]);
+  else
+    hex = m_ppc_state.iCache.PeekInstruction(m_memory, m_ppc_state, address);
+  return TryReadInstResult{true, from_bat, hex, address};
+}
+
 u32 MMU::HostRead_Instruction(const Core::CPUThreadGuard& guard, const u32 address)
 {
   return guard.GetSystem().GetMMU().ReadFromHardware<XCheckTLBFlag::OpcodeNoException, u32>(
@@ -1263,11 +1288,15 @@ void MMU::SDRUpdated()
   m_ppc_state.pagetable_base = htaborg << 16;
   m_ppc_state.pagetable_mask = (htabmask << 16) | 0xffc0;
 
+  InvalidateFastTLB();
   PageTableUpdated();
 }
 
 void MMU::SRUpdated()
 {
+  // The fast TLB is indexed by effective address, so it doesn't know about VSIDs.
+  InvalidateFastTLB();
+
   // Our incremental handling of page table updates can't handle SR changing, so throw away all
   // existing mappings and then reparse the whole page table.
   m_memory.RemoveAllPageTableMappings();
@@ -1361,6 +1390,7 @@ void MMU::InvalidateTLBEntry(u32 address)
 
   m_ppc_state.tlb[PowerPC::DATA_TLB_INDEX][entry_index].Invalidate();
   m_ppc_state.tlb[PowerPC::INST_TLB_INDEX][entry_index].Invalidate();
+  m_ppc_state.fast_tlb[entry_index].Invalidate();
 
   if (m_ppc_state.msr.DR)
     PageTableUpdated();
@@ -1987,6 +2017,10 @@ void MMU::UpdateFakeMMUBat(BatTable& bat_table, u32 start_addr)
 
 void MMU::DBATUpdated()
 {
+  // BATs take priority over the TLB, and the fast TLB must not contain pages with memchecks.
+  // This also takes care of savestates and resets, which both update the BATs.
+  InvalidateFastTLB();
+
   m_dbat_table = {};
   UpdateBATs(m_dbat_table, SPR_DBAT0U);
   bool extended_bats = m_system.IsWii() && HID4(m_ppc_state).SBE;
@@ -2041,7 +2075,64 @@ MMU::TranslateAddressResult MMU::TranslateAddress(u32 address)
   if (TranslateBatAddress(IsOpcodeFlag(flag) ? m_ibat_table : m_dbat_table, &address, &wi))
     return TranslateAddressResult{TranslateAddressResultEnum::BAT_TRANSLATED, address, wi};
 
-  return TranslatePageAddress<flag>(EffectiveAddress{address}, &wi);
+  const TranslateAddressResult result = TranslatePageAddress<flag>(EffectiveAddress{address}, &wi);
+
+  // Anything but a hit in the most recently used way may have changed the TLB set.
+  if constexpr (flag == XCheckTLBFlag::Read || flag == XCheckTLBFlag::Write)
+    UpdateFastTLBEntry(address);
+
+  return result;
+}
+
+void MMU::UpdateFastTLBEntry(u32 address)
+{
+  const u32 tag = address >> HW_PAGE_INDEX_SHIFT;
+  FastTLBEntry& entry = m_ppc_state.fast_tlb[tag & HW_PAGE_INDEX_MASK];
+  entry.Invalidate();
+
+  // Only the most recently used way can be copied, as a hit in the other way would change which
+  // one is the most recently used.
+  const TLBEntry& tlbe = m_ppc_state.tlb[PowerPC::DATA_TLB_INDEX][tag & HW_PAGE_INDEX_MASK];
+  const u32 way = tlbe.recent;
+  if (tlbe.tag[way] != tag || tlbe.vsid[way] != UReg_SR{m_ppc_state.sr[address >> 28]}.VSID)
+    return;
+
+  // Write-through and cache-inhibited pages have special behavior for some writes.
+  const UPTE_Hi pte2(tlbe.pte[way]);
+  if ((pte2.WIMG & 0b1100) != 0)
+    return;
+
+  const u32 page_address = tag << HW_PAGE_INDEX_SHIFT;
+  if (m_power_pc.GetMemChecks().OverlapsMemcheck(page_address, HW_PAGE_SIZE))
+    return;
+
+  // Only RAM can be accessed directly.
+  const u32 physical_address = tlbe.paddr[way];
+  u8* host_page;
+  if (m_memory.GetRAM() && (physical_address & 0xF8000000) == 0x00000000)
+  {
+    host_page = &m_memory.GetRAM()[physical_address & m_memory.GetRamMask()];
+  }
+  else if (m_memory.GetEXRAM() && (physical_address >> 28) == 0x1 &&
+           (physical_address & 0x0FFFFFFF) < m_memory.GetExRamSizeReal())
+  {
+    host_page = &m_memory.GetEXRAM()[physical_address & 0x0FFFFFFF];
+  }
+  else
+  {
+    return;
+  }
+
+  entry.host_offset = reinterpret_cast<uintptr_t>(host_page) - page_address;
+  entry.read_tag = tag;
+  if (pte2.C)
+    entry.write_tag = tag;
+}
+
+void MMU::InvalidateFastTLB()
+{
+  for (FastTLBEntry& entry : m_ppc_state.fast_tlb)
+    entry.Invalidate();
 }
 
 std::optional<u32> MMU::GetTranslatedAddress(u32 address)
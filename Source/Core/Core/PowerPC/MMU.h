@@ -226,6 +226,9 @@ public:
   // Used by interpreter to read instructions, uses iCache
   u32 Read_Opcode(u32 address);
   TryReadInstResult TryReadInstruction(u32 address);
+  // Same as TryReadInstruction, but leaves the TLB, the page table and the instruction cache as
+  // they are. Used for compiling code ahead of time.
+  TryReadInstResult TryPeekInstruction(u32 address);
 
   template <std::unsigned_integral T>
   T Read(const u32 address);
@@ -330,6 +333,9 @@ private:
   template <const XCheckTLBFlag flag>
   TranslateAddressResult TranslatePageAddress(const EffectiveAddress address, bool* wi);
 
+  void UpdateFastTLBEntry(u32 address);
+  void InvalidateFastTLB();
+
   void GenerateDSIException(u32 effective_address, bool write);
   void GenerateISIException(u32 effective_address);
 
@@ -215,6 +215,15 @@ static u32 GetSPRIndex(UGeckoInstruction inst)
   return (inst.SPRU << 5) | (inst.SPRL & 0x1F);
 }
 
+// Uses the static branch prediction of the processor: backward branches (which are usually loops)
+// are predicted taken and forward branches not taken. Compilers set the y bit of BO to reverse
+// this for branches which they expect to go the other way.
+static bool IsBranchPredictedTaken(UGeckoInstruction inst)
+{
+  const bool backward = SignExt16(inst.BD << 2) < 0;
+  return backward != ((inst.BO & 1) != 0);
+}
+
 static bool InstructionCanEndBlock(const CodeOp& op)
 {
   return (op.opinfo->flags & FL_ENDBLOCK) &&
@@ -831,7 +840,8 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
   auto& mmu = system.GetMMU();
   for (std::size_t i = 0; i < block_size; ++i)
   {
-    auto result = mmu.TryReadInstruction(address);
+    auto result =
+        m_peek_instructions ? mmu.TryPeekInstruction(address) : mmu.TryReadInstruction(address);
     if (!result.valid)
     {
       if (i == 0)
@@ -857,6 +867,8 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
 
     bool conditional_continue = false;
 
+    bool conditional_follow = false;
+
     // TODO: Find the optimal value for BRANCH_FOLLOWING_THRESHOLD.
     //       If it is small, the performance will be down.
     //       If it is big, the size of generated code will be big and
@@ -918,6 +930,12 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
       {
         // bcx with conditional branch
         conditional_continue = true;
+
+        // Branches back to the start of the block are loops, which block linking already
+        // handles. Following them would only unroll the loop once.
+        conditional_follow = enable_follow && HasOption(OPTION_CONDITIONAL_BRANCH_FOLLOW) &&
+                             !m_is_debugging_enabled && !inst.LK && block_size > 1 &&
+                             code[i].branchTo != block->m_address && IsBranchPredictedTaken(inst);
       }
       else if (inst.OPCD == 19 && inst.SUBOP10 == 16 &&
                ((inst.BO & BO_DONT_DECREMENT_FLAG) == 0 ||
@@ -948,6 +966,15 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
       numFollows++;
       address = code[i].branchTo;
     }
+    else if (conditional_follow && numFollows < BRANCH_FOLLOWING_THRESHOLD)
+    {
+      // Follow the predicted path of the conditional branch. The JIT exits the block if the
+      // branch isn't taken.
+      numFollows++;
+      code[i].branchIsFollowed = true;
+      address = code[i].branchTo;
+      found_call = false;
+    }
     else
     {
       // Just pick the next instruction
@@ -40,6 +40,7 @@ struct CodeOp  // 16B
   BitSet8 crOut;
   bool branchUsesCtr = false;
   bool branchIsIdleLoop = false;
+  bool branchIsFollowed = false;  // conditional branch whose target continues the block
   BitSet8 wantsCR;
   bool wantsFPRF = false;
   bool wantsCA = false;
@@ -171,6 +172,11 @@ public:
 
     // Reorder cror instructions next to their associated fcmp.
     OPTION_CROR_MERGE = (1 << 6),
+
+    // Continue the block at the target of conditional branches which are predicted to be taken,
+    // turning the not taken path into the side exit. Requires OPTION_CONDITIONAL_CONTINUE and
+    // JIT support to be enabled.
+    OPTION_CONDITIONAL_BRANCH_FOLLOW = (1 << 7),
   };
 
   // Option setting/getting
@@ -181,6 +187,8 @@ public:
   void SetBranchFollowingEnabled(bool enabled) { m_enable_branch_following = enabled; }
   void SetFloatExceptionsEnabled(bool enabled) { m_enable_float_exceptions = enabled; }
   void SetDivByZeroExceptionsEnabled(bool enabled) { m_enable_div_by_zero_exceptions = enabled; }
+  // Reads the code with MMU::TryPeekInstruction, so that analyzing doesn't change the state.
+  void SetPeekInstructionsEnabled(bool enabled) { m_peek_instructions = enabled; }
   u32 Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, std::size_t block_size) const;
 
 private:
@@ -205,6 +213,7 @@ private:
   bool m_enable_branch_following = false;
   bool m_enable_float_exceptions = false;
   bool m_enable_div_by_zero_exceptions = false;
+  bool m_peek_instructions = false;
 };
 
 void FindFunctions(const Core::CPUThreadGuard& guard, u32 startAddr, u32 endAddr,
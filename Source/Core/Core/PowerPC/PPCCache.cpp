@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstring>
 
 #include "Common/ChunkFile.h"
 #include "Common/Swap.h"
@@ -205,24 +206,20 @@ void Cache::Touch(Memory::MemoryManager& memory, u32 addr, bool store)
   GetCache(memory, addr, false);
 }
 
+u32 Cache::LookupWay(const Memory::MemoryManager& memory, u32 addr) const
+{
+  if (addr & CACHE_VMEM_BIT)
+    return lookup_table_vmem[(addr & memory.GetFakeVMemMask()) >> 5];
+  if (addr & CACHE_EXRAM_BIT)
+    return lookup_table_ex[(addr & memory.GetExRamMask()) >> 5];
+  return lookup_table[(addr & memory.GetRamMask()) >> 5];
+}
+
 std::pair<u32, u32> Cache::GetCache(Memory::MemoryManager& memory, u32 addr, bool locked)
 {
   addr &= ~31;
   u32 set = (addr >> 5) & 0x7f;
-  u32 way;
-
-  if (addr & CACHE_VMEM_BIT)
-  {
-    way = lookup_table_vmem[(addr & memory.GetFakeVMemMask()) >> 5];
-  }
-  else if (addr & CACHE_EXRAM_BIT)
-  {
-    way = lookup_table_ex[(addr & memory.GetExRamMask()) >> 5];
-  }
-  else
-  {
-    way = lookup_table[(addr & memory.GetRamMask()) >> 5];
-  }
+  u32 way = LookupWay(memory, addr);
 
   // load to the cache
   if (!locked && way == 0xff)
@@ -385,6 +382,21 @@ u32 InstructionCache::ReadInstruction(Memory::MemoryManager& memory,
   return Common::swap32(value);
 }
 
+u32 InstructionCache::PeekInstruction(const Memory::MemoryManager& memory,
+                                      const PowerPC::PowerPCState& ppc_state, u32 addr) const
+{
+  // A miss loads the block from memory, so only a hit can return something else.
+  const u32 way = !HID0(ppc_state).ICE || m_disable_icache ? 0xff : LookupWay(memory, addr & ~31);
+  if (way == 0xff)
+    return memory.Read_U32(addr);
+
+  const u32 set = (addr >> 5) & 0x7f;
+  u32 value;
+  std::memcpy(&value, reinterpret_cast<const u8*>(data[set][way].data()) + (addr & 31),
+              sizeof(value));
+  return Common::swap32(value);
+}
+
 void InstructionCache::Invalidate(Memory::MemoryManager& memory, JitInterface& jit_interface,
                                   u32 addr)
 {
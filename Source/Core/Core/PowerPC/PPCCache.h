@@ -67,6 +67,10 @@ struct Cache
   void Reset();
 
   void DoState(Memory::MemoryManager& memory, PointerWrap& p);
+
+protected:
+  // Returns the way holding the 32-byte aligned addr, or 0xff if it isn't in the cache.
+  u32 LookupWay(const Memory::MemoryManager& memory, u32 addr) const;
 };
 
 struct InstructionCache : public Cache
@@ -78,6 +82,9 @@ struct InstructionCache : public Cache
   InstructionCache() = default;
   ~InstructionCache();
   u32 ReadInstruction(Memory::MemoryManager& memory, PowerPC::PowerPCState& ppc_state, u32 addr);
+  // Returns the same as ReadInstruction, but without loading the block into the cache.
+  u32 PeekInstruction(const Memory::MemoryManager& memory, const PowerPC::PowerPCState& ppc_state,
+                      u32 addr) const;
   void Invalidate(Memory::MemoryManager& memory, JitInterface& jit_interface, u32 addr);
   void Init(Memory::MemoryManager& memory);
   void Reset(JitInterface& jit_interface);
@@ -68,6 +68,27 @@ struct TLBEntry
   void Invalidate() { tag.fill(INVALID_TAG); }
 };
 
+// A copy of the most recently used way of a data TLB set, which the JIT looks up inline to access
+// RAM without calling into the MMU. Since a hit in that way doesn't change the state of the TLB,
+// using this has no side effects that a full translation would have.
+struct FastTLBEntry
+{
+  static constexpr u32 INVALID_TAG = 0xffffffff;
+
+  // Effective page number (address >> HW_PAGE_INDEX_SHIFT) this entry is valid for.
+  u32 read_tag = INVALID_TAG;
+  // Only set if the page's changed bit is already set, as the first write has to set it.
+  u32 write_tag = INVALID_TAG;
+  // Host pointer to the page minus its effective address.
+  uintptr_t host_offset = 0;
+
+  void Invalidate()
+  {
+    read_tag = INVALID_TAG;
+    write_tag = INVALID_TAG;
+  }
+};
+
 struct PairedSingle
 {
   u64 PS0AsU64() const { return ps0; }
@@ -188,6 +209,8 @@ struct PowerPCState
   u32 pagetable_mask = 0;
 
   std::array<std::array<TLBEntry, TLB_SIZE / TLB_WAYS>, NUM_TLBS> tlb;
+  // Not saved in savestates; rebuilt from tlb as addresses get translated.
+  std::array<FastTLBEntry, TLB_SIZE / TLB_WAYS> fast_tlb;
 
   InstructionCache iCache;
   Cache dCache;
@@ -0,0 +1,222 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/RewindBuffer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace State
+{
+// A new keyframe is created once the deltas depending on the current keyframe take up more than
+// 1/KEYFRAME_DELTA_RATIO of the keyframe's size. The same ratio is used to decide whether a single
+// delta is worth storing at all.
+constexpr size_t KEYFRAME_DELTA_RATIO = 2;
+
+RewindBuffer::RewindBuffer(size_t memory_budget) : m_memory_budget(memory_budget)
+{
+}
+
+void RewindBuffer::SetMemoryBudget(size_t memory_budget)
+{
+  m_memory_budget = memory_budget;
+  EnforceMemoryBudget();
+}
+
+size_t RewindBuffer::Entry::GetMemoryUsage() const
+{
+  const size_t keyframe_size = is_keyframe ? keyframe->size() : 0;
+  return keyframe_size + pages.size() * sizeof(u32) + page_data.size();
+}
+
+// Appends the indices and contents of the pages of state which differ from base.
+static void FindChangedPages(std::span<const u8> base, std::span<const u8> state,
+                             std::vector<u32>* pages, std::vector<u8>* page_data)
+{
+  constexpr size_t PAGE_SIZE = RewindBuffer::PAGE_SIZE;
+
+  for (size_t offset = 0; offset < state.size(); offset += PAGE_SIZE)
+  {
+    const size_t page_size = std::min(PAGE_SIZE, state.size() - offset);
+    const u8* page = state.data() + offset;
+
+    const bool is_in_base = offset + page_size <= base.size();
+    if (is_in_base && std::memcmp(page, base.data() + offset, page_size) == 0)
+      continue;
+
+    pages->push_back(static_cast<u32>(offset / PAGE_SIZE));
+    page_data->insert(page_data->end(), page, page + page_size);
+  }
+}
+
+// Reconstructs a state of the given size from base and the pages found by FindChangedPages.
+// Returns false if the pages don't fit the state.
+static bool ApplyChangedPages(std::span<const u8> base, u64 size, std::span<const u32> pages,
+                              std::span<const u8> page_data, Common::UniqueBuffer<u8>& state)
+{
+  constexpr size_t PAGE_SIZE = RewindBuffer::PAGE_SIZE;
+
+  state.reset(size);
+  std::copy_n(base.data(), std::min<size_t>(base.size(), size), state.data());
+
+  size_t data_offset = 0;
+  for (const u32 page : pages)
+  {
+    const size_t offset = size_t(page) * PAGE_SIZE;
+    if (offset >= size)
+      return false;
+
+    const size_t page_size = std::min<size_t>(PAGE_SIZE, size - offset);
+    if (page_data.size() - data_offset < page_size)
+      return false;
+
+    std::copy_n(page_data.data() + data_offset, page_size, state.data() + offset);
+    data_offset += page_size;
+  }
+
+  return data_offset == page_data.size();
+}
+
+RewindBuffer::Entry RewindBuffer::CreateDelta(std::shared_ptr<const Keyframe> keyframe,
+                                              std::span<const u8> state) const
+{
+  Entry entry{.keyframe = std::move(keyframe), .size = state.size()};
+  const std::span<const u8> base(entry.keyframe->data(), entry.keyframe->size());
+  FindChangedPages(base, state, &entry.pages, &entry.page_data);
+  return entry;
+}
+
+void RewindBuffer::Push(std::span<const u8> state)
+{
+  const bool needs_keyframe =
+      m_entries.empty() ||
+      m_delta_usage_since_keyframe * KEYFRAME_DELTA_RATIO > m_entries.back().keyframe->size();
+
+  if (!needs_keyframe)
+  {
+    Entry entry = CreateDelta(m_entries.back().keyframe, state);
+
+    // If nearly everything changed, storing the delta would only waste memory.
+    if (entry.page_data.size() * KEYFRAME_DELTA_RATIO <= state.size())
+    {
+      m_delta_usage_since_keyframe += entry.GetMemoryUsage();
+      m_memory_usage += entry.GetMemoryUsage();
+      m_entries.push_back(std::move(entry));
+      EnforceMemoryBudget();
+      return;
+    }
+  }
+
+  auto keyframe = std::make_shared<Keyframe>(state.size());
+  std::ranges::copy(state, keyframe->data());
+
+  Entry entry{.keyframe = std::move(keyframe), .is_keyframe = true, .size = state.size()};
+  m_delta_usage_since_keyframe = 0;
+  m_memory_usage += entry.GetMemoryUsage();
+  m_entries.push_back(std::move(entry));
+  EnforceMemoryBudget();
+}
+
+bool RewindBuffer::Pop(Common::UniqueBuffer<u8>& state)
+{
+  if (m_entries.empty())
+    return false;
+
+  Entry entry = std::move(m_entries.back());
+  m_entries.pop_back();
+  m_memory_usage -= entry.GetMemoryUsage();
+
+  if (entry.is_keyframe)
+  {
+    // Deltas are always pushed after their keyframe, so nothing else refers to it anymore.
+    m_delta_usage_since_keyframe = 0;
+    for (auto it = m_entries.rbegin(); it != m_entries.rend() && !it->is_keyframe; ++it)
+      m_delta_usage_since_keyframe += it->GetMemoryUsage();
+  }
+  else
+  {
+    m_delta_usage_since_keyframe -= entry.GetMemoryUsage();
+  }
+
+  const Keyframe& keyframe = *entry.keyframe;
+  return ApplyChangedPages(std::span(keyframe.data(), keyframe.size()), entry.size, entry.pages,
+                           entry.page_data, state);
+}
+
+void RewindBuffer::Clear()
+{
+  m_entries.clear();
+  m_memory_usage = 0;
+  m_delta_usage_since_keyframe = 0;
+}
+
+// Delta layout: u64 state size, u32 page count, u32 page indices[page count], page data.
+std::vector<u8> RewindBuffer::EncodeDelta(std::span<const u8> base, std::span<const u8> state)
+{
+  std::vector<u32> pages;
+  std::vector<u8> page_data;
+  FindChangedPages(base, state, &pages, &page_data);
+
+  const u64 size = state.size();
+  const u32 page_count = static_cast<u32>(pages.size());
+
+  std::vector<u8> delta(sizeof(size) + sizeof(page_count) + pages.size() * sizeof(u32) +
+                        page_data.size());
+  u8* ptr = delta.data();
+  std::memcpy(ptr, &size, sizeof(size));
+  ptr += sizeof(size);
+  std::memcpy(ptr, &page_count, sizeof(page_count));
+  ptr += sizeof(page_count);
+  std::memcpy(ptr, pages.data(), pages.size() * sizeof(u32));
+  ptr += pages.size() * sizeof(u32);
+  std::ranges::copy(page_data, ptr);
+
+  return delta;
+}
+
+bool RewindBuffer::ApplyDelta(std::span<const u8> base, std::span<const u8> delta,
+                              Common::UniqueBuffer<u8>& state)
+{
+  u64 size;
+  u32 page_count;
+  if (delta.size() < sizeof(size) + sizeof(page_count))
+    return false;
+
+  std::memcpy(&size, delta.data(), sizeof(size));
+  std::memcpy(&page_count, delta.data() + sizeof(size), sizeof(page_count));
+  delta = delta.subspan(sizeof(size) + sizeof(page_count));
+
+  if (delta.size() / sizeof(u32) < page_count)
+    return false;
+
+  std::vector<u32> pages(page_count);
+  std::memcpy(pages.data(), delta.data(), pages.size() * sizeof(u32));
+  delta = delta.subspan(pages.size() * sizeof(u32));
+
+  // Everything beyond the base must come from the delta. This also bounds the allocation size.
+  if (size > delta.size() + base.size())
+    return false;
+
+  return ApplyChangedPages(base, size, pages, delta, state);
+}
+
+void RewindBuffer::EnforceMemoryBudget()
+{
+  if (m_memory_budget == 0)
+    return;
+
+  while (m_memory_usage > m_memory_budget)
+  {
+    // Find the end of the oldest keyframe's group. Always keep the most recent group.
+    const auto group_end = std::find_if(m_entries.begin() + 1, m_entries.end(),
+                                        [](const Entry& entry) { return entry.is_keyframe; });
+    if (group_end == m_entries.end())
+      return;
+
+    for (auto it = m_entries.begin(); it != group_end; ++it)
+      m_memory_usage -= it->GetMemoryUsage();
+    m_entries.erase(m_entries.begin(), group_end);
+  }
+}
+}  // namespace State
@@ -0,0 +1,79 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "Common/Buffer.h"
+#include "Common/CommonTypes.h"
+
+namespace State
+{
+// Keeps a history of savestate buffers within a fixed memory budget, for rewinding.
+//
+// Most states are stored as deltas which only contain the pages that differ from the most recent
+// keyframe (a full copy of a state). Once the deltas grow too large compared to their keyframe,
+// the next state becomes a new keyframe. When the memory budget is exceeded, the oldest keyframe
+// is dropped together with all deltas that depend on it.
+class RewindBuffer
+{
+public:
+  static constexpr size_t PAGE_SIZE = 0x1000;
+
+  explicit RewindBuffer(size_t memory_budget = 0);
+
+  // Setting a budget of 0 removes all limits.
+  void SetMemoryBudget(size_t memory_budget);
+  size_t GetMemoryBudget() const { return m_memory_budget; }
+  size_t GetMemoryUsage() const { return m_memory_usage; }
+
+  size_t GetEntryCount() const { return m_entries.size(); }
+  bool IsEmpty() const { return m_entries.empty(); }
+
+  void Push(std::span<const u8> state);
+
+  // Removes the most recently pushed state and reconstructs it into the given buffer.
+  // Returns false if there is nothing to restore.
+  bool Pop(Common::UniqueBuffer<u8>& state);
+
+  void Clear();
+
+  // Serializes the pages of a state which differ from the given base state, so that the state can
+  // later be reconstructed from the base with ApplyDelta. Used for incremental savestates.
+  static std::vector<u8> EncodeDelta(std::span<const u8> base, std::span<const u8> state);
+  // Returns false if the delta is malformed.
+  static bool ApplyDelta(std::span<const u8> base, std::span<const u8> delta,
+                         Common::UniqueBuffer<u8>& state);
+
+private:
+  using Keyframe = Common::UniqueBuffer<u8>;
+
+  struct Entry
+  {
+    std::shared_ptr<const Keyframe> keyframe;
+    // True for the entry which created the keyframe. Such entries have no delta pages.
+    bool is_keyframe = false;
+    u64 size = 0;
+    // Indices of the pages which differ from the keyframe, in ascending order, and their contents.
+    // Every page occupies PAGE_SIZE bytes in page_data, except for a partial final page.
+    std::vector<u32> pages;
+    std::vector<u8> page_data;
+
+    size_t GetMemoryUsage() const;
+  };
+
+  Entry CreateDelta(std::shared_ptr<const Keyframe> keyframe, std::span<const u8> state) const;
+  void EnforceMemoryBudget();
+
+  std::deque<Entry> m_entries;
+  size_t m_memory_budget;
+  size_t m_memory_usage = 0;
+  // Total size of the deltas depending on the most recent keyframe.
+  size_t m_delta_usage_since_keyframe = 0;
+};
+}  // namespace State
@@ -4,12 +4,17 @@
 #include "Core/State.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <filesystem>
+#include <functional>
 #include <locale>
 #include <map>
 #include <mutex>
 #include <shared_mutex>
+#include <span>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -18,14 +23,17 @@
 
 #include <lz4.h>
 #include <lzo/lzo1x.h>
+#include <zstd.h>
 
 #include "Common/Buffer.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Contains.h"
 #include "Common/FileUtil.h"
+#include "Common/Hash.h"
 #include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
+#include "Common/MappedFile.h"
 #include "Common/MsgHandler.h"
 #include "Common/Thread.h"
 #include "Common/TimeUtil.h"
@@ -34,6 +42,7 @@
 #include "Common/WorkQueueThread.h"
 
 #include "Core/AchievementManager.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -44,6 +53,7 @@
 #include "Core/Movie.h"
 #include "Core/NetPlayProto.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/RewindBuffer.h"
 #include "Core/System.h"
 
 #include "UICommon/UICommon.h"
@@ -76,6 +86,19 @@ static Common::UniqueBuffer<u8> s_undo_load_buffer;
 // Used to estimate buffer size for the next save.
 static u32 s_last_state_size = 0;
 
+// History of recent states for rewinding. Only accessed on the CPU thread.
+static RewindBuffer s_rewind_buffer;
+static Common::UniqueBuffer<u8> s_rewind_scratch_buffer;
+static u32 s_fields_since_rewind_point = 0;
+static bool s_is_rewind_point_pending = false;
+
+// The state that the autosave delta file is relative to, and its hash. Only accessed on the CPU
+// thread.
+static Common::UniqueBuffer<u8> s_autosave_base;
+static u64 s_autosave_base_hash = 0;
+static u32 s_fields_since_autosave = 0;
+static bool s_is_autosave_pending = false;
+
 // Shared locks are acquired for each state save task.
 // Tasks generally transition from: Calling thread -> CPU thread -> Compress/Write thread.
 // Holding an "exclusive" lock will:
@@ -87,7 +110,11 @@ struct CompressAndDumpStateArgs
 {
   Common::UniqueBuffer<u8> buffer;
   std::string filename;
+  CompressionType compression_type;
+  int compression_level;
   std::shared_lock<decltype(s_state_saves_in_progress)> task_lock;
+  // Autosaves don't back up the previous file, don't store a movie and are written silently.
+  bool is_autosave = false;
 };
 
 // Queue for compressing and writing savestates to disk.
@@ -98,13 +125,22 @@ static Common::WorkQueueThreadSP<CompressAndDumpStateArgs> s_compress_and_dump_t
 constexpr u32 STATE_VERSION = 176;  // Last changed in PR 13768
 
 // Increase this if the StateExtendedHeader definition changes
-constexpr u32 EXTENDED_HEADER_VERSION = 1;  // Last changed in PR 12217
+constexpr u32 EXTENDED_HEADER_VERSION = 2;
 
 // Change this if we ever need to store more data in the extended header
-constexpr u32 COMPRESSED_DATA_OFFSET = 0;
+constexpr u32 COMPRESSED_DATA_OFFSET = sizeof(StateExtendedChunkHeader);
+
+// Size of the independently compressed chunks used by the chunked compression types.
+// Small enough to give every thread some work for GameCube states, large enough to keep the
+// compression ratio close to that of compressing the whole state at once.
+constexpr u32 STATE_CHUNK_SIZE = 4 * 1024 * 1024;
 
 constexpr u32 COOKIE_BASE = 0xBAADBABE;
 
+// A new autosave base state is written once the delta against the current base grows beyond
+// 1/AUTOSAVE_DELTA_RATIO of a full state.
+constexpr size_t AUTOSAVE_DELTA_RATIO = 2;
+
 // Maps savestate versions to Dolphin versions.
 // Versions after 42 don't need to be added to this list,
 // because they save the exact Dolphin version to savestates.
@@ -121,8 +157,6 @@ static const std::map<u32, std::pair<std::string, std::string>> s_old_versions =
     {38, {"4.0-4963", "4.0-5267"}}, {39, {"4.0-5279", "4.0-5525"}}, {40, {"4.0-5531", "4.0-5809"}},
     {41, {"4.0-5811", "4.0-5923"}}, {42, {"4.0-5925", "4.0-5946"}}};
 
-static constexpr bool s_use_compression = true;
-
 // Acquired for tasks that will write state save data to the filesystem.
 // This allows for later waiting on completion of said tasks when necessary.
 // We want to maintain a proper order of async operations, e.g. Save, Save, GetInfoString.
@@ -307,6 +341,14 @@ static std::string MakeStateFilename(int number)
                      SConfig::GetInstance().GetGameID(), number);
 }
 
+// Returns the filename of the full base state of the autosave. Deltas against that state are
+// written next to it, to the same filename with ".delta" appended.
+static std::string MakeAutosaveFilename()
+{
+  return fmt::format("{}{}.autosave.sav", File::GetUserPath(D_STATESAVES_IDX),
+                     SConfig::GetInstance().GetGameID());
+}
+
 static std::vector<SlotWithTimestamp> GetUsedSlotsWithTimestamp()
 {
   std::vector<SlotWithTimestamp> result;
@@ -322,50 +364,179 @@ static std::vector<SlotWithTimestamp> GetUsedSlotsWithTimestamp()
   return result;
 }
 
-static void CompressBufferToFile(std::span<const u8> raw_buffer, File::IOFile& f)
+// Calls func for every index in [0, count), spreading the calls across multiple threads.
+// Returns false if any call returned false. Remaining calls are skipped after a failure.
+static bool ParallelForEachChunk(size_t count, const std::function<bool(size_t)>& func)
 {
-  u64 total_bytes_compressed = 0;
+  if (count == 0)
+    return true;
 
-  while (true)
+  const size_t thread_count =
+      std::min<size_t>(count, std::max(1u, std::thread::hardware_concurrency()));
+
+  std::atomic<size_t> next_index = 0;
+  std::atomic<bool> success = true;
+  const auto work = [&] {
+    for (size_t i = next_index++; i < count && success.load(std::memory_order_relaxed);
+         i = next_index++)
+    {
+      if (!func(i))
+        success = false;
+    }
+  };
+
+  // The calling thread takes part in the work as well.
+  std::vector<std::thread> threads;
+  threads.reserve(thread_count - 1);
+  for (size_t i = 1; i < thread_count; ++i)
   {
-    const u64 bytes_left_to_compress = raw_buffer.size() - total_bytes_compressed;
+    threads.emplace_back([&work] {
+      Common::SetCurrentThreadName("Savestate Chunk Worker");
+      work();
+    });
+  }
+  work();
 
-    const int bytes_to_compress =
-        static_cast<int>(std::min(static_cast<u64>(LZ4_MAX_INPUT_SIZE), bytes_left_to_compress));
-    Common::UniqueBuffer<char> compressed_buffer(LZ4_compressBound(bytes_to_compress));
+  for (std::thread& thread : threads)
+    thread.join();
+
+  return success;
+}
+
+static std::span<const u8> GetChunk(std::span<const u8> buffer, u32 chunk_size, size_t index)
+{
+  const size_t offset = index * chunk_size;
+  return buffer.subspan(offset, std::min<size_t>(chunk_size, buffer.size() - offset));
+}
+
+static bool CompressChunk(std::span<const u8> chunk, CompressionType compression_type,
+                          int compression_level, Common::UniqueBuffer<u8>& compressed_chunk,
+                          u32& compressed_size)
+{
+  switch (compression_type)
+  {
+  case CompressionType::ChunkedLZ4:
+  {
+    compressed_chunk.reset(LZ4_compressBound(static_cast<int>(chunk.size())));
     const int compressed_len = LZ4_compress_default(
-        reinterpret_cast<const char*>(raw_buffer.data()) + total_bytes_compressed,
-        compressed_buffer.get(), bytes_to_compress, int(compressed_buffer.size()));
+        reinterpret_cast<const char*>(chunk.data()),
+        reinterpret_cast<char*>(compressed_chunk.data()), static_cast<int>(chunk.size()),
+        static_cast<int>(compressed_chunk.size()));
+    if (compressed_len <= 0)
+      return false;
 
-    if (compressed_len == 0)
-    {
-      PanicAlertFmtT("Internal LZ4 Error - compression failed");
-      break;
-    }
+    compressed_size = static_cast<u32>(compressed_len);
+    return true;
+  }
+  case CompressionType::ChunkedZstd:
+  {
+    compressed_chunk.reset(ZSTD_compressBound(chunk.size()));
+    const size_t compressed_len = ZSTD_compress(compressed_chunk.data(), compressed_chunk.size(),
+                                                chunk.data(), chunk.size(), compression_level);
+    if (ZSTD_isError(compressed_len))
+      return false;
 
-    // The size of the data to write is 'compressed_len'
-    f.WriteArray(&compressed_len, 1);
-    f.WriteBytes(compressed_buffer.get(), compressed_len);
+    compressed_size = static_cast<u32>(compressed_len);
+    return true;
+  }
+  default:
+    return false;
+  }
+}
 
-    total_bytes_compressed += bytes_to_compress;
-    if (total_bytes_compressed == raw_buffer.size())
-      break;
+static bool DecompressChunk(std::span<const u8> compressed_chunk, CompressionType compression_type,
+                            std::span<u8> chunk)
+{
+  switch (compression_type)
+  {
+  case CompressionType::ChunkedLZ4:
+  {
+    const int bytes_read = LZ4_decompress_safe(
+        reinterpret_cast<const char*>(compressed_chunk.data()),
+        reinterpret_cast<char*>(chunk.data()), static_cast<int>(compressed_chunk.size()),
+        static_cast<int>(chunk.size()));
+    return bytes_read >= 0 && static_cast<size_t>(bytes_read) == chunk.size();
+  }
+  case CompressionType::ChunkedZstd:
+  {
+    const size_t bytes_read = ZSTD_decompress(chunk.data(), chunk.size(), compressed_chunk.data(),
+                                              compressed_chunk.size());
+    return !ZSTD_isError(bytes_read) && bytes_read == chunk.size();
+  }
+  default:
+    return false;
+  }
+}
+
+static bool CompressBufferToFile(std::span<const u8> raw_buffer,
+                                 const StateExtendedHeader& extended_header, File::IOFile& f)
+{
+  const auto compression_type =
+      static_cast<CompressionType>(extended_header.base_header.compression_type);
+  const StateExtendedChunkHeader& chunk_header = extended_header.chunk_header;
+
+  std::vector<Common::UniqueBuffer<u8>> compressed_chunks(chunk_header.chunk_count);
+  std::vector<u32> compressed_sizes(chunk_header.chunk_count);
+
+  const bool success = ParallelForEachChunk(chunk_header.chunk_count, [&](size_t i) {
+    return CompressChunk(GetChunk(raw_buffer, chunk_header.chunk_size, i), compression_type,
+                         chunk_header.compression_level, compressed_chunks[i],
+                         compressed_sizes[i]);
+  });
+
+  if (!success)
+  {
+    PanicAlertFmtT("Internal savestate error - compression failed ({0})",
+                   extended_header.base_header.compression_type);
+    return false;
   }
+
+  f.WriteArray(compressed_sizes.data(), compressed_sizes.size());
+  for (size_t i = 0; i < compressed_chunks.size(); ++i)
+    f.WriteBytes(compressed_chunks[i].data(), compressed_sizes[i]);
+
+  return true;
 }
 
-static void CreateExtendedHeader(StateExtendedHeader& extended_header, size_t uncompressed_size)
+static void CreateExtendedHeader(StateExtendedHeader& extended_header, size_t uncompressed_size,
+                                 CompressionType compression_type, int compression_level)
 {
   StateExtendedBaseHeader& base_header = extended_header.base_header;
   base_header.header_version = EXTENDED_HEADER_VERSION;
-  base_header.compression_type =
-      s_use_compression ? CompressionType::LZ4 : CompressionType::Uncompressed;
+  base_header.compression_type = compression_type;
   base_header.payload_offset = COMPRESSED_DATA_OFFSET;
   base_header.uncompressed_size = uncompressed_size;
 
+  StateExtendedChunkHeader& chunk_header = extended_header.chunk_header;
+  if (compression_type != CompressionType::Uncompressed)
+  {
+    chunk_header.chunk_size = STATE_CHUNK_SIZE;
+    chunk_header.chunk_count =
+        static_cast<u32>((uncompressed_size + STATE_CHUNK_SIZE - 1) / STATE_CHUNK_SIZE);
+    // The level comes straight from the config, so it may be outside of what zstd supports.
+    if (compression_type == CompressionType::ChunkedZstd)
+      chunk_header.compression_level =
+          std::clamp(compression_level, ZSTD_minCLevel(), ZSTD_maxCLevel());
+  }
+
   // If more fields are added to StateExtendedHeader, set them here.
 }
 
-static void WriteHeadersToFile(size_t uncompressed_size, File::IOFile& f)
+static CompressionType GetConfiguredCompressionType()
+{
+  switch (Config::Get(Config::MAIN_STATE_COMPRESSION))
+  {
+  case Config::StateCompressionMode::Uncompressed:
+    return CompressionType::Uncompressed;
+  case Config::StateCompressionMode::Zstd:
+    return CompressionType::ChunkedZstd;
+  case Config::StateCompressionMode::LZ4:
+  default:
+    return CompressionType::ChunkedLZ4;
+  }
+}
+
+static void WriteHeadersToFile(const StateExtendedHeader& extended_header, File::IOFile& f)
 {
   StateHeader header{};
   SConfig::GetInstance().GetGameID().copy(header.legacy_header.game_id,
@@ -376,15 +547,13 @@ static void WriteHeadersToFile(size_t uncompressed_size, File::IOFile& f)
   header.version_string = Common::GetScmRevStr();
   header.version_header.version_string_length = static_cast<u32>(header.version_string.length());
 
-  StateExtendedHeader extended_header{};
-  CreateExtendedHeader(extended_header, uncompressed_size);
-
   f.WriteArray(&header.legacy_header, 1);
   f.WriteArray(&header.version_header, 1);
   f.WriteString(header.version_string);
 
   f.WriteArray(&extended_header.base_header, 1);
-  // If StateExtendedHeader is amended to include more than the base, add WriteBytes() calls here.
+  f.WriteArray(&extended_header.chunk_header, 1);
+  // If StateExtendedHeader is amended to include more fields, add WriteBytes() calls here.
 }
 
 static void CompressAndDumpState(Core::System& system, const CompressAndDumpStateArgs& save_args)
@@ -411,22 +580,32 @@ static void CompressAndDumpState(Core::System& system, const CompressAndDumpStat
     return;
   }
 
-  WriteHeadersToFile(buffer.size(), f);
+  StateExtendedHeader extended_header{};
+  CreateExtendedHeader(extended_header, buffer.size(), save_args.compression_type,
+                       save_args.compression_level);
+  WriteHeadersToFile(extended_header, f);
 
-  if (s_use_compression)
-    CompressBufferToFile(buffer, f);
+  bool success;
+  if (save_args.compression_type != CompressionType::Uncompressed)
+    success = CompressBufferToFile(buffer, extended_header, f);
   else
-    f.WriteBytes(buffer.data(), buffer.size());
+    success = f.WriteBytes(buffer.data(), buffer.size());
 
-  if (!f.IsGood())
+  // Don't replace the previous state with an incomplete one.
+  if (!success || !f.IsGood())
+  {
+    f.Close();
+    File::Delete(temp_filename);
     Core::DisplayMessage("Failed to write state file", 2000);
+    return;
+  }
 
   const std::string last_state_filename = File::GetUserPath(D_STATESAVES_IDX) + "lastState.sav";
   const std::string last_state_dtmname = last_state_filename + ".dtm";
   const std::string dtmname = filename + ".dtm";
 
   // Backup existing state (overwriting an existing backup, if any).
-  if (File::Exists(filename))
+  if (!save_args.is_autosave && File::Exists(filename))
   {
     if (File::Exists(last_state_filename))
       File::Delete((last_state_filename));
@@ -444,11 +623,14 @@ static void CompressAndDumpState(Core::System& system, const CompressAndDumpStat
     }
   }
 
-  auto& movie = system.GetMovie();
-  if ((movie.IsMovieActive()) && !movie.IsJustStartingRecordingInputFromSaveState())
-    movie.SaveRecording(dtmname);
-  else if (!movie.IsMovieActive())
-    File::Delete(dtmname);
+  if (!save_args.is_autosave)
+  {
+    auto& movie = system.GetMovie();
+    if ((movie.IsMovieActive()) && !movie.IsJustStartingRecordingInputFromSaveState())
+      movie.SaveRecording(dtmname);
+    else if (!movie.IsMovieActive())
+      File::Delete(dtmname);
+  }
 
   // Move written state to final location.
   // TODO: This should also be atomic. This is possible on all systems, but needs a special
@@ -460,7 +642,7 @@ static void CompressAndDumpState(Core::System& system, const CompressAndDumpStat
   {
     Core::DisplayMessage("Failed to rename state file", 2000);
   }
-  else
+  else if (!save_args.is_autosave)
   {
     const std::filesystem::path temp_path(filename);
     Core::DisplayMessage(fmt::format("Saved State to {}", temp_path.filename().string()), 2000);
@@ -482,6 +664,8 @@ static void SaveAsFromCore(Core::System& system, std::string filename)
     CompressAndDumpStateArgs dump_args{
         .buffer = std::move(buffer),
         .filename = std::move(filename),
+        .compression_type = GetConfiguredCompressionType(),
+        .compression_level = Config::Get(Config::MAIN_STATE_COMPRESSION_LEVEL),
         .task_lock = GetStateSaveTaskLock(),
     };
     Core::DisplayMessage("Saving State...", 1000);
@@ -690,6 +874,64 @@ static bool DecompressLZ4(Common::UniqueBuffer<u8>& raw_buffer, u64 size, File::
   }
 }
 
+static bool DecompressChunks(Common::UniqueBuffer<u8>& raw_buffer,
+                             const StateExtendedHeader& extended_header, File::IOFile& f)
+{
+  const auto compression_type =
+      static_cast<CompressionType>(extended_header.base_header.compression_type);
+  const u64 size = extended_header.base_header.uncompressed_size;
+  const StateExtendedChunkHeader& chunk_header = extended_header.chunk_header;
+
+  if (chunk_header.chunk_size == 0 ||
+      chunk_header.chunk_count != (size + chunk_header.chunk_size - 1) / chunk_header.chunk_size)
+  {
+    PanicAlertFmtT("Internal savestate error - invalid chunk layout ({0} x {1} for {2} bytes)",
+                   chunk_header.chunk_count, chunk_header.chunk_size, size);
+    return false;
+  }
+
+  std::vector<u32> compressed_sizes(chunk_header.chunk_count);
+  if (!f.ReadArray(compressed_sizes.data(), compressed_sizes.size()))
+  {
+    PanicAlertFmt("Could not read state chunk table");
+    return false;
+  }
+
+  std::vector<u64> compressed_offsets(chunk_header.chunk_count);
+  u64 total_compressed_size = 0;
+  for (size_t i = 0; i < compressed_sizes.size(); ++i)
+  {
+    compressed_offsets[i] = total_compressed_size;
+    total_compressed_size += compressed_sizes[i];
+  }
+
+  // Read all compressed chunks at once, then decompress them in parallel.
+  Common::UniqueBuffer<u8> compressed_data(total_compressed_size);
+  if (!f.ReadBytes(compressed_data.data(), compressed_data.size()))
+  {
+    PanicAlertFmt("Could not read state data");
+    return false;
+  }
+
+  raw_buffer.reset(size);
+  const std::span<const u8> compressed_span(compressed_data.data(), compressed_data.size());
+  const bool success = ParallelForEachChunk(chunk_header.chunk_count, [&](size_t i) {
+    const size_t offset = i * chunk_header.chunk_size;
+    const size_t chunk_size = std::min<size_t>(chunk_header.chunk_size, size - offset);
+    return DecompressChunk(compressed_span.subspan(compressed_offsets[i], compressed_sizes[i]),
+                           compression_type, std::span(raw_buffer.data() + offset, chunk_size));
+  });
+
+  if (!success)
+  {
+    PanicAlertFmtT("Internal savestate error - decompression failed ({0})",
+                   extended_header.base_header.compression_type);
+    return false;
+  }
+
+  return true;
+}
+
 static bool ValidateHeaders(const StateHeader& header)
 {
   bool success = true;
@@ -737,7 +979,37 @@ static bool ValidateHeaders(const StateHeader& header)
   return success;
 }
 
-static void LoadFileStateData(const std::string& filename, Common::UniqueBuffer<u8>& ret_data)
+namespace
+{
+// The payload of a loaded state file.
+// Compressed payloads are decompressed into a buffer, but uncompressed payloads are used straight
+// from a mapping of the file, so that PointerWrap copies them into emulated memory without any
+// intermediate copies.
+struct StatePayload
+{
+  Common::UniqueBuffer<u8> buffer;
+  Common::MappedFile mapped_file;
+  std::span<u8> data;
+};
+}  // namespace
+
+static bool MapUncompressedPayload(const std::string& filename, u64 header_len,
+                                   StatePayload& payload)
+{
+  Common::MappedFile mapped_file;
+  if (!mapped_file.Open(filename))
+    return false;
+
+  const std::span<u8> file_data = mapped_file.GetData();
+  if (file_data.size() < header_len)
+    return false;
+
+  payload.data = file_data.subspan(header_len);
+  payload.mapped_file = std::move(mapped_file);
+  return true;
+}
+
+static void LoadFileStateData(const std::string& filename, StatePayload& ret_payload)
 {
   File::IOFile f;
   f.Open(filename, "rb");
@@ -746,30 +1018,49 @@ static void LoadFileStateData(const std::string& filename, Common::UniqueBuffer<
   if (!ReadStateHeaderFromFile(header, f) || !ValidateHeaders(header))
     return;
 
-  StateExtendedHeader extended_header;
+  StateExtendedHeader extended_header{};
   if (!f.ReadArray(&extended_header.base_header, 1))
   {
     PanicAlertFmt("Unable to read state header");
     return;
   }
-  // If StateExtendedHeader is amended to include more than the base, add ReadBytes() calls here.
 
-  if (extended_header.base_header.header_version != EXTENDED_HEADER_VERSION)
+  // Version 1 headers only consist of the base header, and are still supported for loading.
+  const u16 header_version = extended_header.base_header.header_version;
+  if (header_version == 0 || header_version > EXTENDED_HEADER_VERSION)
   {
     PanicAlertFmt("State header corrupted");
     return;
   }
 
-  Common::UniqueBuffer<u8> buffer;
+  if (header_version >= 2 && !f.ReadArray(&extended_header.chunk_header, 1))
+  {
+    PanicAlertFmt("Unable to read state chunk header");
+    return;
+  }
+  // If StateExtendedHeader is amended to include more fields, add ReadBytes() calls here.
+
+  StatePayload payload;
 
   switch (extended_header.base_header.compression_type)
   {
   case CompressionType::LZ4:
   {
     Core::DisplayMessage("Decompressing State...", OSD::Duration::SHORT);
-    if (!DecompressLZ4(buffer, extended_header.base_header.uncompressed_size, f))
+    if (!DecompressLZ4(payload.buffer, extended_header.base_header.uncompressed_size, f))
+      return;
+
+    payload.data = std::span(payload.buffer.data(), payload.buffer.size());
+    break;
+  }
+  case CompressionType::ChunkedLZ4:
+  case CompressionType::ChunkedZstd:
+  {
+    Core::DisplayMessage("Decompressing State...", OSD::Duration::SHORT);
+    if (!DecompressChunks(payload.buffer, extended_header, f))
       return;
 
+    payload.data = std::span(payload.buffer.data(), payload.buffer.size());
     break;
   }
   case CompressionType::Uncompressed:
@@ -778,6 +1069,10 @@ static void LoadFileStateData(const std::string& filename, Common::UniqueBuffer<
                      header.version_header.version_string_length + sizeof(StateExtendedBaseHeader) +
                      extended_header.base_header.payload_offset;
 
+    if (MapUncompressedPayload(filename, header_len, payload))
+      break;
+
+    // Fall back to reading the whole file if it can't be mapped.
     u64 file_size = f.GetSize();
     if (file_size < header_len)
     {
@@ -786,13 +1081,15 @@ static void LoadFileStateData(const std::string& filename, Common::UniqueBuffer<
     }
 
     const auto size = static_cast<size_t>(file_size - header_len);
-    buffer.reset(size);
+    payload.buffer.reset(size);
 
-    if (!f.ReadBytes(buffer.data(), size))
+    if (!f.Seek(header_len, File::SeekOrigin::Begin) || !f.ReadBytes(payload.buffer.data(), size))
     {
       PanicAlertFmt("Error reading bytes: {0}", size);
       return;
     }
+
+    payload.data = std::span(payload.buffer.data(), payload.buffer.size());
     break;
   }
   default:
@@ -801,10 +1098,50 @@ static void LoadFileStateData(const std::string& filename, Common::UniqueBuffer<
   }
 
   // all good
-  ret_data.swap(buffer);
+  ret_payload = std::move(payload);
 }
 
-static void LoadAsFromCore(Core::System& system, std::string filename)
+// Loads the autosave base state and applies the delta file to it, if the delta belongs to it.
+static void LoadAutosaveData(const std::string& filename, StatePayload& ret_payload)
+{
+  StatePayload base;
+  LoadFileStateData(filename, base);
+  if (base.data.empty())
+    return;
+
+  const std::string delta_filename = filename + ".delta";
+  StatePayload delta;
+  if (File::Exists(delta_filename))
+    LoadFileStateData(delta_filename, delta);
+
+  // The delta starts with the hash of the base it was created against. A delta that doesn't match
+  // is left over from before the base was rewritten, and the base alone is the newer state.
+  u64 base_hash;
+  if (delta.data.size() < sizeof(base_hash))
+  {
+    ret_payload = std::move(base);
+    return;
+  }
+  std::memcpy(&base_hash, delta.data.data(), sizeof(base_hash));
+  if (base_hash != Common::GetHash64(base.data.data(), u32(base.data.size()), 0))
+  {
+    ret_payload = std::move(base);
+    return;
+  }
+
+  StatePayload payload;
+  if (!RewindBuffer::ApplyDelta(base.data, delta.data.subspan(sizeof(base_hash)), payload.buffer))
+  {
+    WARN_LOG_FMT(CORE, "Ignoring corrupted autosave delta {}", delta_filename);
+    ret_payload = std::move(base);
+    return;
+  }
+
+  payload.data = std::span(payload.buffer.data(), payload.buffer.size());
+  ret_payload = std::move(payload);
+}
+
+static void LoadAsFromCore(Core::System& system, std::string filename, bool is_autosave = false)
 {
   // Ensure all data has reached the filesystem before trying to use it.
   s_compress_and_dump_thread.WaitForCompletion();
@@ -824,15 +1161,18 @@ static void LoadAsFromCore(Core::System& system, std::string filename)
   bool was_file_read = false;
   bool loaded_successfully = false;
 
-  // brackets here are so buffer gets freed ASAP
+  // brackets here are so the payload gets freed ASAP
   {
-    Common::UniqueBuffer<u8> buffer;
-    LoadFileStateData(filename, buffer);
+    StatePayload payload;
+    if (is_autosave)
+      LoadAutosaveData(filename, payload);
+    else
+      LoadFileStateData(filename, payload);
 
-    if (!buffer.empty())
+    if (!payload.data.empty())
     {
       was_file_read = true;
-      loaded_successfully = LoadFromBuffer(system, buffer);
+      loaded_successfully = LoadFromBuffer(system, payload.data);
     }
   }
 
@@ -876,6 +1216,159 @@ void LoadAs(Core::System& system, std::string filename)
   });
 }
 
+static void RecordRewindPointFromCore(Core::System& system)
+{
+  s_is_rewind_point_pending = false;
+
+  const auto state_size = SaveToBuffer(system, s_rewind_scratch_buffer);
+  if (state_size == 0)
+    return;
+
+  s_rewind_buffer.SetMemoryBudget(size_t(Config::Get(Config::MAIN_REWIND_MEMORY_BUDGET_MB))
+                                  << 20);
+  s_rewind_buffer.Push(std::span(s_rewind_scratch_buffer.data(), state_size));
+}
+
+static void UpdateRewind(Core::System& system)
+{
+  if (!Config::Get(Config::MAIN_REWIND_ENABLE))
+  {
+    if (!s_rewind_buffer.IsEmpty())
+      s_rewind_buffer.Clear();
+    return;
+  }
+
+  if (s_is_rewind_point_pending ||
+      ++s_fields_since_rewind_point < Config::Get(Config::MAIN_REWIND_FREQUENCY))
+  {
+    return;
+  }
+
+  // States can't be saved in the middle of a CoreTiming event,
+  // so let the host pause the CPU thread at the next opportunity instead.
+  s_fields_since_rewind_point = 0;
+  s_is_rewind_point_pending = true;
+  Core::QueueHostJob([&system](Core::System&) {
+    Core::RunOnCPUThread(system, [&system] { RecordRewindPointFromCore(system); });
+  });
+}
+
+static void AutosaveFromCore(Core::System& system)
+{
+  s_is_autosave_pending = false;
+
+  const auto buffer_size_estimate = std::size_t(s_last_state_size) * 110 / 100;
+  Common::UniqueBuffer<u8> buffer{buffer_size_estimate};
+  const auto state_size = SaveToBuffer(system, buffer);
+  if (state_size == 0)
+    return;
+  buffer.assign(buffer.extract().first, state_size);
+
+  const std::string filename = MakeAutosaveFilename();
+  const std::span<const u8> state(buffer.data(), buffer.size());
+
+  if (!s_autosave_base.empty())
+  {
+    const std::vector<u8> delta =
+        RewindBuffer::EncodeDelta(std::span(s_autosave_base.data(), s_autosave_base.size()), state);
+
+    if (delta.size() * AUTOSAVE_DELTA_RATIO <= state.size())
+    {
+      Common::UniqueBuffer<u8> payload(sizeof(s_autosave_base_hash) + delta.size());
+      std::memcpy(payload.data(), &s_autosave_base_hash, sizeof(s_autosave_base_hash));
+      std::ranges::copy(delta, payload.data() + sizeof(s_autosave_base_hash));
+
+      s_compress_and_dump_thread.EmplaceItem(CompressAndDumpStateArgs{
+          .buffer = std::move(payload),
+          .filename = filename + ".delta",
+          .compression_type = GetConfiguredCompressionType(),
+          .compression_level = Config::Get(Config::MAIN_STATE_COMPRESSION_LEVEL),
+          .task_lock = GetStateSaveTaskLock(),
+          .is_autosave = true,
+      });
+      return;
+    }
+  }
+
+  // Any existing delta file no longer matches the hash of the new base, so it gets ignored.
+  s_autosave_base.reset(state.size());
+  std::ranges::copy(state, s_autosave_base.data());
+  s_autosave_base_hash = Common::GetHash64(state.data(), u32(state.size()), 0);
+
+  s_compress_and_dump_thread.EmplaceItem(CompressAndDumpStateArgs{
+      .buffer = std::move(buffer),
+      .filename = filename,
+      .compression_type = GetConfiguredCompressionType(),
+      .compression_level = Config::Get(Config::MAIN_STATE_COMPRESSION_LEVEL),
+      .task_lock = GetStateSaveTaskLock(),
+      .is_autosave = true,
+  });
+}
+
+static void UpdateAutosave(Core::System& system)
+{
+  // Movies can't be restored from an autosave, so don't bother creating them.
+  if (!Config::Get(Config::MAIN_AUTOSAVE_ENABLE) || system.GetMovie().IsMovieActive())
+  {
+    if (!s_autosave_base.empty())
+      s_autosave_base.reset();
+    return;
+  }
+
+  if (s_is_autosave_pending ||
+      ++s_fields_since_autosave < Config::Get(Config::MAIN_AUTOSAVE_FREQUENCY))
+  {
+    return;
+  }
+
+  s_fields_since_autosave = 0;
+  s_is_autosave_pending = true;
+  Core::QueueHostJob([&system](Core::System&) {
+    Core::RunOnCPUThread(system, [&system] { AutosaveFromCore(system); });
+  });
+}
+
+void OnFrameEnd(Core::System& system)
+{
+  UpdateRewind(system);
+  UpdateAutosave(system);
+}
+
+void Rewind(Core::System& system)
+{
+  if (!CheckIfStateLoadIsAllowed(system))
+    return;
+
+  Core::RunOnCPUThread(system, [&system] {
+    if (system.GetMovie().IsMovieActive())
+    {
+      Core::DisplayMessage("Rewinding is disabled during movie recording and playback", 2000);
+      return;
+    }
+
+    Common::UniqueBuffer<u8> buffer;
+    if (!s_rewind_buffer.Pop(buffer))
+    {
+      Core::DisplayMessage("There is nothing to rewind", 2000);
+      return;
+    }
+
+    s_fields_since_rewind_point = 0;
+    if (!LoadFromBuffer(system, buffer))
+      Core::DisplayMessage("The savestate could not be loaded", OSD::Duration::NORMAL);
+  });
+}
+
+void LoadAutosave(Core::System& system)
+{
+  if (!CheckIfStateLoadIsAllowed(system))
+    return;
+
+  Core::RunOnCPUThread(system, [&system, filename = MakeAutosaveFilename()]() mutable {
+    LoadAsFromCore(system, std::move(filename), true);
+  });
+}
+
 void SetOnAfterLoadCallback(AfterLoadCallbackFunc callback)
 {
   s_on_after_load_callback = std::move(callback);
@@ -896,6 +1389,14 @@ void Shutdown()
 {
   s_compress_and_dump_thread.Shutdown();
   s_undo_load_buffer.reset();
+  s_rewind_buffer.Clear();
+  s_rewind_scratch_buffer.reset();
+  s_fields_since_rewind_point = 0;
+  s_is_rewind_point_pending = false;
+  s_autosave_base.reset();
+  s_autosave_base_hash = 0;
+  s_fields_since_autosave = 0;
+  s_is_autosave_pending = false;
   s_flush_unsaved_data_hook.reset();
 }
 
@@ -54,6 +54,10 @@ enum CompressionType : u16
 {
   Uncompressed = 0,
   LZ4 = 1,
+  // The chunked types split the payload into chunks of StateExtendedChunkHeader::chunk_size bytes
+  // which are compressed independently, so that saving and loading can use multiple threads.
+  ChunkedLZ4 = 2,
+  ChunkedZstd = 3,
   // Add new compression types after this, as the compression type
   // is numerically stored in the state file.
 };
@@ -71,9 +75,24 @@ static_assert(offsetof(StateExtendedBaseHeader, payload_offset) == 4);
 static_assert(offsetof(StateExtendedBaseHeader, uncompressed_size) == 8);
 static_assert(std::is_trivially_copyable_v<StateExtendedBaseHeader>);
 
+struct StateExtendedChunkHeader
+{
+  u32 chunk_size;
+  u32 chunk_count;
+  s32 compression_level;
+  u32 reserved;
+};
+constexpr size_t EXTENDED_CHUNK_HEADER_SIZE = sizeof(StateExtendedChunkHeader);
+static_assert(EXTENDED_CHUNK_HEADER_SIZE == 16);
+static_assert(std::is_trivially_copyable_v<StateExtendedChunkHeader>);
+
 struct StateExtendedHeader
 {
   StateExtendedBaseHeader base_header;
+  // Only present if base_header.header_version >= 2.
+  // For chunked compression types, the payload starts with a table of chunk_count u32 compressed
+  // chunk sizes, followed by the compressed chunks themselves.
+  StateExtendedChunkHeader chunk_header;
   // Feel free to add new fields here, adjusting COMPRESSED_DATA_OFFSET accordingly, as well as
   // CreateExtendedHeader(). Add the appropriate IOFile read/write calls within LoadFileStateData()
   // and WriteHeadersToFile()
@@ -98,6 +117,17 @@ void Load(Core::System& system, int slot);
 void SaveAs(Core::System& system, std::string filename);
 void LoadAs(Core::System& system, std::string filename);
 
+// Called on the CPU thread at the end of every emulated field.
+// Periodically records a rewind point and writes an autosave, if they are enabled.
+void OnFrameEnd(Core::System& system);
+
+// Loads the most recent rewind point and removes it from the rewind history.
+void Rewind(Core::System& system);
+
+// Autosaves are written as a full base state plus a delta file which only contains the pages that
+// changed since the base, so frequent autosaves stay cheap. This loads the most recent one.
+void LoadAutosave(Core::System& system);
+
 void LoadLastSaved(Core::System& system, int i = 1);
 void SaveFirstSaved(Core::System& system);
 void UndoSaveState(Core::System& system);
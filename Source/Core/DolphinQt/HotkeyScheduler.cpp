@@ -656,6 +656,12 @@ void HotkeyScheduler::Run()
     if (IsHotkey(HK_UNDO_SAVE_STATE))
       emit StateSaveUndo();
 
+    if (IsHotkey(HK_REWIND))
+      emit StateRewind();
+
+    if (IsHotkey(HK_LOAD_AUTOSAVE))
+      emit StateLoadAutosave();
+
     if (IsHotkey(HK_LOAD_STATE_FILE))
       emit StateLoadFile();
 
@@ -48,6 +48,8 @@ signals:
   void StateSaveFile();
   void StateLoadUndo();
   void StateSaveUndo();
+  void StateRewind();
+  void StateLoadAutosave();
   void StartRecording();
   void PlayRecording();
   void ExportRecording();
@@ -627,6 +627,9 @@ void MainWindow::ConnectHotkeys()
           &MainWindow::StateLoadLastSavedAt);
   connect(m_hotkey_scheduler, &HotkeyScheduler::StateLoadUndo, this, &MainWindow::StateLoadUndo);
   connect(m_hotkey_scheduler, &HotkeyScheduler::StateSaveUndo, this, &MainWindow::StateSaveUndo);
+  connect(m_hotkey_scheduler, &HotkeyScheduler::StateRewind, this, &MainWindow::StateRewind);
+  connect(m_hotkey_scheduler, &HotkeyScheduler::StateLoadAutosave, this,
+          &MainWindow::StateLoadAutosave);
   connect(m_hotkey_scheduler, &HotkeyScheduler::StateSaveOldest, this,
           &MainWindow::StateSaveOldest);
   connect(m_hotkey_scheduler, &HotkeyScheduler::StateSaveFile, this, &MainWindow::StateSave);
@@ -1508,6 +1511,16 @@ void MainWindow::StateSaveUndo()
   State::UndoSaveState(m_system);
 }
 
+void MainWindow::StateRewind()
+{
+  State::Rewind(m_system);
+}
+
+void MainWindow::StateLoadAutosave()
+{
+  State::LoadAutosave(m_system);
+}
+
 void MainWindow::StateSaveOldest()
 {
   State::SaveFirstSaved(m_system);
@@ -0,0 +1,66 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoBackends/Software/PixelMath.h"
+
+#include <cstring>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "Common/Inline.h"
+
+#if defined(_M_X86) || defined(_M_X86_64)
+#define USE_SSE
+#include <immintrin.h>
+#else
+#define NO_SIMD
+#endif
+
+#include "VideoBackends/Software/PixelMathImpl.h"
+#ifdef USE_SSE
+#define USE_SSE41
+#include "VideoBackends/Software/PixelMathImpl.h"
+#define USE_AVX2
+#include "VideoBackends/Software/PixelMathImpl.h"
+#endif
+
+#if defined(USE_SSE)
+#if defined(__AVX2__)
+static constexpr int MIN_SSE = 52;
+#elif defined(__SSE4_1__)
+static constexpr int MIN_SSE = 41;
+#else
+static constexpr int MIN_SSE = 0;
+#endif
+#endif
+
+namespace PixelMath
+{
+CombineFunction Combine = PixelMath_Scalar::Combine;
+FilterBilinearFunction FilterBilinear = PixelMath_Scalar::FilterBilinear;
+BlendMipsFunction BlendMips = PixelMath_Scalar::BlendMips;
+
+void Init()
+{
+#if defined(USE_SSE)
+  if (MIN_SSE >= 52 || cpu_info.bAVX2)
+  {
+    Combine = PixelMath_AVX2::Combine;
+    FilterBilinear = PixelMath_AVX2::FilterBilinear;
+    BlendMips = PixelMath_AVX2::BlendMips;
+    return;
+  }
+  if (MIN_SSE >= 41 || cpu_info.bSSE4_1)
+  {
+    Combine = PixelMath_SSE41::Combine;
+    FilterBilinear = PixelMath_SSE41::FilterBilinear;
+    BlendMips = PixelMath_SSE41::BlendMips;
+    return;
+  }
+#endif
+
+  Combine = PixelMath_Scalar::Combine;
+  FilterBilinear = PixelMath_Scalar::FilterBilinear;
+  BlendMips = PixelMath_Scalar::BlendMips;
+}
+}  // namespace PixelMath
@@ -0,0 +1,57 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+
+#include "Common/CommonTypes.h"
+
+// Per-pixel math of the software renderer which works on all four channels of a pixel at once.
+// All implementations give exactly the same results as the scalar one.
+namespace PixelMath
+{
+// One value per channel, in the order of the TEV's channels (alpha, blue, green, red).
+using Channels = std::array<s32, 4>;
+
+struct CombinerInputs
+{
+  // Like on hardware, only the low 8 bits of a, b and c and the low 11 bits of d are used.
+  Channels a;
+  Channels b;
+  Channels c;
+  Channels d;
+};
+
+// The settings of a TEV stage's regular (non-compare) color and alpha combiners, per channel.
+struct CombinerParams
+{
+  Channels bias;
+  // 1 << the left shift of the scale
+  Channels scale;
+  Channels rounding;
+  // All bits are set in the channels which subtract. The color combiner negates the result after
+  // dropping its fraction, while the alpha combiner negates it before.
+  Channels negate_before_shift;
+  Channels negate_after_shift;
+  // All bits are set in the channels which divide the result by 2.
+  Channels divide_by_2;
+};
+
+using CombineFunction = void (*)(const CombinerInputs& inputs, const CombinerParams& params,
+                                 Channels* result);
+
+// Filters the top left, top right, bottom left and bottom right texels with 7-bit fractions.
+using FilterBilinearFunction = void (*)(const u8 (*texels)[4], s32 fract_s, s32 fract_t,
+                                        u8* sample);
+
+// Blends the samples of two mip levels with a 4-bit fraction.
+using BlendMipsFunction = void (*)(const u8* sample0, const u8* sample1, s32 fract, u8* sample);
+
+extern CombineFunction Combine;
+extern FilterBilinearFunction FilterBilinear;
+extern BlendMipsFunction BlendMips;
+
+// Picks the fastest implementations the CPU supports.
+void Init();
+}  // namespace PixelMath
@@ -0,0 +1,160 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#if defined(USE_AVX2)
+#define VECTOR_NAMESPACE PixelMath_AVX2
+#elif defined(USE_SSE41)
+#define VECTOR_NAMESPACE PixelMath_SSE41
+#elif defined(USE_SSE) || defined(NO_SIMD)
+#define VECTOR_NAMESPACE PixelMath_Scalar
+#else
+#error This file is meant to be used by PixelMath.cpp only!
+#endif
+
+#if defined(__GNUC__) && defined(USE_AVX2) && !defined(__AVX2__)
+#define ATTR_TARGET __attribute__((target("avx2")))
+#elif defined(__GNUC__) && defined(USE_SSE41) && !defined(__SSE4_1__)
+#define ATTR_TARGET __attribute__((target("sse4.1")))
+#else
+#define ATTR_TARGET
+#endif
+
+namespace VECTOR_NAMESPACE
+{
+#if defined(USE_SSE41)
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m128i LoadChannels(const PixelMath::Channels& channels)
+{
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(channels.data()));
+}
+
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m128i LoadTexel(const u8* texel)
+{
+  u32 value;
+  std::memcpy(&value, texel, sizeof(u32));
+  return _mm_cvtsi32_si128(value);
+}
+
+// Packs the 32-bit channels, which must be in the range of a u8, into a texel.
+ATTR_TARGET DOLPHIN_FORCE_INLINE static void StoreTexel(__m128i channels, u8* texel)
+{
+  channels = _mm_packus_epi32(channels, channels);
+  channels = _mm_packus_epi16(channels, channels);
+  const u32 value = _mm_cvtsi128_si32(channels);
+  std::memcpy(texel, &value, sizeof(u32));
+}
+
+// Returns the weights of two values for _mm_madd_epi16 on values interleaved with
+// _mm_unpacklo_epi8.
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m128i PairWeights(s32 weight0, s32 weight1)
+{
+  return _mm_set1_epi32((weight1 << 16) | weight0);
+}
+#endif
+
+ATTR_TARGET static void Combine(const PixelMath::CombinerInputs& inputs,
+                                const PixelMath::CombinerParams& params,
+                                PixelMath::Channels* result)
+{
+#if defined(USE_SSE41)
+  const __m128i mask8 = _mm_set1_epi32(0xff);
+  const __m128i a = _mm_and_si128(LoadChannels(inputs.a), mask8);
+  const __m128i b = _mm_and_si128(LoadChannels(inputs.b), mask8);
+  __m128i c = _mm_and_si128(LoadChannels(inputs.c), mask8);
+  const __m128i d = _mm_srai_epi32(_mm_slli_epi32(LoadChannels(inputs.d), 21), 21);
+
+  c = _mm_add_epi32(c, _mm_srli_epi32(c, 7));
+
+  const __m128i scale = LoadChannels(params.scale);
+  __m128i temp = _mm_add_epi32(_mm_mullo_epi32(a, _mm_sub_epi32(_mm_set1_epi32(256), c)),
+                               _mm_mullo_epi32(b, c));
+  temp = _mm_mullo_epi32(temp, scale);
+  temp = _mm_add_epi32(temp, LoadChannels(params.rounding));
+
+  const __m128i negate_before_shift = LoadChannels(params.negate_before_shift);
+  temp = _mm_sub_epi32(_mm_xor_si128(temp, negate_before_shift), negate_before_shift);
+  temp = _mm_srai_epi32(temp, 8);
+  const __m128i negate_after_shift = LoadChannels(params.negate_after_shift);
+  temp = _mm_sub_epi32(_mm_xor_si128(temp, negate_after_shift), negate_after_shift);
+
+  __m128i value = _mm_mullo_epi32(_mm_add_epi32(d, LoadChannels(params.bias)), scale);
+  value = _mm_add_epi32(value, temp);
+  value = _mm_blendv_epi8(value, _mm_srai_epi32(value, 1), LoadChannels(params.divide_by_2));
+
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(result->data()), value);
+#else
+  for (size_t i = 0; i < result->size(); i++)
+  {
+    const s32 a = inputs.a[i] & 0xff;
+    const s32 b = inputs.b[i] & 0xff;
+    const s32 c = (inputs.c[i] & 0xff) + ((inputs.c[i] & 0xff) >> 7);
+    const s32 d = static_cast<s32>(static_cast<u32>(inputs.d[i]) << 21) >> 21;
+
+    s32 temp = (a * (256 - c) + b * c) * params.scale[i] + params.rounding[i];
+    if (params.negate_before_shift[i])
+      temp = -temp;
+    temp >>= 8;
+    if (params.negate_after_shift[i])
+      temp = -temp;
+
+    s32 value = (d + params.bias[i]) * params.scale[i] + temp;
+    if (params.divide_by_2[i])
+      value >>= 1;
+
+    (*result)[i] = value;
+  }
+#endif
+}
+
+ATTR_TARGET static void FilterBilinear(const u8 (*texels)[4], s32 fract_s, s32 fract_t, u8* sample)
+{
+  const s32 weight0 = (128 - fract_s) * (128 - fract_t);
+  const s32 weight1 = fract_s * (128 - fract_t);
+  const s32 weight2 = (128 - fract_s) * fract_t;
+  const s32 weight3 = fract_s * fract_t;
+
+#if defined(USE_AVX2)
+  // All weights fit into an s16, so a single madd can multiply and add two texels at once.
+  const __m128i texels01 = _mm_unpacklo_epi8(LoadTexel(texels[0]), LoadTexel(texels[1]));
+  const __m128i texels23 = _mm_unpacklo_epi8(LoadTexel(texels[2]), LoadTexel(texels[3]));
+  const __m256i values = _mm256_cvtepu8_epi16(_mm_unpacklo_epi64(texels01, texels23));
+  const __m256i weights =
+      _mm256_setr_m128i(PairWeights(weight0, weight1), PairWeights(weight2, weight3));
+  const __m256i products = _mm256_madd_epi16(values, weights);
+  __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(products),
+                              _mm256_extracti128_si256(products, 1));
+  StoreTexel(_mm_srli_epi32(sum, 14), sample);
+#elif defined(USE_SSE41)
+  // All weights fit into an s16, so a single madd can multiply and add two texels at once.
+  const __m128i texels01 =
+      _mm_cvtepu8_epi16(_mm_unpacklo_epi8(LoadTexel(texels[0]), LoadTexel(texels[1])));
+  const __m128i texels23 =
+      _mm_cvtepu8_epi16(_mm_unpacklo_epi8(LoadTexel(texels[2]), LoadTexel(texels[3])));
+  __m128i sum = _mm_add_epi32(_mm_madd_epi16(texels01, PairWeights(weight0, weight1)),
+                              _mm_madd_epi16(texels23, PairWeights(weight2, weight3)));
+  StoreTexel(_mm_srli_epi32(sum, 14), sample);
+#else
+  for (int i = 0; i < 4; i++)
+  {
+    const u32 sum = texels[0][i] * weight0 + texels[1][i] * weight1 + texels[2][i] * weight2 +
+                    texels[3][i] * weight3;
+    sample[i] = static_cast<u8>(sum >> 14);
+  }
+#endif
+}
+
+ATTR_TARGET static void BlendMips(const u8* sample0, const u8* sample1, s32 fract, u8* sample)
+{
+#if defined(USE_SSE41)
+  const __m128i samples =
+      _mm_cvtepu8_epi16(_mm_unpacklo_epi8(LoadTexel(sample0), LoadTexel(sample1)));
+  const __m128i sum = _mm_madd_epi16(samples, PairWeights(16 - fract, fract));
+  StoreTexel(_mm_srli_epi32(sum, 4), sample);
+#else
+  for (int i = 0; i < 4; i++)
+    sample[i] = static_cast<u8>((sample0[i] * (16 - fract) + sample1[i] * fract) >> 4);
+#endif
+}
+}  // namespace VECTOR_NAMESPACE
+
+#undef ATTR_TARGET
+#undef VECTOR_NAMESPACE
@@ -4,13 +4,27 @@
 #include "VideoBackends/Software/Rasterizer.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
+#include <fmt/format.h>
+
 #include "Common/Assert.h"
+#include "Common/CPUDetect.h"
 #include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Common/Thread.h"
+
+#include "Core/Config/GraphicsSettings.h"
 
 #include "VideoBackends/Software/NativeVertexFormat.h"
+#include "VideoBackends/Software/SWBoundingBox.h"
 #include "VideoBackends/Software/SWEfbInterface.h"
 #include "VideoBackends/Software/Tev.h"
 #include "VideoCommon/BPFunctions.h"
@@ -24,6 +38,16 @@ namespace Rasterizer
 {
 static constexpr int BLOCK_SIZE = 2;
 
+// When there are worker threads, triangles are binned into tiles of the EFB, and each tile is drawn
+// by a single thread in the order the triangles were submitted. This way, every pixel goes through
+// exactly the same sequence of depth tests and blends as when drawing the triangles one by one.
+static constexpr s32 TILE_SIZE = 64;
+static_assert(TILE_SIZE % BLOCK_SIZE == 0, "Blocks must not cross tile boundaries");
+static constexpr s32 TILES_X = (EFB_WIDTH + TILE_SIZE - 1) / TILE_SIZE;
+static constexpr s32 TILES_Y = (EFB_HEIGHT + TILE_SIZE - 1) / TILE_SIZE;
+
+static constexpr int MAX_WORKER_THREADS = 15;
+
 struct SlopeContext
 {
   SlopeContext(const OutputVertexData* v0, const OutputVertexData* v1, const OutputVertexData* v2,
@@ -95,21 +119,108 @@ struct Slope
   }
 };
 
-static Slope ZSlope;
-static Slope WSlope;
-static Slope ColorSlopes[2][4];
-static Slope TexSlopes[8][3];
+// Everything needed to draw a triangle within one scissor rectangle.
+struct TriangleSetup
+{
+  Slope ZSlope;
+  Slope WSlope;
+  Slope ColorSlopes[2][4];
+  Slope TexSlopes[8][3];
+
+  // Half-edge constants
+  s32 C1;
+  s32 C2;
+  s32 C3;
+
+  // Deltas of the 28.4 fixed-point coordinates
+  s32 DX12;
+  s32 DX23;
+  s32 DX31;
+  s32 DY12;
+  s32 DY23;
+  s32 DY31;
+
+  // Bounding rectangle, clipped to the scissor rectangle
+  s32 minx;
+  s32 maxx;
+  s32 miny;
+  s32 maxy;
+};
+
+// The state of one thread which draws triangles.
+struct DrawContext
+{
+  Tev tev;
+  RasterBlock rasterBlock;
+  u32 rasterized_pixels = 0;
+};
 
-static Tev tev;
-static RasterBlock rasterBlock;
+// The z slope of the last triangle, which keeps being used while zfreeze is enabled.
+static Slope ZSlope;
 
 static std::vector<BPFunctions::ScissorRect> scissors;
 
+// The first context is used by the video thread, the others by the worker threads.
+static std::vector<std::unique_ptr<DrawContext>> s_contexts;
+static std::vector<std::thread> s_worker_threads;
+
+static std::vector<TriangleSetup> s_triangles;
+// Indices into s_triangles of the triangles which overlap each tile.
+static std::array<std::vector<u32>, TILES_X * TILES_Y> s_tile_triangles;
+static std::vector<u32> s_used_tiles;
+// Index into s_used_tiles of the next tile to be drawn by any thread.
+static std::atomic<size_t> s_next_used_tile;
+
+static std::mutex s_worker_mutex;
+static std::condition_variable s_work_available;
+static std::condition_variable s_work_done;
+static u64 s_work_generation = 0;
+static size_t s_busy_worker_threads = 0;
+static bool s_exit_worker_threads = false;
+
+static void WorkerThread(size_t index);
+
 void Init()
 {
   // The other slopes are set each for each primitive drawn, but zfreeze means that the z slope
   // needs to be set to an (untested) default value.
   ZSlope = Slope();
+
+  int num_worker_threads = Config::Get(Config::GFX_SW_RASTERIZER_THREADS);
+  if (num_worker_threads < 0)
+  {
+    // Leave cores for the CPU thread and the rest of the system.
+    num_worker_threads = cpu_info.num_cores - 3;
+  }
+  num_worker_threads = std::clamp(num_worker_threads, 0, MAX_WORKER_THREADS);
+
+  s_contexts.clear();
+  for (int i = 0; i <= num_worker_threads; i++)
+    s_contexts.push_back(std::make_unique<DrawContext>());
+
+  s_work_generation = 0;
+  s_exit_worker_threads = false;
+  for (size_t i = 1; i < s_contexts.size(); i++)
+    s_worker_threads.emplace_back(WorkerThread, i);
+}
+
+void Shutdown()
+{
+  {
+    std::lock_guard lk(s_worker_mutex);
+    s_exit_worker_threads = true;
+  }
+  s_work_available.notify_all();
+
+  for (std::thread& thread : s_worker_threads)
+    thread.join();
+  s_worker_threads.clear();
+
+  s_contexts.clear();
+  s_triangles.clear();
+  for (std::vector<u32>& tile : s_tile_triangles)
+    tile.clear();
+  s_used_tiles.clear();
 }
 
 void ScissorChanged()
@@ -141,31 +252,39 @@ static inline int iround(float x)
   return t;
 }
 
-void SetTevKonstColors()
+void SetTevState()
 {
-  tev.SetKonstColors();
+  for (const auto& context : s_contexts)
+  {
+    context->tev.SetKonstColors();
+    context->tev.SetConfig();
+  }
 }
 
-static void Draw(s32 x, s32 y, s32 xi, s32 yi)
+static void Draw(DrawContext& context, const TriangleSetup& triangle, s32 x, s32 y, s32 xi,
+                 s32 yi)
 {
-  INCSTAT(g_stats.this_frame.rasterized_pixels);
+  Tev& tev = context.tev;
+  const RasterBlock& rasterBlock = context.rasterBlock;
+
+  context.rasterized_pixels++;
 
-  s32 z = (s32)std::clamp<float>(ZSlope.GetValue(x, y), 0.0f, 16777215.0f);
+  s32 z = (s32)std::clamp<float>(triangle.ZSlope.GetValue(x, y), 0.0f, 16777215.0f);
 
   if (bpmem.GetEmulatedZ() == EmulatedZ::Early)
   {
     // TODO: Test if perf regs are incremented even if test is disabled
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_INPUT_ZCOMPLOC);
+    tev.Counters.perf_pixels[PQ_ZCOMP_INPUT_ZCOMPLOC]++;
     if (bpmem.zmode.test_enable)
     {
       // early z
       if (!EfbInterface::ZCompare(x, y, z))
         return;
     }
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_OUTPUT_ZCOMPLOC);
+    tev.Counters.perf_pixels[PQ_ZCOMP_OUTPUT_ZCOMPLOC]++;
   }
 
-  RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
+  const RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
 
   tev.Position[0] = x;
   tev.Position[1] = y;
@@ -176,7 +295,7 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
   {
     for (int comp = 0; comp < 4; comp++)
     {
-      const float color = ColorSlopes[i][comp].GetValue(x, y);
+      const float color = triangle.ColorSlopes[i][comp].GetValue(x, y);
       tev.Color[i][comp] = (u8)std::clamp<float>(color, 0.0f, 255.0f);
     }
   }
@@ -189,6 +308,13 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
     tev.Uv[i].t = (s32)(pixel.Uv[i][1] * 128);
   }
 
+  // The TEV can still read the color channels and the first tex coord when they aren't generated.
+  // Don't let it see values left over from other pixels.
+  for (unsigned int i = bpmem.genMode.numcolchans; i < 2; i++)
+    std::memset(tev.Color[i], 0, sizeof(tev.Color[i]));
+  if (bpmem.genMode.numtexgens == 0)
+    tev.Uv[0] = {};
+
   for (unsigned int i = 0; i < bpmem.genMode.numindstages; i++)
   {
     tev.IndirectLod[i] = rasterBlock.IndirectLod[i];
@@ -204,7 +330,8 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
   tev.Draw();
 }
 
-static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoord)
+static inline void CalculateLOD(const RasterBlock& rasterBlock, s32* lodp, bool* linear,
+                                u32 texmap, u32 texcoord)
 {
   auto texUnit = bpmem.tex.GetUnit(texmap);
 
@@ -215,9 +342,9 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
 
   float sDelta, tDelta;
 
-  float* uv00 = rasterBlock.Pixel[0][0].Uv[texcoord];
-  float* uv10 = rasterBlock.Pixel[1][0].Uv[texcoord];
-  float* uv01 = rasterBlock.Pixel[0][1].Uv[texcoord];
+  const float* uv00 = rasterBlock.Pixel[0][0].Uv[texcoord];
+  const float* uv10 = rasterBlock.Pixel[1][0].Uv[texcoord];
+  const float* uv01 = rasterBlock.Pixel[0][1].Uv[texcoord];
 
   float dudx = fabsf(uv00[0] - uv10[0]);
   float dvdx = fabsf(uv00[1] - uv10[1]);
@@ -255,8 +382,11 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
   *lodp = lod;
 }
 
-static void BuildBlock(s32 blockX, s32 blockY)
+static void BuildBlock(DrawContext& context, const TriangleSetup& triangle, s32 blockX,
+                       s32 blockY)
 {
+  RasterBlock& rasterBlock = context.rasterBlock;
+
   for (s32 yi = 0; yi < BLOCK_SIZE; yi++)
   {
     for (s32 xi = 0; xi < BLOCK_SIZE; xi++)
@@ -266,19 +396,19 @@ static void BuildBlock(s32 blockX, s32 blockY)
       s32 x = xi + blockX;
       s32 y = yi + blockY;
 
-      float invW = 1.0f / WSlope.GetValue(x, y);
+      float invW = 1.0f / triangle.WSlope.GetValue(x, y);
       pixel.InvW = invW;
 
       // tex coords
       for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
       {
         float projection = invW;
-        float q = TexSlopes[i][2].GetValue(x, y) * invW;
+        float q = triangle.TexSlopes[i][2].GetValue(x, y) * invW;
         if (q != 0.0f)
           projection = invW / q;
 
-        pixel.Uv[i][0] = TexSlopes[i][0].GetValue(x, y) * projection;
-        pixel.Uv[i][1] = TexSlopes[i][1].GetValue(x, y) * projection;
+        pixel.Uv[i][0] = triangle.TexSlopes[i][0].GetValue(x, y) * projection;
+        pixel.Uv[i][1] = triangle.TexSlopes[i][1].GetValue(x, y) * projection;
       }
     }
   }
@@ -288,7 +418,8 @@ static void BuildBlock(s32 blockX, s32 blockY)
     u32 texmap = bpmem.tevindref.getTexMap(i);
     u32 texcoord = bpmem.tevindref.getTexCoord(i);
 
-    CalculateLOD(&rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap, texcoord);
+    CalculateLOD(rasterBlock, &rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap,
+                 texcoord);
   }
 
   for (unsigned int i = 0; i <= bpmem.genMode.numtevstages; i++)
@@ -300,7 +431,8 @@ static void BuildBlock(s32 blockX, s32 blockY)
       u32 texmap = order.getTexMap(stageOdd);
       u32 texcoord = order.getTexCoord(stageOdd);
 
-      CalculateLOD(&rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap, texcoord);
+      CalculateLOD(rasterBlock, &rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap,
+                   texcoord);
     }
   }
 }
@@ -317,34 +449,21 @@ void UpdateZSlope(const OutputVertexData* v0, const OutputVertexData* v1,
   }
 }
 
-static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
-                                  const OutputVertexData* v2,
-                                  const BPFunctions::ScissorRect& scissor)
+// Draws the part of a triangle within the given rectangle, which must be aligned to the blocks.
+static void DrawTriangle(DrawContext& context, const TriangleSetup& triangle, s32 minx, s32 maxx,
+                         s32 miny, s32 maxy)
 {
-  // The zslope should be updated now, even if the triangle is rejected by the scissor test, as
-  // zfreeze depends on it
-  UpdateZSlope(v0, v1, v2, scissor.x_off, scissor.y_off);
-
-  // adapted from http://devmaster.net/posts/6145/advanced-rasterization
-
-  // 28.4 fixed-point coordinates. rounded to nearest and adjusted to match hardware output
-  // could also take floor and adjust -8
-  const s32 Y1 = iround(16.0f * (v0->screenPosition.y - scissor.y_off)) - 9;
-  const s32 Y2 = iround(16.0f * (v1->screenPosition.y - scissor.y_off)) - 9;
-  const s32 Y3 = iround(16.0f * (v2->screenPosition.y - scissor.y_off)) - 9;
+  const s32 C1 = triangle.C1;
+  const s32 C2 = triangle.C2;
+  const s32 C3 = triangle.C3;
 
-  const s32 X1 = iround(16.0f * (v0->screenPosition.x - scissor.x_off)) - 9;
-  const s32 X2 = iround(16.0f * (v1->screenPosition.x - scissor.x_off)) - 9;
-  const s32 X3 = iround(16.0f * (v2->screenPosition.x - scissor.x_off)) - 9;
-
-  // Deltas
-  const s32 DX12 = X1 - X2;
-  const s32 DX23 = X2 - X3;
-  const s32 DX31 = X3 - X1;
+  const s32 DX12 = triangle.DX12;
+  const s32 DX23 = triangle.DX23;
+  const s32 DX31 = triangle.DX31;
 
-  const s32 DY12 = Y1 - Y2;
-  const s32 DY23 = Y2 - Y3;
-  const s32 DY31 = Y3 - Y1;
+  const s32 DY12 = triangle.DY12;
+  const s32 DY23 = triangle.DY23;
+  const s32 DY31 = triangle.DY31;
 
   // Fixed-point deltas
   const s32 FDX12 = DX12 * 16;
@@ -355,69 +474,12 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
   const s32 FDY23 = DY23 * 16;
   const s32 FDY31 = DY31 * 16;
 
-  // Bounding rectangle
-  s32 minx = (std::min(std::min(X1, X2), X3) + 0xF) >> 4;
-  s32 maxx = (std::max(std::max(X1, X2), X3) + 0xF) >> 4;
-  s32 miny = (std::min(std::min(Y1, Y2), Y3) + 0xF) >> 4;
-  s32 maxy = (std::max(std::max(Y1, Y2), Y3) + 0xF) >> 4;
-
-  // scissor
-  ASSERT(scissor.rect.left >= 0);
-  ASSERT(scissor.rect.right <= static_cast<int>(EFB_WIDTH));
-  ASSERT(scissor.rect.top >= 0);
-  ASSERT(scissor.rect.bottom <= static_cast<int>(EFB_HEIGHT));
-
-  minx = std::max(minx, scissor.rect.left);
-  maxx = std::min(maxx, scissor.rect.right);
-  miny = std::max(miny, scissor.rect.top);
-  maxy = std::min(maxy, scissor.rect.bottom);
-
-  if (minx >= maxx || miny >= maxy)
-    return;
-
-  // Set up the remaining slopes
-  const SlopeContext ctx(v0, v1, v2, (X1 + 0xF) >> 4, (Y1 + 0xF) >> 4, scissor.x_off,
-                         scissor.y_off);
-
-  float w[3] = {1.0f / v0->projectedPosition.w, 1.0f / v1->projectedPosition.w,
-                1.0f / v2->projectedPosition.w};
-  WSlope = Slope(w[0], w[1], w[2], ctx);
-
-  for (unsigned int i = 0; i < bpmem.genMode.numcolchans; i++)
-  {
-    for (int comp = 0; comp < 4; comp++)
-      ColorSlopes[i][comp] = Slope(v0->color[i][comp], v1->color[i][comp], v2->color[i][comp], ctx);
-  }
-
-  for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
-  {
-    TexSlopes[i][0] =
-        Slope(v0->texCoords[i].x * w[0], v1->texCoords[i].x * w[1], v2->texCoords[i].x * w[2], ctx);
-    TexSlopes[i][1] =
-        Slope(v0->texCoords[i].y * w[0], v1->texCoords[i].y * w[1], v2->texCoords[i].y * w[2], ctx);
-    TexSlopes[i][2] =
-        Slope(v0->texCoords[i].z * w[0], v1->texCoords[i].z * w[1], v2->texCoords[i].z * w[2], ctx);
-  }
-
-  // Half-edge constants
-  s32 C1 = DY12 * X1 - DX12 * Y1;
-  s32 C2 = DY23 * X2 - DX23 * Y2;
-  s32 C3 = DY31 * X3 - DX31 * Y3;
-
-  // Correct for fill convention
-  if (DY12 < 0 || (DY12 == 0 && DX12 > 0))
-    C1++;
-  if (DY23 < 0 || (DY23 == 0 && DX23 > 0))
-    C2++;
-  if (DY31 < 0 || (DY31 == 0 && DX31 > 0))
-    C3++;
-
   // Start in corner of 2x2 block
   s32 block_minx = minx & ~(BLOCK_SIZE - 1);
   s32 block_miny = miny & ~(BLOCK_SIZE - 1);
 
   // Loop through blocks
-  for (s32 y = block_miny & ~(BLOCK_SIZE - 1); y < maxy; y += BLOCK_SIZE)
+  for (s32 y = block_miny; y < maxy; y += BLOCK_SIZE)
   {
     for (s32 x = block_minx; x < maxx; x += BLOCK_SIZE)
     {
@@ -453,7 +515,7 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
       if (a == 0x0 || b == 0x0 || c == 0x0)
         continue;
 
-      BuildBlock(x, y);
+      BuildBlock(context, triangle, x, y);
 
       // Accept whole block when totally covered
       // We still need to check min/max x/y because of the scissor
@@ -463,7 +525,7 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
         {
           for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
           {
-            Draw(x + ix, y + iy, ix, iy);
+            Draw(context, triangle, x + ix, y + iy, ix, iy);
           }
         }
       }
@@ -486,7 +548,7 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
               // This check enforces the scissor rectangle, since it might not be aligned with the
               // blocks
               if (x + ix >= minx && x + ix < maxx && y + iy >= miny && y + iy < maxy)
-                Draw(x + ix, y + iy, ix, iy);
+                Draw(context, triangle, x + ix, y + iy, ix, iy);
             }
 
             CX1 -= FDY12;
@@ -503,6 +565,185 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
   }
 }
 
+static void QueueTriangle(const TriangleSetup& triangle)
+{
+  const u32 index = static_cast<u32>(s_triangles.size());
+  s_triangles.push_back(triangle);
+
+  for (s32 tile_y = triangle.miny / TILE_SIZE; tile_y <= (triangle.maxy - 1) / TILE_SIZE; tile_y++)
+  {
+    for (s32 tile_x = triangle.minx / TILE_SIZE; tile_x <= (triangle.maxx - 1) / TILE_SIZE;
+         tile_x++)
+    {
+      const u32 tile = tile_y * TILES_X + tile_x;
+      if (s_tile_triangles[tile].empty())
+        s_used_tiles.push_back(tile);
+      s_tile_triangles[tile].push_back(index);
+    }
+  }
+}
+
+static void DrawTiles(DrawContext& context)
+{
+  size_t i;
+  while ((i = s_next_used_tile.fetch_add(1, std::memory_order_relaxed)) < s_used_tiles.size())
+  {
+    const u32 tile = s_used_tiles[i];
+    const s32 tile_minx = static_cast<s32>(tile % TILES_X) * TILE_SIZE;
+    const s32 tile_miny = static_cast<s32>(tile / TILES_X) * TILE_SIZE;
+
+    for (const u32 index : s_tile_triangles[tile])
+    {
+      const TriangleSetup& triangle = s_triangles[index];
+      DrawTriangle(context, triangle, std::max(triangle.minx, tile_minx),
+                   std::min(triangle.maxx, tile_minx + TILE_SIZE),
+                   std::max(triangle.miny, tile_miny),
+                   std::min(triangle.maxy, tile_miny + TILE_SIZE));
+    }
+  }
+}
+
+static void WorkerThread(size_t index)
+{
+  Common::SetCurrentThreadName(fmt::format("Software Rasterizer {}", index).c_str());
+
+  DrawContext& context = *s_contexts[index];
+  u64 generation = 0;
+
+  while (true)
+  {
+    {
+      std::unique_lock lk(s_worker_mutex);
+      s_work_available.wait(
+          lk, [&] { return s_exit_worker_threads || s_work_generation != generation; });
+      if (s_exit_worker_threads)
+        return;
+      generation = s_work_generation;
+    }
+
+    DrawTiles(context);
+
+    {
+      std::lock_guard lk(s_worker_mutex);
+      if (--s_busy_worker_threads == 0)
+        s_work_done.notify_one();
+    }
+  }
+}
+
+static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
+                                  const OutputVertexData* v2,
+                                  const BPFunctions::ScissorRect& scissor)
+{
+  // The zslope should be updated now, even if the triangle is rejected by the scissor test, as
+  // zfreeze depends on it
+  UpdateZSlope(v0, v1, v2, scissor.x_off, scissor.y_off);
+
+  // adapted from http://devmaster.net/posts/6145/advanced-rasterization
+
+  // 28.4 fixed-point coordinates. rounded to nearest and adjusted to match hardware output
+  // could also take floor and adjust -8
+  const s32 Y1 = iround(16.0f * (v0->screenPosition.y - scissor.y_off)) - 9;
+  const s32 Y2 = iround(16.0f * (v1->screenPosition.y - scissor.y_off)) - 9;
+  const s32 Y3 = iround(16.0f * (v2->screenPosition.y - scissor.y_off)) - 9;
+
+  const s32 X1 = iround(16.0f * (v0->screenPosition.x - scissor.x_off)) - 9;
+  const s32 X2 = iround(16.0f * (v1->screenPosition.x - scissor.x_off)) - 9;
+  const s32 X3 = iround(16.0f * (v2->screenPosition.x - scissor.x_off)) - 9;
+
+  // Bounding rectangle
+  s32 minx = (std::min(std::min(X1, X2), X3) + 0xF) >> 4;
+  s32 maxx = (std::max(std::max(X1, X2), X3) + 0xF) >> 4;
+  s32 miny = (std::min(std::min(Y1, Y2), Y3) + 0xF) >> 4;
+  s32 maxy = (std::max(std::max(Y1, Y2), Y3) + 0xF) >> 4;
+
+  // scissor
+  ASSERT(scissor.rect.left >= 0);
+  ASSERT(scissor.rect.right <= static_cast<int>(EFB_WIDTH));
+  ASSERT(scissor.rect.top >= 0);
+  ASSERT(scissor.rect.bottom <= static_cast<int>(EFB_HEIGHT));
+
+  minx = std::max(minx, scissor.rect.left);
+  maxx = std::min(maxx, scissor.rect.right);
+  miny = std::max(miny, scissor.rect.top);
+  maxy = std::min(maxy, scissor.rect.bottom);
+
+  if (minx >= maxx || miny >= maxy)
+    return;
+
+  TriangleSetup triangle;
+  triangle.minx = minx;
+  triangle.maxx = maxx;
+  triangle.miny = miny;
+  triangle.maxy = maxy;
+
+  // Set up the remaining slopes
+  const SlopeContext ctx(v0, v1, v2, (X1 + 0xF) >> 4, (Y1 + 0xF) >> 4, scissor.x_off,
+                         scissor.y_off);
+
+  triangle.ZSlope = ZSlope;
+
+  float w[3] = {1.0f / v0->projectedPosition.w, 1.0f / v1->projectedPosition.w,
+                1.0f / v2->projectedPosition.w};
+  triangle.WSlope = Slope(w[0], w[1], w[2], ctx);
+
+  for (unsigned int i = 0; i < bpmem.genMode.numcolchans; i++)
+  {
+    for (int comp = 0; comp < 4; comp++)
+    {
+      triangle.ColorSlopes[i][comp] =
+          Slope(v0->color[i][comp], v1->color[i][comp], v2->color[i][comp], ctx);
+    }
+  }
+
+  for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
+  {
+    triangle.TexSlopes[i][0] =
+        Slope(v0->texCoords[i].x * w[0], v1->texCoords[i].x * w[1], v2->texCoords[i].x * w[2], ctx);
+    triangle.TexSlopes[i][1] =
+        Slope(v0->texCoords[i].y * w[0], v1->texCoords[i].y * w[1], v2->texCoords[i].y * w[2], ctx);
+    triangle.TexSlopes[i][2] =
+        Slope(v0->texCoords[i].z * w[0], v1->texCoords[i].z * w[1], v2->texCoords[i].z * w[2], ctx);
+  }
+
+  // Deltas
+  const s32 DX12 = X1 - X2;
+  const s32 DX23 = X2 - X3;
+  const s32 DX31 = X3 - X1;
+
+  const s32 DY12 = Y1 - Y2;
+  const s32 DY23 = Y2 - Y3;
+  const s32 DY31 = Y3 - Y1;
+
+  // Half-edge constants
+  s32 C1 = DY12 * X1 - DX12 * Y1;
+  s32 C2 = DY23 * X2 - DX23 * Y2;
+  s32 C3 = DY31 * X3 - DX31 * Y3;
+
+  // Correct for fill convention
+  if (DY12 < 0 || (DY12 == 0 && DX12 > 0))
+    C1++;
+  if (DY23 < 0 || (DY23 == 0 && DX23 > 0))
+    C2++;
+  if (DY31 < 0 || (DY31 == 0 && DX31 > 0))
+    C3++;
+
+  triangle.C1 = C1;
+  triangle.C2 = C2;
+  triangle.C3 = C3;
+  triangle.DX12 = DX12;
+  triangle.DX23 = DX23;
+  triangle.DX31 = DX31;
+  triangle.DY12 = DY12;
+  triangle.DY23 = DY23;
+  triangle.DY31 = DY31;
+
+  if (s_worker_threads.empty())
+    DrawTriangle(*s_contexts[0], triangle, minx, maxx, miny, maxy);
+  else
+    QueueTriangle(triangle);
+}
+
 void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
                            const OutputVertexData* v2)
 {
@@ -511,4 +752,63 @@ void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v
   for (const auto& scissor : scissors)
     DrawTriangleFrontFace(v0, v1, v2, scissor);
 }
+
+void Flush()
+{
+  if (!s_used_tiles.empty())
+  {
+    s_next_used_tile.store(0, std::memory_order_relaxed);
+
+    // Waking up the worker threads isn't worth it if there's only a single tile to draw.
+    const bool use_worker_threads = s_used_tiles.size() > 1;
+    if (use_worker_threads)
+    {
+      {
+        std::lock_guard lk(s_worker_mutex);
+        s_busy_worker_threads = s_worker_threads.size();
+        s_work_generation++;
+      }
+      s_work_available.notify_all();
+    }
+
+    DrawTiles(*s_contexts[0]);
+
+    if (use_worker_threads)
+    {
+      std::unique_lock lk(s_worker_mutex);
+      s_work_done.wait(lk, [] { return s_busy_worker_threads == 0; });
+    }
+
+    for (const u32 tile : s_used_tiles)
+      s_tile_triangles[tile].clear();
+    s_used_tiles.clear();
+    s_triangles.clear();
+  }
+
+  // All of these are sums or minimums and maximums, so the order of the contexts doesn't matter.
+  for (const auto& context : s_contexts)
+  {
+    Tev::DrawCounters& counters = context->tev.Counters;
+
+    ADDSTAT(g_stats.this_frame.rasterized_pixels, context->rasterized_pixels);
+    ADDSTAT(g_stats.this_frame.tev_pixels_in, counters.pixels_in);
+    ADDSTAT(g_stats.this_frame.tev_pixels_out, counters.pixels_out);
+
+    for (int i = 0; i < PQ_NUM_MEMBERS; i++)
+    {
+      const auto type = static_cast<PerfQueryType>(i);
+      if (counters.perf_pixels[type] != 0)
+        EfbInterface::AddPerfCounterPixelCount(type, counters.perf_pixels[type]);
+    }
+
+    if (counters.pixels_out != 0)
+    {
+      BBoxManager::Update(counters.bbox_left, counters.bbox_right, counters.bbox_top,
+                          counters.bbox_bottom);
+    }
+
+    counters = {};
+    context->rasterized_pixels = 0;
+  }
+}
 }  // namespace Rasterizer
@@ -10,6 +10,7 @@ struct OutputVertexData;
 namespace Rasterizer
 {
 void Init();
+void Shutdown();
 void ScissorChanged();
 
 void UpdateZSlope(const OutputVertexData* v0, const OutputVertexData* v1,
@@ -17,7 +18,12 @@ void UpdateZSlope(const OutputVertexData* v0, const OutputVertexData* v1,
 void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
                            const OutputVertexData* v2);
 
-void SetTevKonstColors();
+// Loads the TEV state which stays the same for a whole batch.
+void SetTevState();
+
+// Finishes drawing all triangles, and adds their pixels to the statistics, performance counters
+// and bounding box. Must be called before anything reads the EFB or changes the drawing state.
+void Flush();
 
 struct RasterBlockPixel
 {
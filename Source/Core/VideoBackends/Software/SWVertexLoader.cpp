@@ -63,7 +63,7 @@ void SWVertexLoader::DrawCurrentBatch(u32 base_index, u32 num_indices, u32 base_
     g_bounding_box->Flush();
 
   m_setup_unit.Init(primitive_type);
-  Rasterizer::SetTevKonstColors();
+  Rasterizer::SetTevState();
 
   for (u32 i = 0; i < m_index_generator.GetIndexLen(); i++)
   {
@@ -87,6 +87,8 @@ void SWVertexLoader::DrawCurrentBatch(u32 base_index, u32 num_indices, u32 base_
     INCSTAT(g_stats.this_frame.num_vertices_loaded);
   }
 
+  Rasterizer::Flush();
+
   INCSTAT(g_stats.this_frame.num_drawn_objects);
 }
 
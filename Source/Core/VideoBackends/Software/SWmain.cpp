@@ -11,6 +11,7 @@
 #include "Common/CommonTypes.h"
 
 #include "VideoBackends/Software/Clipper.h"
+#include "VideoBackends/Software/PixelMath.h"
 #include "VideoBackends/Software/Rasterizer.h"
 #include "VideoBackends/Software/SWBoundingBox.h"
 #include "VideoBackends/Software/SWEfbInterface.h"
@@ -96,6 +97,7 @@ bool VideoSoftware::Initialize(const WindowSystemInfo& wsi)
     return false;
 
   Clipper::Init();
+  PixelMath::Init();
   Rasterizer::Init();
 
   return InitializeShared(std::make_unique<SWGfx>(std::move(window)),
@@ -107,5 +109,7 @@ bool VideoSoftware::Initialize(const WindowSystemInfo& wsi)
 void VideoSoftware::Shutdown()
 {
   ShutdownShared();
+
+  Rasterizer::Shutdown();
 }
 }  // namespace SW
@@ -6,18 +6,18 @@
 #include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <unordered_map>
 
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
+#include "Common/Hash.h"
 
 #include "Core/System.h"
 
-#include "VideoBackends/Software/SWBoundingBox.h"
 #include "VideoBackends/Software/SWEfbInterface.h"
 #include "VideoBackends/Software/TextureSampler.h"
 
 #include "VideoCommon/PixelShaderManager.h"
-#include "VideoCommon/Statistics.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/XFMemory.h"
 
@@ -31,14 +31,90 @@ static inline s16 Clamp1024(s16 in)
   return std::clamp<s16>(in, -1024, 1023);
 }
 
-void Tev::SetRasColor(RasColorChan colorChan, u32 swaptable)
+struct Tev::StageConfig
+{
+  TevStageCombiner::ColorCombiner cc;
+  TevStageCombiner::AlphaCombiner ac;
+
+  // The tex coord after applying the quirk for tex coords which don't exist
+  u32 texcoord;
+  u32 texmap;
+  bool texture_enabled;
+  SwapTable tex_swap;
+  SwapTable ras_swap;
+  RasColorChan color_chan;
+  KonstSel konst_color;
+  KonstSel konst_alpha;
+
+  // Whether the indirect unit passes the tex coord through unchanged and doesn't bump alpha
+  bool direct;
+
+  // Whether the color and alpha combiners are both regular, so that all channels are computed at
+  // once with combiner_params.
+  bool use_vector_combiner;
+  PixelMath::CombinerParams combiner_params;
+};
+
+struct Tev::Config
+{
+  struct IndirectStage
+  {
+    u32 texcoord;
+    u32 texmap;
+    s32 scale_s;
+    s32 scale_t;
+  };
+
+  bool has_texgens;
+  u32 num_ind_stages;
+  u32 num_tev_stages;
+  std::array<IndirectStage, 4> ind_stages;
+  std::array<StageConfig, 16> stages;
+
+  void (Tev::*draw_stages)();
+};
+
+namespace
+{
+// The bpmem registers which a Tev::Config is decoded from. Registers of stages which aren't used
+// are left zeroed, so that they don't cause needless misses.
+struct ConfigKey
+{
+  u32 num_texgens;
+  u32 num_ind_stages;
+  u32 num_tev_stages;
+  u32 tevindref;
+  std::array<u32, 2> texscale;
+  std::array<u32, 8> tevorders;
+  std::array<u32, 8> tevksel;
+  std::array<u32, 16> tevind;
+  std::array<u32, 16> color_combiners;
+  std::array<u32, 16> alpha_combiners;
+
+  bool operator==(const ConfigKey&) const = default;
+};
+
+struct ConfigKeyHash
+{
+  size_t operator()(const ConfigKey& key) const
+  {
+    return static_cast<size_t>(
+        Common::GetHash64(reinterpret_cast<const u8*>(&key), sizeof(ConfigKey), 0));
+  }
+};
+
+// Games only use a limited set of configurations, so this is plenty. The cache is cleared when it
+// grows beyond that rather than tracking which entries were used last.
+constexpr size_t MAX_CACHED_CONFIGS = 1024;
+}  // namespace
+
+void Tev::SetRasColor(RasColorChan colorChan, const SwapTable& swap)
 {
   switch (colorChan)
   {
   case RasColorChan::Color0:
   {
     const u8* color = Color[0];
-    const auto& swap = bpmem.tevksel.GetSwapTable(swaptable);
     RasColor.r = color[u32(swap[ColorChannel::Red])];
     RasColor.g = color[u32(swap[ColorChannel::Green])];
     RasColor.b = color[u32(swap[ColorChannel::Blue])];
@@ -48,7 +124,6 @@ void Tev::SetRasColor(RasColorChan colorChan, u32 swaptable)
   case RasColorChan::Color1:
   {
     const u8* color = Color[1];
-    const auto& swap = bpmem.tevksel.GetSwapTable(swaptable);
     RasColor.r = color[u32(swap[ColorChannel::Red])];
     RasColor.g = color[u32(swap[ColorChannel::Green])];
     RasColor.b = color[u32(swap[ColorChannel::Blue])];
@@ -190,6 +265,30 @@ void Tev::DrawAlphaCompare(const TevStageCombiner::AlphaCombiner& ac, const Inpu
     Reg[ac.dest].a = inputs[ALP_C].d + ((a == b) ? inputs[ALP_C].c : 0);
 }
 
+void Tev::DrawVector(const TevStageCombiner::ColorCombiner& cc,
+                     const TevStageCombiner::AlphaCombiner& ac,
+                     const PixelMath::CombinerParams& params)
+{
+  const TevColorRef& color_a = m_ColorInputLUT[cc.a];
+  const TevColorRef& color_b = m_ColorInputLUT[cc.b];
+  const TevColorRef& color_c = m_ColorInputLUT[cc.c];
+  const TevColorRef& color_d = m_ColorInputLUT[cc.d];
+
+  PixelMath::CombinerInputs inputs;
+  inputs.a = {m_AlphaInputLUT[ac.a].a, color_a.b, color_a.g, color_a.r};
+  inputs.b = {m_AlphaInputLUT[ac.b].a, color_b.b, color_b.g, color_b.r};
+  inputs.c = {m_AlphaInputLUT[ac.c].a, color_c.b, color_c.g, color_c.r};
+  inputs.d = {m_AlphaInputLUT[ac.d].a, color_d.b, color_d.g, color_d.r};
+
+  PixelMath::Channels result;
+  PixelMath::Combine(inputs, params, &result);
+
+  Reg[cc.dest].b = result[BLU_C];
+  Reg[cc.dest].g = result[GRN_C];
+  Reg[cc.dest].r = result[RED_C];
+  Reg[ac.dest].a = result[ALP_C];
+}
+
 static bool AlphaCompare(int alpha, int ref, CompareMode comp)
 {
   switch (comp)
@@ -384,79 +483,51 @@ void Tev::Indirect(unsigned int stageNum, s32 s, s32 t)
   }
 }
 
-void Tev::Draw()
+template <bool HasIndirect>
+void Tev::DrawStages()
 {
-  ASSERT(Position[0] >= 0 && Position[0] < s32(EFB_WIDTH));
-  ASSERT(Position[1] >= 0 && Position[1] < s32(EFB_HEIGHT));
+  const Config& config = *m_Config;
 
-  INCSTAT(g_stats.this_frame.tev_pixels_in);
-
-  auto& system = Core::System::GetInstance();
-  auto& pixel_shader_manager = system.GetPixelShaderManager();
-
-  // initial color values
-  for (int i = 0; i < 4; i++)
+  if constexpr (HasIndirect)
   {
-    Reg[static_cast<TevOutput>(i)].r = pixel_shader_manager.constants.colors[i][0];
-    Reg[static_cast<TevOutput>(i)].g = pixel_shader_manager.constants.colors[i][1];
-    Reg[static_cast<TevOutput>(i)].b = pixel_shader_manager.constants.colors[i][2];
-    Reg[static_cast<TevOutput>(i)].a = pixel_shader_manager.constants.colors[i][3];
-  }
-
-  for (unsigned int stageNum = 0; stageNum < bpmem.genMode.numindstages; stageNum++)
-  {
-    const int stageNum2 = stageNum >> 1;
-    const int stageOdd = stageNum & 1;
-
-    u32 texcoordSel = bpmem.tevindref.getTexCoord(stageNum);
-    const u32 texmap = bpmem.tevindref.getTexMap(stageNum);
-
-    // Quirk: when the tex coord is not less than the number of tex gens (i.e. the tex coord does
-    // not exist), then tex coord 0 is used (though sometimes glitchy effects happen on console).
-    // This affects the Mario portrait in Luigi's Mansion, where the developers forgot to set
-    // the number of tex gens to 2 (bug 11462).
-    if (texcoordSel >= bpmem.genMode.numtexgens)
-      texcoordSel = 0;
-
-    const TEXSCALE& texscale = bpmem.texscale[stageNum2];
-    const s32 scaleS = stageOdd ? texscale.ss1 : texscale.ss0;
-    const s32 scaleT = stageOdd ? texscale.ts1 : texscale.ts0;
+    for (u32 stageNum = 0; stageNum < config.num_ind_stages; stageNum++)
+    {
+      const Config::IndirectStage& stage = config.ind_stages[stageNum];
+      const TextureCoordinateType& uv = Uv[stage.texcoord];
 
-    TextureSampler::Sample(Uv[texcoordSel].s >> scaleS, Uv[texcoordSel].t >> scaleT,
-                           IndirectLod[stageNum], IndirectLinear[stageNum], texmap,
-                           IndirectTex[stageNum]);
+      TextureSampler::Sample(uv.s >> stage.scale_s, uv.t >> stage.scale_t, IndirectLod[stageNum],
+                             IndirectLinear[stageNum], stage.texmap, IndirectTex[stageNum]);
+    }
   }
 
-  for (unsigned int stageNum = 0; stageNum <= bpmem.genMode.numtevstages; stageNum++)
+  for (u32 stageNum = 0; stageNum < config.num_tev_stages; stageNum++)
   {
-    const int stageNum2 = stageNum >> 1;
-    const int stageOdd = stageNum & 1;
-    const TwoTevStageOrders& order = bpmem.tevorders[stageNum2];
-
-    // stage combiners
-    const TevStageCombiner::ColorCombiner& cc = bpmem.combiners[stageNum].colorC;
-    const TevStageCombiner::AlphaCombiner& ac = bpmem.combiners[stageNum].alphaC;
-
-    u32 texcoordSel = order.getTexCoord(stageOdd);
-    const u32 texmap = order.getTexMap(stageOdd);
-
-    // Quirk: when the tex coord is not less than the number of tex gens (i.e. the tex coord does
-    // not exist), then tex coord 0 is used (though sometimes glitchy effects happen on console).
-    if (texcoordSel >= bpmem.genMode.numtexgens)
-      texcoordSel = 0;
+    const StageConfig& stage = config.stages[stageNum];
+    const TevStageCombiner::ColorCombiner& cc = stage.cc;
+    const TevStageCombiner::AlphaCombiner& ac = stage.ac;
+    const TextureCoordinateType& uv = Uv[stage.texcoord];
 
-    Indirect(stageNum, Uv[texcoordSel].s, Uv[texcoordSel].t);
+    if (HasIndirect && !stage.direct)
+    {
+      Indirect(stageNum, uv.s, uv.t);
+    }
+    else
+    {
+      AlphaBump = 0;
+      TexCoord.s = uv.s;
+      TexCoord.t = uv.t;
+    }
 
     // sample texture
-    if (order.getEnable(stageOdd))
+    if (stage.texture_enabled)
     {
       // RGBA
       u8 texel[4];
 
-      if (bpmem.genMode.numtexgens > 0)
+      if (config.has_texgens)
       {
         TextureSampler::Sample(TexCoord.s, TexCoord.t, TextureLod[stageNum],
-                               TextureLinear[stageNum], texmap, texel);
+                               TextureLinear[stageNum], stage.texmap, texel);
       }
       else
       {
@@ -470,47 +541,56 @@ void Tev::Draw()
       RawTexColor.b = texel[u32(ColorChannel::Blue)];
       RawTexColor.a = texel[u32(ColorChannel::Alpha)];
 
-      const auto& swap = bpmem.tevksel.GetSwapTable(ac.tswap);
-      TexColor.r = texel[u32(swap[ColorChannel::Red])];
-      TexColor.g = texel[u32(swap[ColorChannel::Green])];
-      TexColor.b = texel[u32(swap[ColorChannel::Blue])];
-      TexColor.a = texel[u32(swap[ColorChannel::Alpha])];
+      TexColor.r = texel[u32(stage.tex_swap[ColorChannel::Red])];
+      TexColor.g = texel[u32(stage.tex_swap[ColorChannel::Green])];
+      TexColor.b = texel[u32(stage.tex_swap[ColorChannel::Blue])];
+      TexColor.a = texel[u32(stage.tex_swap[ColorChannel::Alpha])];
     }
 
     // set konst for this stage
-    const auto kc = bpmem.tevksel.GetKonstColor(stageNum);
-    const auto ka = bpmem.tevksel.GetKonstAlpha(stageNum);
-    StageKonst.r = m_KonstLUT[kc].r;
-    StageKonst.g = m_KonstLUT[kc].g;
-    StageKonst.b = m_KonstLUT[kc].b;
-    StageKonst.a = m_KonstLUT[ka].a;
+    StageKonst.r = m_KonstLUT[stage.konst_color].r;
+    StageKonst.g = m_KonstLUT[stage.konst_color].g;
+    StageKonst.b = m_KonstLUT[stage.konst_color].b;
+    StageKonst.a = m_KonstLUT[stage.konst_alpha].a;
 
     // set color
-    SetRasColor(order.getColorChan(stageOdd), ac.rswap);
+    SetRasColor(stage.color_chan, stage.ras_swap);
 
     // combine inputs
-    InputRegType inputs[4];
-    inputs[BLU_C].a = m_ColorInputLUT[cc.a].b;
-    inputs[BLU_C].b = m_ColorInputLUT[cc.b].b;
-    inputs[BLU_C].c = m_ColorInputLUT[cc.c].b;
-    inputs[BLU_C].d = m_ColorInputLUT[cc.d].b;
-    inputs[GRN_C].a = m_ColorInputLUT[cc.a].g;
-    inputs[GRN_C].b = m_ColorInputLUT[cc.b].g;
-    inputs[GRN_C].c = m_ColorInputLUT[cc.c].g;
-    inputs[GRN_C].d = m_ColorInputLUT[cc.d].g;
-    inputs[RED_C].a = m_ColorInputLUT[cc.a].r;
-    inputs[RED_C].b = m_ColorInputLUT[cc.b].r;
-    inputs[RED_C].c = m_ColorInputLUT[cc.c].r;
-    inputs[RED_C].d = m_ColorInputLUT[cc.d].r;
-    inputs[ALP_C].a = m_AlphaInputLUT[ac.a].a;
-    inputs[ALP_C].b = m_AlphaInputLUT[ac.b].a;
-    inputs[ALP_C].c = m_AlphaInputLUT[ac.c].a;
-    inputs[ALP_C].d = m_AlphaInputLUT[ac.d].a;
-
-    if (cc.bias != TevBias::Compare)
-      DrawColorRegular(cc, inputs);
+    if (stage.use_vector_combiner)
+    {
+      DrawVector(cc, ac, stage.combiner_params);
+    }
     else
-      DrawColorCompare(cc, inputs);
+    {
+      InputRegType inputs[4];
+      inputs[BLU_C].a = m_ColorInputLUT[cc.a].b;
+      inputs[BLU_C].b = m_ColorInputLUT[cc.b].b;
+      inputs[BLU_C].c = m_ColorInputLUT[cc.c].b;
+      inputs[BLU_C].d = m_ColorInputLUT[cc.d].b;
+      inputs[GRN_C].a = m_ColorInputLUT[cc.a].g;
+      inputs[GRN_C].b = m_ColorInputLUT[cc.b].g;
+      inputs[GRN_C].c = m_ColorInputLUT[cc.c].g;
+      inputs[GRN_C].d = m_ColorInputLUT[cc.d].g;
+      inputs[RED_C].a = m_ColorInputLUT[cc.a].r;
+      inputs[RED_C].b = m_ColorInputLUT[cc.b].r;
+      inputs[RED_C].c = m_ColorInputLUT[cc.c].r;
+      inputs[RED_C].d = m_ColorInputLUT[cc.d].r;
+      inputs[ALP_C].a = m_AlphaInputLUT[ac.a].a;
+      inputs[ALP_C].b = m_AlphaInputLUT[ac.b].a;
+      inputs[ALP_C].c = m_AlphaInputLUT[ac.c].a;
+      inputs[ALP_C].d = m_AlphaInputLUT[ac.d].a;
+
+      if (cc.bias != TevBias::Compare)
+        DrawColorRegular(cc, inputs);
+      else
+        DrawColorCompare(cc, inputs);
+
+      if (ac.bias != TevBias::Compare)
+        DrawAlphaRegular(ac, inputs);
+      else
+        DrawAlphaCompare(ac, inputs);
+    }
 
     if (cc.clamp)
     {
@@ -525,22 +605,47 @@ void Tev::Draw()
       Reg[cc.dest].b = Clamp1024(Reg[cc.dest].b);
     }
 
-    if (ac.bias != TevBias::Compare)
-      DrawAlphaRegular(ac, inputs);
-    else
-      DrawAlphaCompare(ac, inputs);
-
     if (ac.clamp)
       Reg[ac.dest].a = Clamp255(Reg[ac.dest].a);
     else
       Reg[ac.dest].a = Clamp1024(Reg[ac.dest].a);
   }
+}
+
+void Tev::Draw()
+{
+  ASSERT(Position[0] >= 0 && Position[0] < s32(EFB_WIDTH));
+  ASSERT(Position[1] >= 0 && Position[1] < s32(EFB_HEIGHT));
+
+  ++Counters.pixels_in;
+
+  // Stages without a texture and indirect stages which don't exist read whatever was left over
+  // from the previous pixel. Reset these, so that the result doesn't depend on which pixels this
+  // instance drew before.
+  RawTexColor = {};
+  TexColor = {};
+  std::memset(IndirectTex, 0, sizeof(IndirectTex));
+
+  auto& system = Core::System::GetInstance();
+  auto& pixel_shader_manager = system.GetPixelShaderManager();
+
+  // initial color values
+  for (int i = 0; i < 4; i++)
+  {
+    Reg[static_cast<TevOutput>(i)].r = pixel_shader_manager.constants.colors[i][0];
+    Reg[static_cast<TevOutput>(i)].g = pixel_shader_manager.constants.colors[i][1];
+    Reg[static_cast<TevOutput>(i)].b = pixel_shader_manager.constants.colors[i][2];
+    Reg[static_cast<TevOutput>(i)].a = pixel_shader_manager.constants.colors[i][3];
+  }
+
+  (this->*m_Config->draw_stages)();
 
   // convert to 8 bits per component
   // the results of the last tev stage are put onto the screen,
   // regardless of the used destination register - TODO: Verify!
-  const auto& color_index = bpmem.combiners[bpmem.genMode.numtevstages].colorC.dest;
-  const auto& alpha_index = bpmem.combiners[bpmem.genMode.numtevstages].alphaC.dest;
+  const StageConfig& last_stage = m_Config->stages[m_Config->num_tev_stages - 1];
+  const auto& color_index = last_stage.cc.dest;
+  const auto& alpha_index = last_stage.ac.dest;
   u8 output[4] = {(u8)Reg[alpha_index].a, (u8)Reg[color_index].b, (u8)Reg[color_index].g,
                   (u8)Reg[color_index].r};
 
@@ -663,25 +768,152 @@ void Tev::Draw()
   if (bpmem.GetEmulatedZ() == EmulatedZ::Late)
   {
     // TODO: Check against hw if these values get incremented even if depth testing is disabled
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_INPUT);
+    ++Counters.perf_pixels[PQ_ZCOMP_INPUT];
 
     if (!EfbInterface::ZCompare(Position[0], Position[1], Position[2]))
       return;
 
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_OUTPUT);
+    ++Counters.perf_pixels[PQ_ZCOMP_OUTPUT];
   }
 
   // The GC/Wii GPU rasterizes in 2x2 pixel groups, so bounding box values will be rounded to the
   // extents of these groups, rather than the exact pixel.
-  BBoxManager::Update(static_cast<u16>(Position[0] & ~1), static_cast<u16>(Position[0] | 1),
-                      static_cast<u16>(Position[1] & ~1), static_cast<u16>(Position[1] | 1));
+  Counters.bbox_left = std::min(Counters.bbox_left, static_cast<u16>(Position[0] & ~1));
+  Counters.bbox_right = std::max(Counters.bbox_right, static_cast<u16>(Position[0] | 1));
+  Counters.bbox_top = std::min(Counters.bbox_top, static_cast<u16>(Position[1] & ~1));
+  Counters.bbox_bottom = std::max(Counters.bbox_bottom, static_cast<u16>(Position[1] | 1));
 
-  INCSTAT(g_stats.this_frame.tev_pixels_out);
-  EfbInterface::IncPerfCounterQuadCount(PQ_BLEND_INPUT);
+  ++Counters.pixels_out;
+  ++Counters.perf_pixels[PQ_BLEND_INPUT];
 
   EfbInterface::BlendTev(Position[0], Position[1], output);
 }
 
+void Tev::SetConfig()
+{
+  // Shared by all instances. This is only called on the video thread while no instance draws.
+  static std::unordered_map<ConfigKey, Config, ConfigKeyHash> s_config_cache;
+
+  const u32 num_ind_stages = bpmem.genMode.numindstages;
+  const u32 num_tev_stages = bpmem.genMode.numtevstages + 1;
+
+  ConfigKey key{};
+  key.num_texgens = bpmem.genMode.numtexgens;
+  key.num_ind_stages = num_ind_stages;
+  key.num_tev_stages = num_tev_stages;
+  if (num_ind_stages > 0)
+  {
+    key.tevindref = bpmem.tevindref.hex;
+    for (u32 i = 0; i < key.texscale.size(); i++)
+      key.texscale[i] = bpmem.texscale[i].hex;
+  }
+  for (u32 i = 0; i < key.tevksel.size(); i++)
+    key.tevksel[i] = bpmem.tevksel.ksel[i].hex;
+  for (u32 stageNum = 0; stageNum < num_tev_stages; stageNum++)
+  {
+    key.tevorders[stageNum >> 1] = bpmem.tevorders[stageNum >> 1].hex;
+    key.tevind[stageNum] = bpmem.tevind[stageNum].hex;
+    key.color_combiners[stageNum] = bpmem.combiners[stageNum].colorC.hex;
+    key.alpha_combiners[stageNum] = bpmem.combiners[stageNum].alphaC.hex;
+  }
+
+  if (const auto it = s_config_cache.find(key); it != s_config_cache.end())
+  {
+    m_Config = &it->second;
+    return;
+  }
+
+  if (s_config_cache.size() >= MAX_CACHED_CONFIGS)
+    s_config_cache.clear();
+
+  Config& config = s_config_cache[key];
+  config.has_texgens = bpmem.genMode.numtexgens > 0;
+  config.num_ind_stages = num_ind_stages;
+  config.num_tev_stages = num_tev_stages;
+
+  for (u32 stageNum = 0; stageNum < num_ind_stages; stageNum++)
+  {
+    Config::IndirectStage& stage = config.ind_stages[stageNum];
+    stage.texcoord = bpmem.tevindref.getTexCoord(stageNum);
+    stage.texmap = bpmem.tevindref.getTexMap(stageNum);
+
+    // Quirk: when the tex coord is not less than the number of tex gens (i.e. the tex coord does
+    // not exist), then tex coord 0 is used (though sometimes glitchy effects happen on console).
+    // This affects the Mario portrait in Luigi's Mansion, where the developers forgot to set
+    // the number of tex gens to 2 (bug 11462).
+    if (stage.texcoord >= bpmem.genMode.numtexgens)
+      stage.texcoord = 0;
+
+    const TEXSCALE& texscale = bpmem.texscale[stageNum >> 1];
+    const bool stageOdd = stageNum & 1;
+    stage.scale_s = stageOdd ? texscale.ss1 : texscale.ss0;
+    stage.scale_t = stageOdd ? texscale.ts1 : texscale.ts0;
+  }
+
+  bool has_indirect = false;
+  for (u32 stageNum = 0; stageNum < num_tev_stages; stageNum++)
+  {
+    StageConfig& stage = config.stages[stageNum];
+    const TwoTevStageOrders& order = bpmem.tevorders[stageNum >> 1];
+    const int stageOdd = stageNum & 1;
+    const TevStageCombiner::ColorCombiner& cc = bpmem.combiners[stageNum].colorC;
+    const TevStageCombiner::AlphaCombiner& ac = bpmem.combiners[stageNum].alphaC;
+
+    stage.cc.hex = cc.hex;
+    stage.ac.hex = ac.hex;
+
+    stage.texcoord = order.getTexCoord(stageOdd);
+    // Quirk: when the tex coord is not less than the number of tex gens (i.e. the tex coord does
+    // not exist), then tex coord 0 is used (though sometimes glitchy effects happen on console).
+    if (stage.texcoord >= bpmem.genMode.numtexgens)
+      stage.texcoord = 0;
+    stage.texmap = order.getTexMap(stageOdd);
+    stage.texture_enabled = order.getEnable(stageOdd);
+    stage.tex_swap = bpmem.tevksel.GetSwapTable(ac.tswap);
+    stage.ras_swap = bpmem.tevksel.GetSwapTable(ac.rswap);
+    stage.color_chan = order.getColorChan(stageOdd);
+    stage.konst_color = bpmem.tevksel.GetKonstColor(stageNum);
+    stage.konst_alpha = bpmem.tevksel.GetKonstAlpha(stageNum);
+
+    // Without bump alpha, matrix, wrapping or adding the previous result, Indirect() just copies
+    // the tex coord.
+    const TevStageIndirect& indirect = bpmem.tevind[stageNum];
+    stage.direct = !indirect.IsActive() && indirect.matrix_id == IndMtxId::Indirect &&
+                   indirect.sw == IndTexWrap::ITW_OFF && indirect.tw == IndTexWrap::ITW_OFF &&
+                   !indirect.fb_addprev;
+    has_indirect |= !stage.direct;
+
+    stage.use_vector_combiner = cc.bias != TevBias::Compare && ac.bias != TevBias::Compare;
+    if (!stage.use_vector_combiner)
+      continue;
+
+    PixelMath::CombinerParams& params = stage.combiner_params;
+
+    for (int i = BLU_C; i <= RED_C; i++)
+    {
+      params.bias[i] = s_BiasLUT[cc.bias];
+      params.scale[i] = 1 << s_ScaleLShiftLUT[cc.scale];
+      params.rounding[i] = (cc.scale == TevScale::Divide2) ? 0 : (cc.op == TevOp::Sub) ? 127 : 128;
+      params.negate_before_shift[i] = 0;
+      params.negate_after_shift[i] = (cc.op == TevOp::Sub) ? -1 : 0;
+      params.divide_by_2[i] = s_ScaleRShiftLUT[cc.scale] ? -1 : 0;
+    }
+
+    params.bias[ALP_C] = s_BiasLUT[ac.bias];
+    params.scale[ALP_C] = 1 << s_ScaleLShiftLUT[ac.scale];
+    params.rounding[ALP_C] =
+        (ac.scale == TevScale::Divide2) ? 0 : (ac.op == TevOp::Sub) ? 127 : 128;
+    params.negate_before_shift[ALP_C] = (ac.op == TevOp::Sub) ? -1 : 0;
+    params.negate_after_shift[ALP_C] = 0;
+    params.divide_by_2[ALP_C] = s_ScaleRShiftLUT[ac.scale] ? -1 : 0;
+  }
+
+  // The indirect stages are only sampled for the TEV stages which use them.
+  config.draw_stages = has_indirect ? &Tev::DrawStages<true> : &Tev::DrawStages<false>;
+
+  m_Config = &config;
+}
+
 void Tev::SetKonstColors()
 {
   auto& system = Core::System::GetInstance();
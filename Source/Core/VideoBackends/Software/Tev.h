@@ -5,8 +5,11 @@
 
 #include <array>
 
+#include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
+#include "VideoBackends/Software/PixelMath.h"
 #include "VideoCommon/BPMemory.h"
+#include "VideoCommon/PerfQueryBase.h"
 
 class Tev
 {
@@ -193,6 +196,13 @@ class Tev
       TevKonstRef::Value(KonstantColors[2].a),  // Konst 2 Alpha
       TevKonstRef::Value(KonstantColors[3].a),  // Konst 3 Alpha
   };
+
+  // The TEV configuration of the current batch, decoded from bpmem once instead of for every
+  // pixel. Configurations are cached and shared by all instances.
+  struct StageConfig;
+  struct Config;
+  const Config* m_Config = nullptr;
+
   static constexpr Common::EnumMap<s16, TevBias::Compare> s_BiasLUT{0, 128, -128, 0};
   static constexpr Common::EnumMap<u8, TevScale::Divide2> s_ScaleLShiftLUT{0, 1, 2, 0};
   static constexpr Common::EnumMap<u8, TevScale::Divide2> s_ScaleRShiftLUT{0, 0, 0, 1};
@@ -204,15 +214,25 @@ class Tev
     INDIRECT = 32
   };
 
-  void SetRasColor(RasColorChan colorChan, u32 swaptable);
+  using SwapTable = Common::EnumMap<ColorChannel, ColorChannel::Alpha>;
+
+  void SetRasColor(RasColorChan colorChan, const SwapTable& swap);
 
   void DrawColorRegular(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4]);
   void DrawColorCompare(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4]);
   void DrawAlphaRegular(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4]);
   void DrawAlphaCompare(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4]);
+  void DrawVector(const TevStageCombiner::ColorCombiner& cc,
+                  const TevStageCombiner::AlphaCombiner& ac,
+                  const PixelMath::CombinerParams& params);
 
   void Indirect(unsigned int stageNum, s32 s, s32 t);
 
+  // Runs the indirect and TEV stages of m_Config. Configurations in which no stage uses the
+  // indirect unit skip it entirely.
+  template <bool HasIndirect>
+  void DrawStages();
+
 public:
   s32 Position[3]{};
   u8 Color[2][4]{};  // must be RGBA for correct swap table ordering
@@ -230,6 +250,24 @@ public:
     RED_C
   };
 
+  // What Draw() did that affects global state. The rasterizer adds these to the statistics,
+  // performance counters and bounding box once it is done, so that several instances can draw at
+  // the same time.
+  struct DrawCounters
+  {
+    std::array<u32, PQ_NUM_MEMBERS> perf_pixels{};
+    u32 pixels_in = 0;
+    u32 pixels_out = 0;
+    u16 bbox_left = 0xffff;
+    u16 bbox_right = 0;
+    u16 bbox_top = 0xffff;
+    u16 bbox_bottom = 0;
+  };
+  DrawCounters Counters;
+
   void SetKonstColors();
+  // Looks up the configuration of the TEV stages in bpmem, which must not change until the next
+  // call.
+  void SetConfig();
   void Draw();
 };
@@ -46,10 +46,15 @@ using namespace BPFunctions;
 static constexpr Common::EnumMap<float, GammaCorrection::Invalid2_2> s_gammaLUT = {1.0f, 1.7f, 2.2f,
                                                                                    2.2f};
 
+// The texture units as seen by the FIFO preprocessing. bpmem is owned by the GPU thread, which is
+// behind, so keep track of them separately.
+static AllTexUnits s_preprocess_tex_units;
+
 void BPInit()
 {
   memset(reinterpret_cast<u8*>(&bpmem), 0, sizeof(bpmem));
   bpmem.bpMask = 0xFFFFFF;
+  s_preprocess_tex_units.AllRegisters = bpmem.tex.AllRegisters;
 }
 
 static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager& xf_state_manager,
@@ -834,6 +839,19 @@ void LoadBPRegPreprocess(u8 reg, u32 value, int cycles_into_future)
     system.GetPixelEngine().SetToken(newval & 0xffff, true, cycles_into_future);
     break;
   }
+
+  // Once the address of a texture is set, it is likely to be used soon, so it can be prefetched.
+  if (reg >= BPMEM_TX_SETMODE0 && reg < BPMEM_TX_SETMODE0 + 0x40)
+  {
+    s_preprocess_tex_units.AllRegisters[reg & 0x3f] = newval;
+
+    const TexUnitAddress address = TexUnitAddress::FromBPAddress(reg);
+    if (address.Reg == TexUnitAddress::Register::SETIMAGE3 && g_texture_cache)
+    {
+      const u32 unit = address.GetUnitID();
+      g_texture_cache->PrefetchTexture(unit, s_preprocess_tex_units.GetUnit(unit));
+    }
+  }
 }
 
 std::pair<std::string, std::string> GetBPRegInfo(u8 cmd, u32 cmddata)
@@ -1367,4 +1385,7 @@ void BPReload()
   SetBlendMode();
   OnPixelFormatChange(g_framebuffer_manager.get(), bpmem.zcontrol.pixel_format,
                       bpmem.zcontrol.zformat);
+
+  // The GPU is synced around state loads, so the preprocessing has caught up with bpmem.
+  s_preprocess_tex_units.AllRegisters = bpmem.tex.AllRegisters;
 }
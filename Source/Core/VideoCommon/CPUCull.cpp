@@ -135,21 +135,37 @@ void CPUCull::Init()
   m_cull_table[Prim::GX_DRAW_TRIANGLE_FAN] = GetCullFunction1<Prim::GX_DRAW_TRIANGLE_FAN>();
 }
 
-bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
-                                   const u8* src, u32 count)
+CPUCull::TransformBuffer::~TransformBuffer()
+{
+  Common::FreeAlignedMemory(m_buffer);
+}
+
+CPUCull::TransformedVertex* CPUCull::TransformBuffer::Get(u32 count)
+{
+  if (m_size < count) [[unlikely]]
+  {
+    u32 new_size = MathUtil::NextPowerOf2(count);
+    Common::FreeAlignedMemory(m_buffer);
+    m_size = new_size;
+    m_buffer = static_cast<TransformedVertex*>(
+        Common::AllocateAlignedMemory(new_size * sizeof(TransformedVertex), 32));
+  }
+  return m_buffer;
+}
+
+bool CPUCull::Culler::AreAllVerticesCulled(const u8* src, u32 count, TransformBuffer* buffer) const
+{
+  TransformedVertex* const transformed = buffer->Get(count);
+  m_transform(transformed, src, m_stride, count);
+  return m_cull(transformed, count);
+}
+
+CPUCull::Culler CPUCull::GetCuller(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive)
 {
   ASSERT_MSG(VIDEO, primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES,
              "CPUCull should not be called on lines or points");
-  const u32 stride = loader->m_native_vtx_decl.stride;
   const bool posHas3Elems = loader->m_native_vtx_decl.position.components >= 3;
   const bool perVertexPosMtx = loader->m_native_vtx_decl.posmtx.enable;
-  if (m_transform_buffer_size < count) [[unlikely]]
-  {
-    u32 new_size = MathUtil::NextPowerOf2(count);
-    m_transform_buffer_size = new_size;
-    m_transform_buffer.reset(static_cast<TransformedVertex*>(
-        Common::AllocateAlignedMemory(new_size * sizeof(TransformedVertex), 32)));
-  }
 
   // transform functions need the projection matrix to transform to clip space
   auto& system = Core::System::GetInstance();
@@ -161,14 +177,16 @@ bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Prim
   CullMode cull_mode = bpmem.genMode.cull_mode;
   if (xfmem.viewport.ht > 0)  // See videosoftware Clipper.cpp:IsBackface
     cull_mode = cullmode_invert[cull_mode];
-  const TransformFunction transform = m_transform_table[posHas3Elems][perVertexPosMtx];
-  transform(m_transform_buffer.get(), src, stride, count);
-  const CullFunction cull = m_cull_table[primitive][cull_mode];
-  return cull(m_transform_buffer.get(), count);
+
+  Culler culler;
+  culler.m_transform = m_transform_table[posHas3Elems][perVertexPosMtx];
+  culler.m_cull = m_cull_table[primitive][cull_mode];
+  culler.m_stride = loader->m_native_vtx_decl.stride;
+  return culler;
 }
 
-template <typename T>
-void CPUCull::BufferDeleter<T>::operator()(T* ptr)
+bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
+                                   const u8* src, u32 count)
 {
-  Common::FreeAlignedMemory(ptr);
+  return GetCuller(loader, primitive).AreAllVerticesCulled(src, count, &m_transform_buffer);
 }
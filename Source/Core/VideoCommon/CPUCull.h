@@ -10,11 +10,6 @@
 class CPUCull
 {
 public:
-  ~CPUCull();
-  void Init();
-  bool AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
-                            const u8* src, u32 count);
-
   struct alignas(16) TransformedVertex
   {
     float x, y, z, w;
@@ -23,14 +18,46 @@ public:
   using TransformFunction = void (*)(void*, const void*, u32, int);
   using CullFunction = bool (*)(const CPUCull::TransformedVertex*, int);
 
-private:
-  template <typename T>
-  struct BufferDeleter
+  // Memory the vertices are transformed into. Each thread which culls needs its own.
+  class TransformBuffer
   {
-    void operator()(T* ptr);
+  public:
+    TransformBuffer() = default;
+    ~TransformBuffer();
+
+    TransformBuffer(const TransformBuffer&) = delete;
+    TransformBuffer& operator=(const TransformBuffer&) = delete;
+
+    TransformedVertex* Get(u32 count);
+
+  private:
+    TransformedVertex* m_buffer = nullptr;
+    u32 m_size = 0;
   };
-  std::unique_ptr<TransformedVertex[], BufferDeleter<TransformedVertex>> m_transform_buffer{};
-  u32 m_transform_buffer_size = 0;
+
+  // Culls vertices with the state at the time it was created by GetCuller(). Can be used by
+  // several threads at once.
+  class Culler
+  {
+  public:
+    bool AreAllVerticesCulled(const u8* src, u32 count, TransformBuffer* buffer) const;
+
+  private:
+    friend class CPUCull;
+
+    TransformFunction m_transform = nullptr;
+    CullFunction m_cull = nullptr;
+    u32 m_stride = 0;
+  };
+
+  ~CPUCull();
+  void Init();
+  Culler GetCuller(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive);
+  bool AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
+                            const u8* src, u32 count);
+
+private:
+  TransformBuffer m_transform_buffer;
   std::array<std::array<TransformFunction, 2>, 2> m_transform_table{};
   Common::EnumMap<Common::EnumMap<CullFunction, CullMode::All>,
                   OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_FAN>
@@ -8,7 +8,9 @@
 #define __STDC_CONSTANT_MACROS 1
 #endif
 
+#include <algorithm>
 #include <array>
+#include <mutex>
 #include <string>
 
 #include <fmt/chrono.h>
@@ -17,7 +19,9 @@
 extern "C" {
 #include <libavcodec/avcodec.h>
 #include <libavformat/avformat.h>
+#include <libavutil/buffer.h>
 #include <libavutil/error.h>
+#include <libavutil/imgutils.h>
 #include <libavutil/log.h>
 #include <libavutil/mathematics.h>
 #include <libavutil/opt.h>
@@ -61,6 +65,37 @@ struct FrameDumpContext
   bool gave_vfr_warning = false;
 };
 
+// The state of FFMpegFrameDump::ConvertFrame(), which runs on a different thread than the encoder.
+struct FrameDumpConverter
+{
+  ~FrameDumpConverter()
+  {
+    sws_freeContext(sws);
+    av_buffer_pool_uninit(&pool);
+  }
+
+  // The pixel format of the current video file.
+  std::mutex mutex;
+  AVPixelFormat pix_fmt = AV_PIX_FMT_NONE;
+
+  // Only used by the converting thread. The pool takes care of freeing the buffers of frames which
+  // are still queued when it's replaced.
+  SwsContext* sws = nullptr;
+  AVBufferPool* pool = nullptr;
+  int pool_buffer_size = 0;
+};
+
+struct FFMpegConvertedFrame
+{
+  AVFrame* frame = nullptr;
+};
+
+void FFMpegConvertedFrameDeleter::operator()(FFMpegConvertedFrame* frame) const
+{
+  av_frame_free(&frame->frame);
+  delete frame;
+}
+
 namespace
 {
 AVRational GetTimeBaseForCurrentRefreshRate(s64 max_denominator)
@@ -344,17 +379,76 @@ bool FFMpegFrameDump::CreateVideoFile()
                  m_context->stream->time_base.num);
   }
 
+  {
+    std::lock_guard lk(m_converter->mutex);
+    m_converter->pix_fmt = m_context->codec->pix_fmt;
+  }
+
   OSD::AddMessage(fmt::format("Dumping Frames to \"{}\" ({}x{})", dump_path, m_context->width,
                               m_context->height));
   return true;
 }
 
+FFMpegConvertedFramePtr FFMpegFrameDump::ConvertFrame(const FrameData& frame)
+{
+  AVPixelFormat pix_fmt;
+  {
+    std::lock_guard lk(m_converter->mutex);
+    pix_fmt = m_converter->pix_fmt;
+  }
+  if (pix_fmt == AV_PIX_FMT_NONE || frame.width <= 0 || frame.height <= 0)
+    return nullptr;
+
+  FrameDumpConverter& converter = *m_converter;
+
+  // Frames are converted into buffers from a pool, as they're freed in a different order than
+  // they're converted in.
+  constexpr int ALIGNMENT = 64;
+  const int buffer_size = av_image_get_buffer_size(pix_fmt, frame.width, frame.height, ALIGNMENT);
+  if (buffer_size < 0)
+    return nullptr;
+  if (!converter.pool || buffer_size != converter.pool_buffer_size)
+  {
+    av_buffer_pool_uninit(&converter.pool);
+    converter.pool = av_buffer_pool_init(buffer_size, nullptr);
+    converter.pool_buffer_size = buffer_size;
+    if (!converter.pool)
+      return nullptr;
+  }
+
+  FFMpegConvertedFramePtr converted(new FFMpegConvertedFrame{av_frame_alloc()});
+  AVFrame* const dst = converted->frame;
+  if (!dst)
+    return nullptr;
+
+  dst->format = pix_fmt;
+  dst->width = frame.width;
+  dst->height = frame.height;
+  dst->buf[0] = av_buffer_pool_get(converter.pool);
+  if (!dst->buf[0] || av_image_fill_arrays(dst->data, dst->linesize, dst->buf[0]->data, pix_fmt,
+                                           frame.width, frame.height, ALIGNMENT) < 0)
+  {
+    return nullptr;
+  }
+
+  converter.sws = sws_getCachedContext(converter.sws, frame.width, frame.height, AV_PIX_FMT_RGBA,
+                                       frame.width, frame.height, pix_fmt, SWS_BICUBIC, nullptr,
+                                       nullptr, nullptr);
+  if (!converter.sws)
+    return nullptr;
+
+  const u8* const src_data[4] = {frame.data};
+  const int src_linesize[4] = {frame.stride};
+  sws_scale(converter.sws, src_data, src_linesize, 0, frame.height, dst->data, dst->linesize);
+  return converted;
+}
+
 bool FFMpegFrameDump::IsFirstFrameInCurrentFile() const
 {
   return m_context->last_pts == AV_NOPTS_VALUE;
 }
 
-void FFMpegFrameDump::AddFrame(const FrameData& frame)
+void FFMpegFrameDump::AddFrame(const FrameData& frame, FFMpegConvertedFrame* converted)
 {
   // Are we even dumping?
   if (!IsStarted())
@@ -388,28 +482,54 @@ void FFMpegFrameDump::AddFrame(const FrameData& frame)
     }
   }
 
-  constexpr AVPixelFormat pix_fmt = AV_PIX_FMT_RGBA;
-
-  m_context->src_frame->data[0] = const_cast<u8*>(frame.data);
-  m_context->src_frame->linesize[0] = frame.stride;
-  m_context->src_frame->format = pix_fmt;
-  m_context->src_frame->width = m_context->width;
-  m_context->src_frame->height = m_context->height;
-
-  // Convert image from RGBA to desired pixel format.
-  m_context->sws = sws_getCachedContext(
-      m_context->sws, frame.width, frame.height, pix_fmt, m_context->width, m_context->height,
-      m_context->codec->pix_fmt, SWS_BICUBIC, nullptr, nullptr, nullptr);
-  if (m_context->sws)
+  AVFrame* output_frame = m_context->scaled_frame;
+  if (converted && converted->frame->format == m_context->codec->pix_fmt &&
+      converted->frame->width == m_context->width && converted->frame->height == m_context->height)
   {
-    sws_scale(m_context->sws, m_context->src_frame->data, m_context->src_frame->linesize, 0,
-              frame.height, m_context->scaled_frame->data, m_context->scaled_frame->linesize);
+    // The frame is ready to be encoded.
+    output_frame = converted->frame;
+  }
+  else
+  {
+    // The frame is either RGBA, or was converted for a previous file.
+    AVPixelFormat pix_fmt = AV_PIX_FMT_RGBA;
+    int width = frame.width;
+    int height = frame.height;
+    if (converted)
+    {
+      std::copy_n(converted->frame->data, AV_NUM_DATA_POINTERS, m_context->src_frame->data);
+      std::copy_n(converted->frame->linesize, AV_NUM_DATA_POINTERS,
+                  m_context->src_frame->linesize);
+      pix_fmt = static_cast<AVPixelFormat>(converted->frame->format);
+      width = converted->frame->width;
+      height = converted->frame->height;
+    }
+    else
+    {
+      std::fill_n(m_context->src_frame->data, AV_NUM_DATA_POINTERS, nullptr);
+      std::fill_n(m_context->src_frame->linesize, AV_NUM_DATA_POINTERS, 0);
+      m_context->src_frame->data[0] = const_cast<u8*>(frame.data);
+      m_context->src_frame->linesize[0] = frame.stride;
+    }
+    m_context->src_frame->format = pix_fmt;
+    m_context->src_frame->width = m_context->width;
+    m_context->src_frame->height = m_context->height;
+
+    // Convert image to desired pixel format.
+    m_context->sws = sws_getCachedContext(
+        m_context->sws, width, height, pix_fmt, m_context->width, m_context->height,
+        m_context->codec->pix_fmt, SWS_BICUBIC, nullptr, nullptr, nullptr);
+    if (m_context->sws)
+    {
+      sws_scale(m_context->sws, m_context->src_frame->data, m_context->src_frame->linesize, 0,
+                height, m_context->scaled_frame->data, m_context->scaled_frame->linesize);
+    }
   }
 
   m_context->last_pts = pts;
-  m_context->scaled_frame->pts = pts;
+  output_frame->pts = pts;
 
-  if (const int error = avcodec_send_frame(m_context->codec, m_context->scaled_frame))
+  if (const int error = avcodec_send_frame(m_context->codec, output_frame))
   {
     ERROR_LOG_FMT(FRAMEDUMP, "Error while encoding video: {}", AVErrorString(error));
     return;
@@ -480,6 +600,11 @@ bool FFMpegFrameDump::IsStarted() const
 
 void FFMpegFrameDump::CloseVideoFile()
 {
+  {
+    std::lock_guard lk(m_converter->mutex);
+    m_converter->pix_fmt = AV_PIX_FMT_NONE;
+  }
+
   av_frame_free(&m_context->src_frame);
   av_frame_free(&m_context->scaled_frame);
 
@@ -553,7 +678,9 @@ FrameState FFMpegFrameDump::FetchState(u64 ticks, int frame_number) const
   return state;
 }
 
-FFMpegFrameDump::FFMpegFrameDump() = default;
+FFMpegFrameDump::FFMpegFrameDump() : m_converter(std::make_unique<FrameDumpConverter>())
+{
+}
 
 FFMpegFrameDump::~FFMpegFrameDump()
 {
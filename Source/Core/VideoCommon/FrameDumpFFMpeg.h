@@ -10,6 +10,7 @@
 #include "Common/CommonTypes.h"
 
 struct FrameDumpContext;
+struct FrameDumpConverter;
 class PointerWrap;
 
 // Holds relevant emulation state during a rendered frame for
@@ -21,6 +22,8 @@ struct FrameState
   u32 savestate_index = 0;
   int refresh_rate_num = 0;
   int refresh_rate_den = 0;
+  // Only filled in by the Y4M dumper, which can't query it from its own threads.
+  u64 ticks_per_second = 0;
 };
 
 struct FrameData
@@ -32,6 +35,16 @@ struct FrameData
   FrameState state;
 };
 
+// A frame which has been converted to the pixel format of the video file.
+struct FFMpegConvertedFrame;
+
+struct FFMpegConvertedFrameDeleter
+{
+  void operator()(FFMpegConvertedFrame* frame) const;
+};
+
+using FFMpegConvertedFramePtr = std::unique_ptr<FFMpegConvertedFrame, FFMpegConvertedFrameDeleter>;
+
 class FFMpegFrameDump
 {
 public:
@@ -39,7 +52,14 @@ public:
   ~FFMpegFrameDump();
 
   bool Start(int w, int h, u64 start_ticks);
-  void AddFrame(const FrameData&);
+
+  // Converts the frame to the pixel format of the current video file ahead of AddFrame(). Unlike
+  // the other methods, this may be called on another thread while frames are being added.
+  // Returns null if the frame couldn't be converted.
+  FFMpegConvertedFramePtr ConvertFrame(const FrameData&);
+
+  // The data of the frame may be null when it was converted by ConvertFrame().
+  void AddFrame(const FrameData&, FFMpegConvertedFrame* converted = nullptr);
   void Stop();
   void DoState(PointerWrap&);
   bool IsStarted() const;
@@ -55,6 +75,7 @@ private:
 
 #if defined(HAVE_FFMPEG)
   std::unique_ptr<FrameDumpContext> m_context;
+  std::unique_ptr<FrameDumpConverter> m_converter;
 #endif
 
   // Used for FetchState:
@@ -69,6 +90,15 @@ private:
 };
 
 #if !defined(HAVE_FFMPEG)
+struct FFMpegConvertedFrame
+{
+};
+
+inline void FFMpegConvertedFrameDeleter::operator()(FFMpegConvertedFrame* frame) const
+{
+  delete frame;
+}
+
 inline FFMpegFrameDump::FFMpegFrameDump() = default;
 inline FFMpegFrameDump::~FFMpegFrameDump() = default;
 
@@ -0,0 +1,259 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/FrameDumpY4M.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <string>
+#include <utility>
+
+#include <fmt/chrono.h>
+#include <fmt/format.h>
+
+#include "Common/ChunkFile.h"
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Common/MsgHandler.h"
+#include "Common/TimeUtil.h"
+
+#include "Core/Config/MainSettings.h"
+#include "Core/ConfigManager.h"
+#include "Core/HW/SystemTimers.h"
+#include "Core/HW/VideoInterface.h"
+#include "Core/System.h"
+
+#include "VideoCommon/OnScreenDisplay.h"
+
+namespace
+{
+std::string GetDumpPath(std::time_t time, u32 index)
+{
+  const auto local_time = Common::LocalTime(time);
+  if (!local_time)
+    return "";
+
+  const std::string path =
+      fmt::format("{}{}_{:%Y-%m-%d_%H-%M-%S}_{}.y4m", File::GetUserPath(D_DUMPFRAMES_IDX),
+                  SConfig::GetInstance().GetGameID(), *local_time, index);
+
+  // Ask to delete file.
+  if (File::Exists(path))
+  {
+    if (Config::Get(Config::MAIN_MOVIE_DUMP_FRAMES_SILENT) ||
+        AskYesNoFmtT("Delete the existing file '{0}'?", path))
+    {
+      File::Delete(path);
+    }
+    else
+    {
+      // Stop and cancel dumping the video
+      return "";
+    }
+  }
+
+  return path;
+}
+}  // namespace
+
+void Y4MFrameDump::ConvertFrame(const FrameData& frame, std::vector<u8>* planes)
+{
+  const std::size_t plane_size = static_cast<std::size_t>(std::max(frame.width, 0)) *
+                                 static_cast<std::size_t>(std::max(frame.height, 0));
+  planes->resize(plane_size * 3);
+  u8* y_plane = planes->data();
+  u8* cb_plane = y_plane + plane_size;
+  u8* cr_plane = cb_plane + plane_size;
+
+  // Full range BT.601, with the coefficients scaled by 2^16. The chroma can round up to 256.
+  for (int row = 0; row < frame.height; ++row)
+  {
+    const u8* src = frame.data + static_cast<std::size_t>(row) * frame.stride;
+    for (int x = 0; x < frame.width; ++x)
+    {
+      const s32 r = src[x * 4];
+      const s32 g = src[x * 4 + 1];
+      const s32 b = src[x * 4 + 2];
+      *y_plane++ = static_cast<u8>((19595 * r + 38470 * g + 7471 * b + 0x8000) >> 16);
+      *cb_plane++ =
+          static_cast<u8>(std::min((-11059 * r - 21709 * g + 32768 * b + 0x808000) >> 16, 255));
+      *cr_plane++ =
+          static_cast<u8>(std::min((32768 * r - 27439 * g - 5329 * b + 0x808000) >> 16, 255));
+    }
+  }
+}
+
+bool Y4MFrameDump::Start(int width, int height, u64 start_ticks, const FrameState& state)
+{
+  if (IsStarted())
+    return true;
+
+  m_savestate_index = 0;
+  m_start_time = std::time(nullptr);
+  m_file_index = 0;
+
+  if (!CreateVideoFile(width, height, start_ticks, state))
+  {
+    OSD::AddMessage("FrameDump Start failed");
+    return false;
+  }
+  return true;
+}
+
+bool Y4MFrameDump::CreateVideoFile(int width, int height, u64 start_ticks,
+                                   const FrameState& state)
+{
+  const std::string dump_path = GetDumpPath(m_start_time, m_file_index);
+  if (dump_path.empty())
+    return false;
+
+  File::CreateFullPath(dump_path);
+
+  NOTICE_LOG_FMT(FRAMEDUMP, "Opening file {} for dumping", dump_path);
+  if (!m_file.Open(dump_path, "wb"))
+  {
+    ERROR_LOG_FMT(FRAMEDUMP, "Could not open {}", dump_path);
+    return false;
+  }
+
+  m_width = width;
+  m_height = height;
+  m_start_ticks = start_ticks;
+  m_ticks_per_second = state.ticks_per_second;
+  m_file_savestate_index = state.savestate_index;
+  m_refresh_rate_num = state.refresh_rate_num;
+  m_refresh_rate_den = state.refresh_rate_den;
+  m_last_frame_index = -1;
+
+  const std::string header =
+      fmt::format("YUV4MPEG2 W{} H{} F{}:{} Ip A1:1 C444 XCOLORRANGE=FULL\n", width, height,
+                  m_refresh_rate_num, m_refresh_rate_den);
+  if (!m_file.WriteString(header))
+  {
+    ERROR_LOG_FMT(FRAMEDUMP, "Could not write to {}", dump_path);
+    m_file.Close();
+    return false;
+  }
+
+  OSD::AddMessage(fmt::format("Dumping Frames to \"{}\" ({}x{})", dump_path, width, height));
+  return true;
+}
+
+void Y4MFrameDump::AddFrame(const FrameState& state, int width, int height,
+                            std::vector<u8>* planes)
+{
+  if (!IsStarted())
+    return;
+
+  // The VI can be set up to not output anything, in which case the last frame is kept.
+  if (width <= 0 || height <= 0)
+    return;
+
+  CheckForConfigChange(state, width, height);
+
+  // Handle failure after a config change.
+  if (!IsStarted())
+    return;
+
+  const double seconds = static_cast<double>(state.ticks - m_start_ticks) / m_ticks_per_second;
+  const s64 frame_index = std::llround(seconds * m_refresh_rate_num / m_refresh_rate_den);
+  if (frame_index <= m_last_frame_index)
+  {
+    WARN_LOG_FMT(FRAMEDUMP, "Frame index delta < 1. Current frame will not be dumped.");
+    return;
+  }
+
+  // Fill in the frames which weren't rendered, so that the video stays in sync with the audio.
+  // Before the first frame of a file, there is nothing to repeat but the frame itself.
+  const std::vector<u8>& filler = m_last_frame_index < 0 ? *planes : m_last_frame;
+  for (s64 i = m_last_frame_index + 1; i < frame_index; ++i)
+    WriteFrame(filler);
+
+  WriteFrame(*planes);
+  m_last_frame_index = frame_index;
+  std::swap(*planes, m_last_frame);
+}
+
+void Y4MFrameDump::WriteFrame(const std::vector<u8>& planes)
+{
+  static constexpr char FRAME_HEADER[] = "FRAME\n";
+  if (!m_file.WriteBytes(FRAME_HEADER, sizeof(FRAME_HEADER) - 1) ||
+      !m_file.WriteBytes(planes.data(), planes.size()))
+  {
+    ERROR_LOG_FMT(FRAMEDUMP, "Error writing frame");
+  }
+}
+
+void Y4MFrameDump::CheckForConfigChange(const FrameState& state, int width, int height)
+{
+  bool restart_dump = false;
+
+  if (width != m_width || height != m_height)
+  {
+    INFO_LOG_FMT(FRAMEDUMP, "Starting new dump on resolution change.");
+    restart_dump = true;
+  }
+  else if (m_last_frame_index >= 0 && state.savestate_index != m_file_savestate_index)
+  {
+    INFO_LOG_FMT(FRAMEDUMP, "Starting new dump on savestate load.");
+    restart_dump = true;
+  }
+  else if (state.refresh_rate_num != m_refresh_rate_num ||
+           state.refresh_rate_den != m_refresh_rate_den)
+  {
+    INFO_LOG_FMT(FRAMEDUMP, "Starting new dump on refresh rate change {}/{} vs {}/{}.",
+                 m_refresh_rate_num, m_refresh_rate_den, state.refresh_rate_num,
+                 state.refresh_rate_den);
+    restart_dump = true;
+  }
+
+  if (restart_dump)
+  {
+    m_file.Close();
+    ++m_file_index;
+    if (!CreateVideoFile(width, height, state.ticks, state))
+      OSD::AddMessage("FrameDump Start failed");
+  }
+}
+
+void Y4MFrameDump::Stop()
+{
+  if (!IsStarted())
+    return;
+
+  m_file.Close();
+  m_last_frame = {};
+
+  NOTICE_LOG_FMT(FRAMEDUMP, "Stopping frame dump");
+  OSD::AddMessage("Stopped dumping frames");
+}
+
+void Y4MFrameDump::DoState(PointerWrap& p)
+{
+  if (p.IsReadMode())
+    ++m_savestate_index;
+}
+
+bool Y4MFrameDump::IsStarted() const
+{
+  return m_file.IsOpen();
+}
+
+FrameState Y4MFrameDump::FetchState(u64 ticks, int frame_number) const
+{
+  auto& system = Core::System::GetInstance();
+  auto& vi = system.GetVideoInterface();
+  const u32 numerator = vi.GetTargetRefreshRateNumerator();
+  const u32 denominator = vi.GetTargetRefreshRateDenominator();
+  const u32 divisor = std::max(std::gcd(numerator, denominator), 1u);
+
+  FrameState state;
+  state.ticks = ticks;
+  state.frame_number = frame_number;
+  state.savestate_index = m_savestate_index;
+  state.refresh_rate_num = static_cast<int>(numerator / divisor);
+  state.refresh_rate_den = static_cast<int>(denominator / divisor);
+  state.ticks_per_second = system.GetSystemTimers().GetTicksPerSecond();
+  return state;
+}
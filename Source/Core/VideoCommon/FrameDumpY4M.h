@@ -0,0 +1,62 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <ctime>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+#include "VideoCommon/FrameDumpFFMpeg.h"
+
+class PointerWrap;
+
+// Dumps frames uncompressed to YUV4MPEG2 files, which FFmpeg and most video editors can read. This
+// is much cheaper than encoding the frames while dumping, at the cost of disk space. The frames are
+// stored as full range 4:4:4, so nothing but the rounding of the colour conversion is lost.
+class Y4MFrameDump
+{
+public:
+  // Converts an RGBA frame to the Y, Cb and Cr planes of a Y4M frame.
+  static void ConvertFrame(const FrameData& frame, std::vector<u8>* planes);
+
+  bool Start(int width, int height, u64 start_ticks, const FrameState& state);
+
+  // Writes a frame which was converted by ConvertFrame(). Afterwards, planes holds a buffer which
+  // can be reused for another frame.
+  void AddFrame(const FrameState& state, int width, int height, std::vector<u8>* planes);
+
+  void Stop();
+  void DoState(PointerWrap&);
+  bool IsStarted() const;
+  FrameState FetchState(u64 ticks, int frame_number) const;
+
+private:
+  bool CreateVideoFile(int width, int height, u64 start_ticks, const FrameState& state);
+  void CheckForConfigChange(const FrameState& state, int width, int height);
+  void WriteFrame(const std::vector<u8>& planes);
+
+  File::IOFile m_file;
+
+  // The properties of the current file.
+  int m_width = 0;
+  int m_height = 0;
+  u64 m_start_ticks = 0;
+  u64 m_ticks_per_second = 0;
+  u32 m_file_savestate_index = 0;
+  int m_refresh_rate_num = 0;
+  int m_refresh_rate_den = 0;
+
+  // Y4M files have a constant frame rate, so frames which weren't rendered are filled in with the
+  // last frame which was.
+  s64 m_last_frame_index = -1;
+  std::vector<u8> m_last_frame;
+
+  // Used for FetchState:
+  u32 m_savestate_index = 0;
+
+  // Used for filename generation.
+  std::time_t m_start_time = {};
+  u32 m_file_index = 0;
+};
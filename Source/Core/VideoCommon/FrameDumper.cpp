@@ -3,6 +3,10 @@
 
 #include "VideoCommon/FrameDumper.h"
 
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
 #include "Common/Assert.h"
 #include "Common/FileUtil.h"
 #include "Common/Image.h"
@@ -66,7 +70,14 @@ void FrameDumper::DumpCurrentFrame(const AbstractTexture* src_texture,
 
   m_frame_dump_readback_texture->CopyFromTexture(src_texture, copy_rect, 0, 0,
                                                  m_frame_dump_readback_texture->GetRect());
-  m_last_frame_state = m_ffmpeg_dump.FetchState(ticks, frame_number);
+
+  // The framedumping thread keeps the mode it was started with, so only pick it while the thread
+  // isn't running.
+  if (!m_frame_dump_thread_running.IsSet())
+    m_dump_mode = GetConfiguredDumpMode();
+
+  m_last_frame_state = m_dump_mode == DumpMode::Y4M ? m_y4m_dump.FetchState(ticks, frame_number) :
+                                                      m_ffmpeg_dump.FetchState(ticks, frame_number);
   m_frame_dump_needs_flush = true;
 }
 
@@ -166,6 +177,9 @@ void FrameDumper::ShutdownFrameDumping()
 
   m_frame_dump_readback_texture.reset();
   m_frame_dump_output_texture.reset();
+
+  std::lock_guard lk(m_free_frame_buffers_lock);
+  m_free_frame_buffers.clear();
 }
 
 void FrameDumper::DumpFrameData(const u8* data, int w, int h, int stride)
@@ -200,18 +214,11 @@ void FrameDumper::FrameDumpThreadFunc()
 {
   Common::SetCurrentThreadName("FrameDumping");
 
-  bool dump_to_ffmpeg = !Config::Get(Config::GFX_DUMP_FRAMES_AS_IMAGES);
   bool frame_dump_started = false;
 
-// If Dolphin was compiled without ffmpeg, we only support dumping to images.
-#if !defined(HAVE_FFMPEG)
-  if (dump_to_ffmpeg)
-  {
-    WARN_LOG_FMT(VIDEO, "FrameDump: Dolphin was not compiled with FFmpeg, using fallback option. "
-                        "Frames will be saved as PNG images instead.");
-    dump_to_ffmpeg = false;
-  }
-#endif
+  m_frame_encode_thread.Reset("FrameDumpEncoding", [this](QueuedFrame queued_frame) {
+    EncodeFrame(std::move(queued_frame));
+  });
 
   while (true)
   {
@@ -238,10 +245,7 @@ void FrameDumper::FrameDumpThreadFunc()
     {
       if (!frame_dump_started)
       {
-        if (dump_to_ffmpeg)
-          frame_dump_started = StartFrameDumpToFFMPEG(frame);
-        else
-          frame_dump_started = StartFrameDumpToImage(frame);
+        frame_dump_started = StartFrameDump(frame);
 
         // Stop frame dumping if we fail to start.
         if (!frame_dump_started)
@@ -250,23 +254,131 @@ void FrameDumper::FrameDumpThreadFunc()
 
       // If we failed to start frame dumping, don't write a frame.
       if (frame_dump_started)
-      {
-        if (dump_to_ffmpeg)
-          DumpFrameToFFMPEG(frame);
-        else
-          DumpFrameToImage(frame);
-      }
+        QueueFrame(frame);
     }
 
     m_frame_dump_done.Set();
   }
 
+  // Ensure all queued frames have been written.
+  m_frame_encode_thread.Shutdown();
+
   if (frame_dump_started)
+    StopFrameDump();
+}
+
+FrameDumper::DumpMode FrameDumper::GetConfiguredDumpMode()
+{
+  if (Config::Get(Config::GFX_DUMP_FRAMES_AS_IMAGES))
+    return DumpMode::Images;
+  if (Config::Get(Config::GFX_DUMP_FRAMES_AS_Y4M))
+    return DumpMode::Y4M;
+
+// If Dolphin was compiled without ffmpeg, we only support dumping to images and Y4M.
+#if !defined(HAVE_FFMPEG)
+  WARN_LOG_FMT(VIDEO, "FrameDump: Dolphin was not compiled with FFmpeg, using fallback option. "
+                      "Frames will be saved as PNG images instead.");
+  return DumpMode::Images;
+#else
+  return DumpMode::FFMpeg;
+#endif
+}
+
+bool FrameDumper::StartFrameDump(const FrameData& frame)
+{
+  switch (m_dump_mode)
+  {
+  case DumpMode::FFMpeg:
+    return StartFrameDumpToFFMPEG(frame);
+  case DumpMode::Images:
+    return StartFrameDumpToImage(frame);
+  case DumpMode::Y4M:
+  {
+    // Like for FFmpeg, dumps which start at boot have to start at the boot time.
+    const u64 start_ticks = frame.state.frame_number == 0 ? 0 : frame.state.ticks;
+    return m_y4m_dump.Start(frame.width, frame.height, start_ticks, frame.state);
+  }
+  }
+  return false;
+}
+
+void FrameDumper::StopFrameDump()
+{
+  // No additional cleanup is needed when dumping to images.
+  if (m_dump_mode == DumpMode::FFMpeg)
+    StopFrameDumpToFFMPEG();
+  else if (m_dump_mode == DumpMode::Y4M)
+    m_y4m_dump.Stop();
+}
+
+void FrameDumper::QueueFrame(const FrameData& frame)
+{
+  // Rather than queueing up more and more frames when the encoding can't keep up, wait for it.
+  m_frame_encode_thread.WaitForQueueSize(MAX_QUEUED_FRAMES - 1);
+
+  QueuedFrame queued_frame{frame, GetFrameBuffer(), nullptr};
+  queued_frame.frame.data = nullptr;
+
+  if (m_dump_mode == DumpMode::Y4M)
+  {
+    Y4MFrameDump::ConvertFrame(frame, &queued_frame.buffer);
+    queued_frame.frame.data = queued_frame.buffer.data();
+  }
+  else
+  {
+#if defined(HAVE_FFMPEG)
+    if (m_dump_mode == DumpMode::FFMpeg)
+      queued_frame.converted = m_ffmpeg_dump.ConvertFrame(frame);
+#endif
+
+    // Otherwise, the frame is copied as it is, since the output texture is about to be reused.
+    if (!queued_frame.converted)
+    {
+      const int row_size = std::max(frame.width, 0) * 4;
+      const int num_rows = std::max(frame.height, 0);
+      queued_frame.buffer.resize(static_cast<std::size_t>(row_size) * num_rows);
+      for (int row = 0; row < num_rows; ++row)
+      {
+        std::memcpy(queued_frame.buffer.data() + static_cast<std::size_t>(row) * row_size,
+                    frame.data + static_cast<std::size_t>(row) * frame.stride, row_size);
+      }
+      queued_frame.frame.data = queued_frame.buffer.data();
+      queued_frame.frame.stride = row_size;
+    }
+  }
+
+  m_frame_encode_thread.Push(std::move(queued_frame));
+}
+
+std::vector<u8> FrameDumper::GetFrameBuffer()
+{
+  std::lock_guard lk(m_free_frame_buffers_lock);
+  if (m_free_frame_buffers.empty())
+    return {};
+
+  std::vector<u8> buffer = std::move(m_free_frame_buffers.back());
+  m_free_frame_buffers.pop_back();
+  return buffer;
+}
+
+void FrameDumper::EncodeFrame(QueuedFrame queued_frame)
+{
+  const FrameData& frame = queued_frame.frame;
+  switch (m_dump_mode)
   {
-    // No additional cleanup is needed when dumping to images.
-    if (dump_to_ffmpeg)
-      StopFrameDumpToFFMPEG();
+  case DumpMode::FFMpeg:
+    DumpFrameToFFMPEG(frame, queued_frame.converted.get());
+    break;
+  case DumpMode::Images:
+    DumpFrameToImage(frame);
+    break;
+  case DumpMode::Y4M:
+    m_y4m_dump.AddFrame(frame.state, frame.width, frame.height, &queued_frame.buffer);
+    break;
   }
+
+  std::lock_guard lk(m_free_frame_buffers_lock);
+  m_free_frame_buffers.push_back(std::move(queued_frame.buffer));
 }
 
 #if defined(HAVE_FFMPEG)
@@ -280,9 +392,9 @@ bool FrameDumper::StartFrameDumpToFFMPEG(const FrameData& frame)
   return m_ffmpeg_dump.Start(frame.width, frame.height, start_ticks);
 }
 
-void FrameDumper::DumpFrameToFFMPEG(const FrameData& frame)
+void FrameDumper::DumpFrameToFFMPEG(const FrameData& frame, FFMpegConvertedFrame* converted)
 {
-  m_ffmpeg_dump.AddFrame(frame);
+  m_ffmpeg_dump.AddFrame(frame, converted);
 }
 
 void FrameDumper::StopFrameDumpToFFMPEG()
@@ -297,7 +409,7 @@ bool FrameDumper::StartFrameDumpToFFMPEG(const FrameData&)
   return false;
 }
 
-void FrameDumper::DumpFrameToFFMPEG(const FrameData&)
+void FrameDumper::DumpFrameToFFMPEG(const FrameData&, FFMpegConvertedFrame*)
 {
 }
 
@@ -368,5 +480,6 @@ void FrameDumper::DoState(PointerWrap& p)
 #ifdef HAVE_FFMPEG
   m_ffmpeg_dump.DoState(p);
 #endif
+  m_y4m_dump.DoState(p);
 }
 std::unique_ptr<FrameDumper> g_frame_dumper;
@@ -3,19 +3,29 @@
 
 #pragma once
 
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
 #include "Common/Flag.h"
 #include "Common/MathUtil.h"
 #include "Common/Thread.h"
+#include "Common/WorkQueueThread.h"
 
 #include "VideoCommon/FrameDumpFFMpeg.h"
+#include "VideoCommon/FrameDumpY4M.h"
 #include "VideoCommon/VideoEvents.h"
 
 class AbstractStagingTexture;
 class AbstractTexture;
 class AbstractFramebuffer;
 
+// Frames are dumped in three stages: The video thread reads them back from the GPU, the
+// framedumping thread converts them to the pixel format of the dump, and the encoding thread
+// encodes and writes them. The encoding can fall behind by a few frames, after which the other
+// stages wait for it.
 class FrameDumper
 {
 public:
@@ -38,13 +48,41 @@ public:
   void DoState(PointerWrap& p);
 
 private:
+  enum class DumpMode
+  {
+    FFMpeg,
+    Images,
+    Y4M,
+  };
+
+  // A frame which is waiting for the encoding thread.
+  struct QueuedFrame
+  {
+    // The data points into buffer, or is null when the frame was converted for FFmpeg.
+    FrameData frame;
+    std::vector<u8> buffer;
+    FFMpegConvertedFramePtr converted;
+  };
+
+  // How many frames the encoding thread can fall behind.
+  static constexpr std::size_t MAX_QUEUED_FRAMES = 4;
+
+  static DumpMode GetConfiguredDumpMode();
+
   // NOTE: The methods below are called on the framedumping thread.
   void FrameDumpThreadFunc();
+  bool StartFrameDump(const FrameData&);
+  void StopFrameDump();
+  void QueueFrame(const FrameData&);
+  std::vector<u8> GetFrameBuffer();
   bool StartFrameDumpToFFMPEG(const FrameData&);
-  void DumpFrameToFFMPEG(const FrameData&);
   void StopFrameDumpToFFMPEG();
   std::string GetFrameDumpNextImageFileName() const;
   bool StartFrameDumpToImage(const FrameData&);
+
+  // NOTE: The methods below are called on the frame encoding thread.
+  void EncodeFrame(QueuedFrame queued_frame);
+  void DumpFrameToFFMPEG(const FrameData&, FFMpegConvertedFrame* converted);
   void DumpFrameToImage(const FrameData&);
 
   void ShutdownFrameDumping();
@@ -67,7 +105,7 @@ private:
   // Used to kick frame dump thread.
   Common::Event m_frame_dump_start;
 
-  // Set by frame dump thread on frame completion.
+  // Set by frame dump thread once it is done with the output texture.
   Common::Event m_frame_dump_done;
 
   // Holds emulation state during the last swap when dumping.
@@ -76,6 +114,15 @@ private:
   // Communication of frame between video and dump threads.
   FrameData m_frame_dump_data;
 
+  // Set on the video thread before the framedumping thread starts, and fixed while it runs.
+  DumpMode m_dump_mode = DumpMode::FFMpeg;
+
+  Common::WorkQueueThreadSP<QueuedFrame> m_frame_encode_thread;
+
+  // Buffers of frames which have been encoded, for reuse.
+  std::mutex m_free_frame_buffers_lock;
+  std::vector<std::vector<u8>> m_free_frame_buffers;
+
   // Texture used for screenshot/frame dumping
   std::unique_ptr<AbstractTexture> m_frame_dump_render_texture;
   std::unique_ptr<AbstractFramebuffer> m_frame_dump_render_framebuffer;
@@ -92,6 +139,7 @@ private:
   u32 m_frame_dump_image_counter = 0;
 
   FFMpegFrameDump m_ffmpeg_dump;
+  Y4MFrameDump m_y4m_dump;
 
   // Screenshots
   Common::Flag m_screenshot_request;
@@ -3,8 +3,18 @@
 
 #include "VideoCommon/IndexGenerator.h"
 
+#include <array>
+#include <cstddef>
 #include <cstring>
 
+#if defined(_M_X86) || defined(_M_X86_64)
+#define USE_SSE
+#include <emmintrin.h>
+#elif defined(_M_ARM_64)
+#define USE_NEON
+#include <arm_neon.h>
+#endif
+
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "VideoCommon/OpcodeDecoding.h"
@@ -14,6 +24,119 @@ namespace
 {
 constexpr u16 s_primitive_restart = UINT16_MAX;
 
+// The indices of GX primitives only depend on the position in the primitive, so most of them are
+// written by repeating a pattern which covers several triangles, eight indices at a time.
+template <size_t N>
+struct IndexPattern
+{
+  static_assert(N % 8 == 0, "Patterns are written eight indices at a time");
+
+  // How far the base of the pattern advances with each repetition.
+  u16 advance;
+  std::array<u16, N> offsets;
+  // 0xffff for indices which are relative to the base of the repetition.
+  std::array<u16, N> base_mask;
+  // 0xffff for indices which refer to the first vertex of the primitive, the center of fans.
+  std::array<u16, N> first_mask;
+};
+
+// Indices of patterns which aren't relative to the base of the repetition.
+constexpr int FIRST = -1;
+constexpr int RESTART = -2;
+
+template <size_t N>
+constexpr IndexPattern<N> MakePattern(u16 advance, const std::array<int, N>& indices)
+{
+  IndexPattern<N> pattern{advance, {}, {}, {}};
+  for (size_t i = 0; i < N; i++)
+  {
+    if (indices[i] == FIRST)
+    {
+      pattern.first_mask[i] = 0xffff;
+    }
+    else if (indices[i] == RESTART)
+    {
+      pattern.offsets[i] = s_primitive_restart;
+    }
+    else
+    {
+      pattern.offsets[i] = static_cast<u16>(indices[i]);
+      pattern.base_mask[i] = 0xffff;
+    }
+  }
+  return pattern;
+}
+
+template <size_t N>
+u16* WritePattern(u16* index_ptr, const IndexPattern<N>& pattern, u32 repetitions, u32 base,
+                  u32 first)
+{
+  constexpr size_t VECTORS = N / 8;
+
+#if defined(USE_SSE)
+  const __m128i first_vec = _mm_set1_epi16(static_cast<s16>(first));
+  const __m128i advance = _mm_set1_epi16(static_cast<s16>(pattern.advance));
+  __m128i fixed[VECTORS];
+  __m128i base_mask[VECTORS];
+  for (size_t i = 0; i < VECTORS; i++)
+  {
+    const __m128i offsets =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(&pattern.offsets[i * 8]));
+    const __m128i first_mask =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(&pattern.first_mask[i * 8]));
+    fixed[i] = _mm_add_epi16(offsets, _mm_and_si128(first_vec, first_mask));
+    base_mask[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&pattern.base_mask[i * 8]));
+  }
+
+  __m128i base_vec = _mm_set1_epi16(static_cast<s16>(base));
+  for (u32 r = 0; r < repetitions; r++)
+  {
+    for (size_t i = 0; i < VECTORS; i++)
+    {
+      const __m128i indices = _mm_add_epi16(fixed[i], _mm_and_si128(base_vec, base_mask[i]));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(index_ptr + i * 8), indices);
+    }
+    index_ptr += N;
+    base_vec = _mm_add_epi16(base_vec, advance);
+  }
+#elif defined(USE_NEON)
+  const uint16x8_t first_vec = vdupq_n_u16(static_cast<u16>(first));
+  const uint16x8_t advance = vdupq_n_u16(pattern.advance);
+  uint16x8_t fixed[VECTORS];
+  uint16x8_t base_mask[VECTORS];
+  for (size_t i = 0; i < VECTORS; i++)
+  {
+    const uint16x8_t offsets = vld1q_u16(&pattern.offsets[i * 8]);
+    fixed[i] = vaddq_u16(offsets, vandq_u16(first_vec, vld1q_u16(&pattern.first_mask[i * 8])));
+    base_mask[i] = vld1q_u16(&pattern.base_mask[i * 8]);
+  }
+
+  uint16x8_t base_vec = vdupq_n_u16(static_cast<u16>(base));
+  for (u32 r = 0; r < repetitions; r++)
+  {
+    for (size_t i = 0; i < VECTORS; i++)
+      vst1q_u16(index_ptr + i * 8, vaddq_u16(fixed[i], vandq_u16(base_vec, base_mask[i])));
+    index_ptr += N;
+    base_vec = vaddq_u16(base_vec, advance);
+  }
+#else
+  for (u32 r = 0; r < repetitions; r++)
+  {
+    for (size_t i = 0; i < N; i++)
+    {
+      *index_ptr++ = pattern.offsets[i] + (base & pattern.base_mask[i]) +
+                     (first & pattern.first_mask[i]);
+    }
+    base += pattern.advance;
+  }
+#endif
+
+  return index_ptr;
+}
+
+// Eight independent indices.
+constexpr auto s_sequential_pattern = MakePattern(8, std::array<int, 8>{0, 1, 2, 3, 4, 5, 6, 7});
+
 template <bool pr>
 u16* WriteTriangle(u16* index_ptr, u32 index1, u32 index2, u32 index3)
 {
@@ -25,22 +148,58 @@ u16* WriteTriangle(u16* index_ptr, u32 index1, u32 index2, u32 index3)
   return index_ptr;
 }
 
+// Eight triangles.
+template <bool pr>
+constexpr auto s_list_pattern = MakePattern(24, [] {
+  std::array<int, pr ? 32 : 24> indices{};
+  size_t n = 0;
+  for (int t = 0; t < 8; t++)
+  {
+    indices[n++] = t * 3;
+    indices[n++] = t * 3 + 1;
+    indices[n++] = t * 3 + 2;
+    if constexpr (pr)
+      indices[n++] = RESTART;
+  }
+  return indices;
+}());
+
 template <bool pr>
 u16* AddList(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 2; i < num_verts; i += 3)
+  const u32 repetitions = num_verts / 24;
+  index_ptr = WritePattern(index_ptr, s_list_pattern<pr>, repetitions, index, index);
+
+  for (u32 i = 2 + repetitions * 24; i < num_verts; i += 3)
   {
     index_ptr = WriteTriangle<pr>(index_ptr, index + i - 2, index + i - 1, index + i);
   }
   return index_ptr;
 }
 
+// Eight triangles, alternating in winding.
+constexpr auto s_strip_pattern = MakePattern(8, [] {
+  std::array<int, 24> indices{};
+  size_t n = 0;
+  for (int t = 0; t < 8; t++)
+  {
+    const bool wind = (t & 1) != 0;
+    indices[n++] = t;
+    indices[n++] = t + 2 - !wind;
+    indices[n++] = t + 2 - wind;
+  }
+  return indices;
+}());
+
 template <bool pr>
 u16* AddStrip(u16* index_ptr, u32 num_verts, u32 index)
 {
   if constexpr (pr)
   {
-    for (u32 i = 0; i < num_verts; ++i)
+    const u32 repetitions = num_verts / 8;
+    index_ptr = WritePattern(index_ptr, s_sequential_pattern, repetitions, index, index);
+
+    for (u32 i = repetitions * 8; i < num_verts; ++i)
     {
       *index_ptr++ = index + i;
     }
@@ -48,8 +207,12 @@ u16* AddStrip(u16* index_ptr, u32 num_verts, u32 index)
   }
   else
   {
+    const u32 repetitions = num_verts > 2 ? (num_verts - 2) / 8 : 0;
+    index_ptr = WritePattern(index_ptr, s_strip_pattern, repetitions, index, index);
+
+    // The pattern covers an even number of triangles, so the winding starts over.
     bool wind = false;
-    for (u32 i = 2; i < num_verts; ++i)
+    for (u32 i = 2 + repetitions * 8; i < num_verts; ++i)
     {
       index_ptr = WriteTriangle<pr>(index_ptr, index + i - 2, index + i - !wind, index + i - wind);
 
@@ -78,10 +241,44 @@ u16* AddStrip(u16* index_ptr, u32 num_verts, u32 index)
  * so we use 6 indices for 3 triangles
  */
 
+// Twelve triangles with primitive restart, eight otherwise. The base of the pattern is the second
+// vertex of the first triangle.
+template <bool pr>
+constexpr auto s_fan_pattern = MakePattern(pr ? 12 : 8, [] {
+  std::array<int, 24> indices{};
+  size_t n = 0;
+  if constexpr (pr)
+  {
+    for (int t = 0; t < 12; t += 3)
+    {
+      indices[n++] = t;
+      indices[n++] = t + 1;
+      indices[n++] = FIRST;
+      indices[n++] = t + 2;
+      indices[n++] = t + 3;
+      indices[n++] = RESTART;
+    }
+  }
+  else
+  {
+    for (int t = 0; t < 8; t++)
+    {
+      indices[n++] = FIRST;
+      indices[n++] = t;
+      indices[n++] = t + 1;
+    }
+  }
+  return indices;
+}());
+
 template <bool pr>
 u16* AddFan(u16* index_ptr, u32 num_verts, u32 index)
 {
-  u32 i = 2;
+  constexpr u32 triangles = pr ? 12 : 8;
+  const u32 repetitions = num_verts > 2 ? (num_verts - 2) / triangles : 0;
+  index_ptr = WritePattern(index_ptr, s_fan_pattern<pr>, repetitions, index + 1, index);
+
+  u32 i = 2 + repetitions * triangles;
 
   if constexpr (pr)
   {
@@ -129,10 +326,43 @@ u16* AddFan(u16* index_ptr, u32 num_verts, u32 index)
  * A simple triangle has to be rendered for three vertices.
  * ZWW do this for sun rays
  */
+
+// Eight quads with primitive restart, four otherwise.
+template <bool pr>
+constexpr auto s_quads_pattern = MakePattern(pr ? 32 : 16, [] {
+  std::array<int, pr ? 40 : 24> indices{};
+  size_t n = 0;
+  for (int v = 0; v < (pr ? 32 : 16); v += 4)
+  {
+    if constexpr (pr)
+    {
+      indices[n++] = v + 1;
+      indices[n++] = v + 2;
+      indices[n++] = v;
+      indices[n++] = v + 3;
+      indices[n++] = RESTART;
+    }
+    else
+    {
+      indices[n++] = v;
+      indices[n++] = v + 1;
+      indices[n++] = v + 2;
+      indices[n++] = v;
+      indices[n++] = v + 2;
+      indices[n++] = v + 3;
+    }
+  }
+  return indices;
+}());
+
 template <bool pr>
 u16* AddQuads(u16* index_ptr, u32 num_verts, u32 index)
 {
-  u32 i = 3;
+  constexpr u32 quads = pr ? 8 : 4;
+  const u32 repetitions = num_verts / (quads * 4);
+  index_ptr = WritePattern(index_ptr, s_quads_pattern<pr>, repetitions, index, index);
+
+  u32 i = 3 + repetitions * quads * 4;
   for (; i < num_verts; i += 4)
   {
     if constexpr (pr)
@@ -168,7 +398,10 @@ u16* AddQuads_nonstandard(u16* index_ptr, u32 num_verts, u32 index)
 
 u16* AddLineList(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 1; i < num_verts; i += 2)
+  const u32 repetitions = num_verts / 8;
+  index_ptr = WritePattern(index_ptr, s_sequential_pattern, repetitions, index, index);
+
+  for (u32 i = 1 + repetitions * 8; i < num_verts; i += 2)
   {
     *index_ptr++ = index + i - 1;
     *index_ptr++ = index + i;
@@ -176,11 +409,25 @@ u16* AddLineList(u16* index_ptr, u32 num_verts, u32 index)
   return index_ptr;
 }
 
+// Eight lines.
+constexpr auto s_line_strip_pattern = MakePattern(8, [] {
+  std::array<int, 16> indices{};
+  for (int l = 0; l < 8; l++)
+  {
+    indices[l * 2] = l;
+    indices[l * 2 + 1] = l + 1;
+  }
+  return indices;
+}());
+
 // Shouldn't be used as strips as LineLists are much more common
 // so converting them to lists
 u16* AddLineStrip(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 1; i < num_verts; ++i)
+  const u32 repetitions = num_verts > 1 ? (num_verts - 1) / 8 : 0;
+  index_ptr = WritePattern(index_ptr, s_line_strip_pattern, repetitions, index, index);
+
+  for (u32 i = 1 + repetitions * 8; i < num_verts; ++i)
   {
     *index_ptr++ = index + i - 1;
     *index_ptr++ = index + i;
@@ -188,6 +435,37 @@ u16* AddLineStrip(u16* index_ptr, u32 num_verts, u32 index)
   return index_ptr;
 }
 
+// Eight lines with primitive restart, four otherwise. The pattern is in units of expanded
+// vertices, four per vertex.
+template <bool pr, bool linestrip>
+constexpr auto s_lines_vs_expand_pattern = MakePattern((pr ? 8 : 4) * (linestrip ? 4 : 8), [] {
+  std::array<int, pr ? 40 : 24> indices{};
+  size_t n = 0;
+  for (int l = 0; l < (pr ? 8 : 4); l++)
+  {
+    const int p0 = l * (linestrip ? 4 : 8);
+    const int p1 = p0 + 4;
+    if constexpr (pr)
+    {
+      indices[n++] = p0 + 0;
+      indices[n++] = p0 + 1;
+      indices[n++] = p1 + 2;
+      indices[n++] = p1 + 3;
+      indices[n++] = RESTART;
+    }
+    else
+    {
+      indices[n++] = p0 + 0;
+      indices[n++] = p0 + 1;
+      indices[n++] = p1 + 2;
+      indices[n++] = p0 + 1;
+      indices[n++] = p1 + 2;
+      indices[n++] = p1 + 3;
+    }
+  }
+  return indices;
+}());
+
 template <bool pr, bool linestrip>
 u16* AddLines_VSExpand(u16* index_ptr, u32 num_verts, u32 index)
 {
@@ -196,7 +474,13 @@ u16* AddLines_VSExpand(u16* index_ptr, u32 num_verts, u32 index)
   // Bit 1 indicates which point of the line (top/bottom for a vertical line)
   // VS Expand assumes the two points will be adjacent vertices
   constexpr u32 advance = linestrip ? 1 : 2;
-  for (u32 i = 1; i < num_verts; i += advance)
+  constexpr u32 lines = pr ? 8 : 4;
+  const u32 num_lines = num_verts > 1 ? (num_verts - 1 + advance - 1) / advance : 0;
+  const u32 repetitions = num_lines / lines;
+  index_ptr = WritePattern(index_ptr, s_lines_vs_expand_pattern<pr, linestrip>, repetitions,
+                           index << 2, index << 2);
+
+  for (u32 i = 1 + repetitions * lines * advance; i < num_verts; i += advance)
   {
     u32 p0 = (index + i - 1) << 2;
     u32 p1 = (index + i - 0) << 2;
@@ -223,19 +507,56 @@ u16* AddLines_VSExpand(u16* index_ptr, u32 num_verts, u32 index)
 
 u16* AddPoints(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 0; i != num_verts; ++i)
+  const u32 repetitions = num_verts / 8;
+  index_ptr = WritePattern(index_ptr, s_sequential_pattern, repetitions, index, index);
+
+  for (u32 i = repetitions * 8; i != num_verts; ++i)
   {
     *index_ptr++ = index + i;
   }
   return index_ptr;
 }
 
+// Eight points with primitive restart, four otherwise. The pattern is in units of expanded
+// vertices, four per vertex.
+template <bool pr>
+constexpr auto s_points_vs_expand_pattern = MakePattern(pr ? 32 : 16, [] {
+  std::array<int, pr ? 40 : 24> indices{};
+  size_t n = 0;
+  for (int base = 0; base < (pr ? 32 : 16); base += 4)
+  {
+    if constexpr (pr)
+    {
+      indices[n++] = base + 0;
+      indices[n++] = base + 1;
+      indices[n++] = base + 2;
+      indices[n++] = base + 3;
+      indices[n++] = RESTART;
+    }
+    else
+    {
+      indices[n++] = base + 0;
+      indices[n++] = base + 1;
+      indices[n++] = base + 2;
+      indices[n++] = base + 1;
+      indices[n++] = base + 2;
+      indices[n++] = base + 3;
+    }
+  }
+  return indices;
+}());
+
 template <bool pr>
 u16* AddPoints_VSExpand(u16* index_ptr, u32 num_verts, u32 index)
 {
   // VS Expand uses (index >> 2) as the base vertex
   // Bottom two bits indicate which of (TL, TR, BL, BR) this is
-  for (u32 i = 0; i < num_verts; ++i)
+  constexpr u32 points = pr ? 8 : 4;
+  const u32 repetitions = num_verts / points;
+  index_ptr = WritePattern(index_ptr, s_points_vs_expand_pattern<pr>, repetitions, index << 2,
+                           index << 2);
+
+  for (u32 i = repetitions * points; i < num_verts; ++i)
   {
     u32 base = (index + i) << 2;
     if constexpr (pr)
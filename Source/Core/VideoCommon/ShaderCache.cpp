@@ -120,9 +120,15 @@ void ShaderCache::Shutdown()
 
 const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid)
 {
+  if (m_last_gx_pipeline.pipeline && m_last_gx_pipeline.uid == uid)
+    return m_last_gx_pipeline.pipeline;
+
   auto it = m_gx_pipeline_cache.find(uid);
   if (it != m_gx_pipeline_cache.end() && !it->second.second)
+  {
+    m_last_gx_pipeline = {uid, it->second.first.get()};
     return it->second.first.get();
+  }
 
   const bool exists_in_cache = it != m_gx_pipeline_cache.end();
   std::unique_ptr<AbstractPipeline> pipeline;
@@ -136,14 +142,22 @@ const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid)
 
 std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const GXPipelineUid& uid)
 {
+  if (m_last_gx_pipeline.pipeline && m_last_gx_pipeline.uid == uid)
+    return m_last_gx_pipeline.pipeline;
+
   auto it = m_gx_pipeline_cache.find(uid);
   if (it != m_gx_pipeline_cache.end())
   {
     // .second is the pending flag, i.e. compiling in the background.
     if (!it->second.second)
+    {
+      m_last_gx_pipeline = {uid, it->second.first.get()};
       return it->second.first.get();
+    }
     else
+    {
       return {};
+    }
   }
 
   AppendGXPipelineUID(uid);
@@ -153,9 +167,15 @@ std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const
 
 const AbstractPipeline* ShaderCache::GetUberPipelineForUid(const GXUberPipelineUid& uid)
 {
+  if (m_last_gx_uber_pipeline.pipeline && m_last_gx_uber_pipeline.uid == uid)
+    return m_last_gx_uber_pipeline.pipeline;
+
   auto it = m_gx_uber_pipeline_cache.find(uid);
   if (it != m_gx_uber_pipeline_cache.end() && !it->second.second)
+  {
+    m_last_gx_uber_pipeline = {uid, it->second.first.get()};
     return it->second.first.get();
+  }
 
   std::unique_ptr<AbstractPipeline> pipeline;
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
@@ -387,6 +407,8 @@ void ShaderCache::LoadCaches()
 
 void ShaderCache::ClearCaches()
 {
+  m_last_gx_pipeline = {};
+  m_last_gx_uber_pipeline = {};
   ClearPipelineCache(m_gx_pipeline_cache, m_gx_pipeline_disk_cache);
   ClearShaderCache(m_vs_cache);
   ClearShaderCache(m_gs_cache);
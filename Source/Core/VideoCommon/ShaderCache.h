@@ -13,6 +13,8 @@
 #include <unordered_map>
 #include <utility>
 
+#include <xxh3.h>
+
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
 #include "Common/LinearDiskCache.h"
@@ -117,6 +119,27 @@ public:
 private:
   static constexpr size_t NUM_PALETTE_CONVERSION_SHADERS = 3;
 
+  // Hashes the bytes of a UID, which are compared with memcmp() and have their padding zeroed.
+  // This is deliberately not noexcept, which makes the hash tables keep the hash of each entry
+  // rather than hashing the large UIDs again to walk the buckets or to rehash.
+  struct UidHash
+  {
+    template <typename Uid>
+    size_t operator()(const Uid& uid) const
+    {
+      return static_cast<size_t>(XXH3_64bits(&uid, sizeof(uid)));
+    }
+  };
+
+  // The pipeline which was returned last, which consecutive draws with the same state get back
+  // without looking it up.
+  template <typename Uid>
+  struct LastPipeline
+  {
+    Uid uid;
+    const AbstractPipeline* pipeline = nullptr;
+  };
+
   void WaitForAsyncCompiler();
   void LoadCaches();
   void ClearCaches();
@@ -215,7 +238,7 @@ private:
       std::unique_ptr<AbstractShader> shader;
       bool pending = false;
     };
-    std::map<Uid, Shader> shader_map;
+    std::unordered_map<Uid, Shader, UidHash> shader_map;
     Common::LinearDiskCache<Uid, u8> disk_cache;
   };
   ShaderModuleCache<VertexShaderUid> m_vs_cache;
@@ -225,17 +248,22 @@ private:
   ShaderModuleCache<UberShader::PixelShaderUid> m_uber_ps_cache;
 
   // GX Pipeline Caches - .first - pipeline, .second - pending
-  std::map<GXPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>> m_gx_pipeline_cache;
-  std::map<GXUberPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>>
+  std::unordered_map<GXPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>, UidHash>
+      m_gx_pipeline_cache;
+  std::unordered_map<GXUberPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>,
+                     UidHash>
       m_gx_uber_pipeline_cache;
+  LastPipeline<GXPipelineUid> m_last_gx_pipeline;
+  LastPipeline<GXUberPipelineUid> m_last_gx_uber_pipeline;
   File::IOFile m_gx_pipeline_uid_cache_file;
   Common::LinearDiskCache<SerializedGXPipelineUid, u8> m_gx_pipeline_disk_cache;
   Common::LinearDiskCache<SerializedGXUberPipelineUid, u8> m_gx_uber_pipeline_disk_cache;
 
   // EFB copy to VRAM/RAM pipelines
-  std::map<TextureConversionShaderGen::TCShaderUid, std::unique_ptr<AbstractPipeline>>
+  std::unordered_map<TextureConversionShaderGen::TCShaderUid, std::unique_ptr<AbstractPipeline>,
+                     UidHash>
       m_efb_copy_to_vram_pipelines;
-  std::map<EFBCopyParams, std::unique_ptr<AbstractPipeline>> m_efb_copy_to_ram_pipelines;
+  std::unordered_map<EFBCopyParams, std::unique_ptr<AbstractPipeline>> m_efb_copy_to_ram_pipelines;
 
   // Copy pipeline for RGBA8 textures
   std::unique_ptr<AbstractPipeline> m_copy_rgba8_pipeline;
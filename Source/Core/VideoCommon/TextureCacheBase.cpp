@@ -101,6 +101,8 @@ TextureCacheBase::TextureCacheBase()
   TexDecoder_SetTexFmtOverlayOptions(m_backup_config.texfmt_overlay,
                                      m_backup_config.texfmt_overlay_center);
 
+  ConfigureDecodePool(g_ActiveConfig);
+
   TMEM::InvalidateAll();
 }
 
@@ -141,8 +143,10 @@ void TextureCacheBase::Invalidate()
     bind.reset();
   m_textures_by_hash.clear();
   m_textures_by_address.clear();
+  m_texture_ranges.Clear();
 
   m_texture_pool.clear();
+  m_decode_pool.ClearPrefetched();
 }
 
 void TextureCacheBase::OnConfigChanged(const VideoConfig& config)
@@ -171,9 +175,28 @@ void TextureCacheBase::OnConfigChanged(const VideoConfig& config)
     TexDecoder_SetTexFmtOverlayOptions(config.bTexFmtOverlayEnable, config.bTexFmtOverlayCenter);
   }
 
+  ConfigureDecodePool(config);
   SetBackupConfig(config);
 }
 
+void TextureCacheBase::ConfigureDecodePool(const VideoConfig& config)
+{
+  m_decode_pool.SetNumWorkers(config.GetTextureDecodingThreads());
+
+  // Prefetching only has an effect when the FIFO is preprocessed by the deterministic GPU thread,
+  // as that is where the texture units are seen before the draws which use them.
+  m_decode_pool.SetPrefetchEnabled(config.bPrefetchTextures && !config.UseGPUTextureDecoding(),
+                                   config.iSafeTextureCache_ColorSamples);
+}
+
+void TextureCacheBase::PrefetchTexture(u32 stage, const TexUnit& tex)
+{
+  if (!m_decode_pool.IsPrefetchEnabled())
+    return;
+
+  m_decode_pool.Prefetch(TextureInfo::FromTexUnit(stage, tex));
+}
+
 void TextureCacheBase::Cleanup(int _frameCount)
 {
   TexAddrCache::iterator iter = m_textures_by_address.begin();
@@ -335,7 +358,7 @@ RcTcacheEntry TextureCacheBase::ApplyPaletteToEntry(RcTcacheEntry& entry, const
     g_gfx->EndUtilityDrawing();
   }
 
-  m_textures_by_address.emplace(decoded_entry->addr, decoded_entry);
+  AddToAddressCache(decoded_entry->addr, decoded_entry);
 
   return decoded_entry;
 }
@@ -381,7 +404,7 @@ RcTcacheEntry TextureCacheBase::ReinterpretEntry(const RcTcacheEntry& existing_e
   g_gfx->EndUtilityDrawing();
   reinterpreted_entry->texture->FinishedRendering();
 
-  m_textures_by_address.emplace(reinterpreted_entry->addr, reinterpreted_entry);
+  AddToAddressCache(reinterpreted_entry->addr, reinterpreted_entry);
 
   return reinterpreted_entry;
 }
@@ -735,7 +758,7 @@ void TextureCacheBase::DoLoadState(PointerWrap& p)
 
     auto& entry = GetEntry(id);
     if (entry)
-      m_textures_by_address.emplace(addr, entry);
+      AddToAddressCache(addr, entry);
   }
 
   // Fill in hash map.
@@ -749,7 +772,7 @@ void TextureCacheBase::DoLoadState(PointerWrap& p)
 
     auto& entry = GetEntry(id);
     if (entry)
-      entry->textures_by_hash_iter = m_textures_by_hash.emplace(hash, entry);
+      AddToHashCache(hash, entry);
   }
 
   // Clear bound textures
@@ -1673,6 +1696,25 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
     // Initialized to null because only software loading uses this buffer
     u8* dst_buffer = nullptr;
 
+    // When decoding on the CPU, all levels are decoded at once, so that the decode pool can work on
+    // them in parallel. A texture which was prefetched doesn't need to be decoded at all.
+    std::unique_ptr<VideoCommon::TextureDecodePool::DecodedTexture> prefetched;
+    u8* predecoded = nullptr;
+    if (!decode_on_gpu)
+    {
+      prefetched = m_decode_pool.TakePrefetched(texture_info, creation_info.full_hash);
+      if (prefetched)
+      {
+        predecoded = prefetched->data.data();
+      }
+      else
+      {
+        CheckTempSize(VideoCommon::TextureDecodePool::GetDecodedSize(texture_info));
+        m_decode_pool.Decode(texture_info, creation_info.full_hash, m_temp);
+        predecoded = m_temp;
+      }
+    }
+
     if (!decode_on_gpu ||
         !DecodeTextureOnGPU(
             entry, 0, texture_info.GetData(), texture_info.GetTextureSize(),
@@ -1682,35 +1724,28 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
     {
       size_t decoded_texture_size = expanded_width * sizeof(u32) * expanded_height;
 
-      // Allocate memory for all levels at once
-      size_t total_texture_size = decoded_texture_size;
-
-      // For the downsample, we need 2 buffers; 1 is 1/4 of the original texture, the other 1/16
-      size_t mip_downsample_buffer_size = decoded_texture_size * 5 / 16;
-
-      size_t prev_level_size = decoded_texture_size;
-      for (u32 i = 1; i < texture_info.GetLevelCount(); ++i)
-      {
-        prev_level_size /= 4;
-        total_texture_size += prev_level_size;
-      }
-
-      // Add space for the downsampling at the end
-      total_texture_size += mip_downsample_buffer_size;
-
-      CheckTempSize(total_texture_size);
-      dst_buffer = m_temp;
-      if (!(texture_info.GetTextureFormat() == TextureFormat::RGBA8 && texture_info.IsFromTmem()))
+      if (predecoded)
       {
-        TexDecoder_Decode(dst_buffer, texture_info.GetData(), expanded_width, expanded_height,
-                          texture_info.GetTextureFormat(), texture_info.GetTlutAddress(),
-                          texture_info.GetTlutFormat());
+        dst_buffer = predecoded;
       }
       else
       {
-        TexDecoder_DecodeRGBA8FromTmem(dst_buffer, texture_info.GetData(),
-                                       texture_info.GetTmemOddAddress(), expanded_width,
-                                       expanded_height);
+        // Decoding on the GPU failed, so only this level is decoded here.
+        CheckTempSize(VideoCommon::TextureDecodePool::GetDecodedSize(texture_info));
+        dst_buffer = m_temp;
+        if (!(texture_info.GetTextureFormat() == TextureFormat::RGBA8 &&
+              texture_info.IsFromTmem()))
+        {
+          TexDecoder_Decode(dst_buffer, texture_info.GetData(), expanded_width, expanded_height,
+                            texture_info.GetTextureFormat(), texture_info.GetTlutAddress(),
+                            texture_info.GetTlutFormat());
+        }
+        else
+        {
+          TexDecoder_DecodeRGBA8FromTmem(dst_buffer, texture_info.GetData(),
+                                         texture_info.GetTmemOddAddress(), expanded_width,
+                                         expanded_height);
+        }
       }
 
       entry->texture->Load(0, width, height, expanded_width, dst_buffer, decoded_texture_size);
@@ -1741,9 +1776,12 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
         // No need to call CheckTempSize here, as the whole buffer is preallocated at the beginning
         const u32 decoded_mip_size =
             mip_level.GetExpandedWidth() * sizeof(u32) * mip_level.GetExpandedHeight();
-        TexDecoder_Decode(dst_buffer, mip_level.GetData(), mip_level.GetExpandedWidth(),
-                          mip_level.GetExpandedHeight(), texture_info.GetTextureFormat(),
-                          texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
+        if (!predecoded)
+        {
+          TexDecoder_Decode(dst_buffer, mip_level.GetData(), mip_level.GetExpandedWidth(),
+                            mip_level.GetExpandedHeight(), texture_info.GetTextureFormat(),
+                            texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
+        }
         entry->texture->Load(mip_level.GetLevel(), mip_level.GetRawWidth(),
                              mip_level.GetRawHeight(), mip_level.GetExpandedWidth(), dst_buffer,
                              decoded_mip_size);
@@ -1774,14 +1812,6 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
     }
   }
 
-  const auto iter = m_textures_by_address.emplace(texture_info.GetRawAddress(), entry);
-  if (safety_color_sample_size == 0 ||
-      std::max(texture_info.GetTextureSize(), creation_info.palette_size) <=
-          (u32)safety_color_sample_size * 8)
-  {
-    entry->textures_by_hash_iter = m_textures_by_hash.emplace(creation_info.full_hash, entry);
-  }
-
   const TextureAndTLUTFormat full_format(texture_info.GetTextureFormat(),
                                          texture_info.GetTlutFormat());
   entry->SetGeneralParameters(texture_info.GetRawAddress(), texture_info.GetTextureSize(),
@@ -1792,6 +1822,14 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
   entry->memory_stride = entry->BytesPerRow();
   entry->SetNotCopy();
 
+  const auto iter = AddToAddressCache(texture_info.GetRawAddress(), entry);
+  if (safety_color_sample_size == 0 ||
+      std::max(texture_info.GetTextureSize(), creation_info.palette_size) <=
+          (u32)safety_color_sample_size * 8)
+  {
+    AddToHashCache(creation_info.full_hash, entry);
+  }
+
   INCSTAT(g_stats.num_textures_uploaded);
   SETSTAT(g_stats.num_textures_alive, static_cast<int>(m_textures_by_address.size()));
 
@@ -1874,7 +1912,7 @@ RcTcacheEntry TextureCacheBase::GetXFBTexture(u32 address, u32 width, u32 height
   entry->texture->FinishedRendering();
 
   // Insert into the texture cache so we can re-use it next frame, if needed.
-  m_textures_by_address.emplace(entry->addr, entry);
+  AddToAddressCache(entry->addr, entry);
   SETSTAT(g_stats.num_textures_alive, static_cast<int>(m_textures_by_address.size()));
   INCSTAT(g_stats.num_textures_uploaded);
 
@@ -2460,11 +2498,7 @@ void TextureCacheBase::CopyRenderTargetToTexture(
 
       // Do not load textures by hash, if they were at least partly overwritten by an efb copy.
       // In this case, comparing the hash is not enough to check, if two textures are identical.
-      if (overlapping_entry->textures_by_hash_iter != m_textures_by_hash.end())
-      {
-        m_textures_by_hash.erase(overlapping_entry->textures_by_hash_iter);
-        overlapping_entry->textures_by_hash_iter = m_textures_by_hash.end();
-      }
+      RemoveFromHashCache(overlapping_entry.get());
     }
     ++iter.first;
   }
@@ -2487,7 +2521,7 @@ void TextureCacheBase::CopyRenderTargetToTexture(
   {
     const u64 hash = entry->CalculateHash();
     entry->SetHashes(hash, hash);
-    m_textures_by_address.emplace(dstAddr, std::move(entry));
+    AddToAddressCache(dstAddr, std::move(entry));
   }
 }
 
@@ -2714,17 +2748,34 @@ TextureCacheBase::TexAddrCache::iterator TextureCacheBase::GetTexCacheIter(TCach
   return m_textures_by_address.end();
 }
 
+TextureCacheBase::TexAddrCache::iterator TextureCacheBase::AddToAddressCache(u32 addr,
+                                                                             RcTcacheEntry entry)
+{
+  m_texture_ranges.Add(addr, entry->size_in_bytes);
+  return m_textures_by_address.emplace(addr, std::move(entry));
+}
+
+void TextureCacheBase::AddToHashCache(u64 hash, const RcTcacheEntry& entry)
+{
+  entry->textures_by_hash_iter = m_textures_by_hash.emplace(hash, entry);
+}
+
+void TextureCacheBase::RemoveFromHashCache(TCacheEntry* entry)
+{
+  if (entry->textures_by_hash_iter != m_textures_by_hash.end())
+  {
+    m_textures_by_hash.erase(entry->textures_by_hash_iter);
+    entry->textures_by_hash_iter = m_textures_by_hash.end();
+  }
+}
+
 std::pair<TextureCacheBase::TexAddrCache::iterator, TextureCacheBase::TexAddrCache::iterator>
 TextureCacheBase::FindOverlappingTextures(u32 addr, u32 size_in_bytes)
 {
-  // We index by the starting address only, so there is no way to query all textures
-  // which end after the given addr. But the GC textures have a limited size, so we
-  // look for all textures which have a start address bigger than addr minus the maximal
-  // texture size. But this yields false-positives which must be checked later on.
-
-  // 1024 x 1024 texel times 8 nibbles per texel
-  constexpr u32 max_texture_size = 1024 * 1024 * 4;
-  u32 lower_addr = addr > max_texture_size ? addr - max_texture_size : 0;
+  // We index by the starting address only, so the textures which start before addr but reach
+  // into it come from m_texture_ranges. Starting the search at the first of those yields
+  // false-positives for the textures in between, which must be checked later on.
+  const u32 lower_addr = m_texture_ranges.FindFirstAddress(addr);
   auto begin = m_textures_by_address.lower_bound(lower_addr);
   auto end = m_textures_by_address.upper_bound(addr + size_in_bytes);
 
@@ -2739,11 +2790,7 @@ TextureCacheBase::InvalidateTexture(TexAddrCache::iterator iter, bool discard_pe
 
   RcTcacheEntry& entry = iter->second;
 
-  if (entry->textures_by_hash_iter != m_textures_by_hash.end())
-  {
-    m_textures_by_hash.erase(entry->textures_by_hash_iter);
-    entry->textures_by_hash_iter = m_textures_by_hash.end();
-  }
+  RemoveFromHashCache(entry.get());
 
   // If this is a pending EFB copy, we don't want to flush it here.
   // Why? Because let's say a game is rendering a bloom-type effect, using EFB copies to essentially
@@ -2774,6 +2821,7 @@ TextureCacheBase::InvalidateTexture(TexAddrCache::iterator iter, bool discard_pe
     }
   }
   entry->invalidated = true;
+  m_texture_ranges.Remove(iter->first, entry->size_in_bytes);
 
   return m_textures_by_address.erase(iter);
 }
@@ -26,8 +26,10 @@
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/HiresTextures.h"
 #include "VideoCommon/TextureConfig.h"
+#include "VideoCommon/TextureDecodePool.h"
 #include "VideoCommon/TextureDecoder.h"
 #include "VideoCommon/TextureInfo.h"
+#include "VideoCommon/TextureRangeIndex.h"
 #include "VideoCommon/TextureUtils.h"
 #include "VideoCommon/VideoEvents.h"
 
@@ -87,6 +89,7 @@ struct EFBCopyParams
                                             rhs.all_copy_filter_coefs_needed,
                                             rhs.copy_filter_can_overflow, rhs.apply_gamma);
   }
+  bool operator==(const EFBCopyParams& rhs) const = default;
 
   PixelFormat efb_format;
   EFBCopyFormat copy_format;
@@ -97,6 +100,19 @@ struct EFBCopyParams
   bool apply_gamma;
 };
 
+template <>
+struct std::hash<EFBCopyParams>
+{
+  size_t operator()(const EFBCopyParams& params) const noexcept
+  {
+    const u32 id = static_cast<u32>(params.efb_format) << 9 |
+                   static_cast<u32>(params.copy_format) << 5 | params.depth << 4 |
+                   params.yuv << 3 | params.all_copy_filter_coefs_needed << 2 |
+                   params.copy_filter_can_overflow << 1 | params.apply_gamma;
+    return std::hash<u32>{}(id);
+  }
+};
+
 template <>
 struct fmt::formatter<EFBCopyParams>
 {
@@ -283,6 +299,10 @@ public:
   RcTcacheEntry GetXFBTexture(u32 address, u32 width, u32 height, u32 stride,
                               MathUtil::Rectangle<int>* display_rect);
 
+  // Starts decoding the texture of a texture unit on a worker thread, as it is likely to be used
+  // by one of the next draws. Called from the CPU thread when the FIFO is preprocessed.
+  void PrefetchTexture(u32 stage, const TexUnit& tex);
+
   virtual void BindTextures(BitSet32 used_textures, const std::array<SamplerState, 8>& samplers);
   void CopyRenderTargetToTexture(u32 dstAddr, EFBCopyFormat dstFormat, u32 width, u32 height,
                                  u32 dstStride, bool is_depth_copy,
@@ -351,6 +371,7 @@ private:
   bool CreateUtilityTextures();
 
   void SetBackupConfig(const VideoConfig& config);
+  void ConfigureDecodePool(const VideoConfig& config);
 
   RcTcacheEntry CreateTextureEntry(const TextureCreationInfo& creation_info,
                                    const TextureInfo& texture_info, int safety_color_sample_size,
@@ -374,8 +395,13 @@ private:
   TexPool::iterator FindMatchingTextureFromPool(const TextureConfig& config);
   TexAddrCache::iterator GetTexCacheIter(TCacheEntry* entry);
 
-  // Return all possible overlapping textures. As addr+size of the textures is not
-  // indexed, this may return false positives.
+  // Adds the entry to m_textures_by_address. Its size must already be set.
+  TexAddrCache::iterator AddToAddressCache(u32 addr, RcTcacheEntry entry);
+  void AddToHashCache(u64 hash, const RcTcacheEntry& entry);
+  void RemoveFromHashCache(TCacheEntry* entry);
+
+  // Return all possible overlapping textures. The range starts at the first texture which reaches
+  // into addr, so the textures which start between that one and addr may be false positives.
   std::pair<TexAddrCache::iterator, TexAddrCache::iterator>
   FindOverlappingTextures(u32 addr, u32 size_in_bytes);
 
@@ -415,6 +441,9 @@ private:
   // All textures in here will also be in m_textures_by_address
   TexHashCache m_textures_by_hash;
 
+  // The memory ranges of the textures in m_textures_by_address, used by FindOverlappingTextures
+  TextureRangeIndex m_texture_ranges;
+
   // m_bound_textures are actually active in the current draw
   // It's valid for textures to be in here after they've been invalidated
   std::array<RcTcacheEntry, 8> m_bound_textures{};
@@ -441,6 +470,8 @@ private:
   };
   BackupConfig m_backup_config = {};
 
+  VideoCommon::TextureDecodePool m_decode_pool;
+
   // Encoding texture used for EFB copies to RAM.
   std::unique_ptr<AbstractTexture> m_efb_encoding_texture;
   std::unique_ptr<AbstractFramebuffer> m_efb_encoding_framebuffer;
@@ -0,0 +1,351 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/TextureDecodePool.h"
+
+#include <algorithm>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "Common/Align.h"
+#include "Common/Hash.h"
+#include "Common/Thread.h"
+
+namespace VideoCommon
+{
+// Bands smaller than this aren't worth waking up a worker for.
+constexpr u32 MIN_TEXELS_PER_BAND = 128 * 128;
+
+// Prefetched textures which weren't used yet. Games load textures shortly before drawing with
+// them, so the texture cache either takes a prefetched texture soon or never does.
+constexpr size_t MAX_PREFETCHED_TEXTURES = 32;
+constexpr size_t MAX_QUEUED_PREFETCHES = 64;
+constexpr size_t MAX_RECENT_TEXTURES = 1024;
+
+TextureDecodePool::~TextureDecodePool()
+{
+  StopWorkers();
+}
+
+void TextureDecodePool::SetNumWorkers(u32 num_workers)
+{
+  if (num_workers == m_workers.size())
+    return;
+
+  StopWorkers();
+
+  {
+    std::lock_guard lk(m_mutex);
+    m_exit = false;
+    m_has_workers = num_workers > 0;
+  }
+  for (u32 i = 0; i < num_workers; i++)
+  {
+    m_workers.emplace_back([this, i] {
+      Common::SetCurrentThreadName(fmt::format("Texture decoder {}", i).c_str());
+      WorkerThread();
+    });
+  }
+}
+
+void TextureDecodePool::SetPrefetchEnabled(bool enabled, int hash_samples)
+{
+  m_prefetch_enabled.store(enabled, std::memory_order_relaxed);
+  m_hash_samples.store(hash_samples, std::memory_order_relaxed);
+  if (!enabled)
+    ClearPrefetched();
+}
+
+void TextureDecodePool::StopWorkers()
+{
+  {
+    std::lock_guard lk(m_mutex);
+    m_exit = true;
+    m_has_workers = false;
+    m_prefetch_queue.clear();
+  }
+  m_work_available.notify_all();
+
+  for (std::thread& worker : m_workers)
+    worker.join();
+  m_workers.clear();
+}
+
+size_t TextureDecodePool::GetDecodedSize(const TextureInfo& texture_info)
+{
+  const size_t decoded_texture_size =
+      texture_info.GetExpandedWidth() * sizeof(u32) * texture_info.GetExpandedHeight();
+
+  // Allocate memory for all levels at once
+  size_t total_texture_size = decoded_texture_size;
+
+  // For the downsample, we need 2 buffers; 1 is 1/4 of the original texture, the other 1/16
+  const size_t mip_downsample_buffer_size = decoded_texture_size * 5 / 16;
+
+  size_t prev_level_size = decoded_texture_size;
+  for (u32 i = 1; i < texture_info.GetLevelCount(); ++i)
+  {
+    prev_level_size /= 4;
+    total_texture_size += prev_level_size;
+  }
+
+  // Add space for the downsampling at the end
+  return total_texture_size + mip_downsample_buffer_size;
+}
+
+void TextureDecodePool::SplitIntoBands(const TextureInfo& texture_info, u8* dst,
+                                       std::vector<Band>* bands)
+{
+  const TextureFormat format = texture_info.GetTextureFormat();
+  const u32 block_height = texture_info.GetBlockHeight();
+
+  const auto add_level = [&](const u8* src, u32 width, u32 height) {
+    const u32 rows_per_band =
+        Common::AlignUp(std::max(MIN_TEXELS_PER_BAND / width, 1u), block_height);
+    for (u32 row = 0; row < height; row += rows_per_band)
+    {
+      bands->push_back({dst, src, width, row, std::min(rows_per_band, height - row), format,
+                        texture_info.GetTlutAddress(), texture_info.GetTlutFormat()});
+    }
+    dst += width * sizeof(u32) * height;
+  };
+
+  if (format == TextureFormat::RGBA8 && texture_info.IsFromTmem())
+  {
+    TexDecoder_DecodeRGBA8FromTmem(dst, texture_info.GetData(), texture_info.GetTmemOddAddress(),
+                                   texture_info.GetExpandedWidth(),
+                                   texture_info.GetExpandedHeight());
+    dst += texture_info.GetExpandedWidth() * sizeof(u32) * texture_info.GetExpandedHeight();
+  }
+  else
+  {
+    add_level(texture_info.GetData(), texture_info.GetExpandedWidth(),
+              texture_info.GetExpandedHeight());
+  }
+
+  for (const auto& mip_level : texture_info.GetMipMapLevels())
+  {
+    if (mip_level.IsDataValid())
+    {
+      add_level(mip_level.GetData(), mip_level.GetExpandedWidth(),
+                mip_level.GetExpandedHeight());
+    }
+  }
+}
+
+void TextureDecodePool::DecodeBand(const Band& band)
+{
+  // Block rows are stored one after another, so a band is decoded like a texture of its own.
+  const u32 src_offset = TexDecoder_GetTextureSizeInBytes(band.width, band.first_row, band.format);
+  u32* const dst = reinterpret_cast<u32*>(band.dst) + band.first_row * band.width;
+  _TexDecoder_DecodeImpl(dst, band.src + src_offset, band.width, band.num_rows, band.format,
+                         band.tlut, band.tlut_format);
+}
+
+void TextureDecodePool::DrawFormatOverlays(const TextureInfo& texture_info, u8* dst)
+{
+  const TextureFormat format = texture_info.GetTextureFormat();
+
+  // TexDecoder_DecodeRGBA8FromTmem doesn't draw the overlay either.
+  if (!(format == TextureFormat::RGBA8 && texture_info.IsFromTmem()))
+  {
+    TexDecoder_DrawFormatOverlay(dst, texture_info.GetExpandedWidth(),
+                                 texture_info.GetExpandedHeight(), format);
+  }
+  dst += texture_info.GetExpandedWidth() * sizeof(u32) * texture_info.GetExpandedHeight();
+
+  for (const auto& mip_level : texture_info.GetMipMapLevels())
+  {
+    if (!mip_level.IsDataValid())
+      continue;
+
+    TexDecoder_DrawFormatOverlay(dst, mip_level.GetExpandedWidth(), mip_level.GetExpandedHeight(),
+                                 format);
+    dst += mip_level.GetExpandedWidth() * sizeof(u32) * mip_level.GetExpandedHeight();
+  }
+}
+
+void TextureDecodePool::Decode(const TextureInfo& texture_info, u64 hash, u8* dst)
+{
+  std::vector<Band> bands;
+  SplitIntoBands(texture_info, dst, &bands);
+
+  if (m_workers.empty() || bands.size() <= 1)
+  {
+    for (const Band& band : bands)
+      DecodeBand(band);
+  }
+  else
+  {
+    std::unique_lock lk(m_mutex);
+    m_bands = std::move(bands);
+    m_next_band = 0;
+    m_bands_remaining = m_bands.size();
+    m_work_available.notify_all();
+
+    // Help out instead of idling until the workers are done.
+    while (m_next_band < m_bands.size())
+    {
+      const Band& band = m_bands[m_next_band++];
+      lk.unlock();
+      DecodeBand(band);
+      lk.lock();
+      m_bands_remaining--;
+    }
+
+    m_bands_done.wait(lk, [this] { return m_bands_remaining == 0; });
+    m_bands.clear();
+  }
+
+  DrawFormatOverlays(texture_info, dst);
+
+  if (m_prefetch_enabled.load(std::memory_order_relaxed))
+  {
+    std::lock_guard lk(m_mutex);
+    AddRecent(GetRecentKey(texture_info, hash));
+  }
+}
+
+u64 TextureDecodePool::GetRecentKey(const TextureInfo& texture_info, u64 hash)
+{
+  return hash ^ (u64{texture_info.GetRawAddress()} << 32) ^
+         (u64{texture_info.GetRawWidth()} << 16) ^ texture_info.GetRawHeight() ^
+         (static_cast<u64>(texture_info.GetTextureFormat()) << 48);
+}
+
+void TextureDecodePool::AddRecent(u64 key)
+{
+  if (!m_recent.insert(key).second)
+    return;
+
+  m_recent_order.push_back(key);
+  if (m_recent_order.size() > MAX_RECENT_TEXTURES)
+  {
+    m_recent.erase(m_recent_order.front());
+    m_recent_order.pop_front();
+  }
+}
+
+void TextureDecodePool::Prefetch(const TextureInfo& texture_info)
+{
+  if (!m_prefetch_enabled.load(std::memory_order_relaxed) || !texture_info.IsDataValid() ||
+      texture_info.IsFromTmem() || texture_info.GetPaletteSize())
+  {
+    return;
+  }
+
+  {
+    std::lock_guard lk(m_mutex);
+    if (!m_has_workers || m_prefetch_queue.size() >= MAX_QUEUED_PREFETCHES)
+      return;
+    m_prefetch_queue.push_back(texture_info);
+  }
+  m_work_available.notify_one();
+}
+
+void TextureDecodePool::DecodePrefetch(const TextureInfo& texture_info)
+{
+  // Hash the same way the texture cache does. Textures which are (still) in the texture cache
+  // don't need to be decoded.
+  const int hash_samples = m_hash_samples.load(std::memory_order_relaxed);
+  const u64 hash =
+      Common::GetHash64(texture_info.GetData(), texture_info.GetTextureSize(), hash_samples);
+  const u64 recent_key = GetRecentKey(texture_info, hash);
+  {
+    std::lock_guard lk(m_mutex);
+    if (m_recent.contains(recent_key))
+      return;
+  }
+
+  auto decoded = std::make_unique<DecodedTexture>();
+  decoded->address = texture_info.GetRawAddress();
+  decoded->format = texture_info.GetTextureFormat();
+  decoded->width = texture_info.GetRawWidth();
+  decoded->height = texture_info.GetRawHeight();
+  decoded->levels = texture_info.GetLevelCount();
+  decoded->hash = hash;
+  decoded->data.resize(GetDecodedSize(texture_info));
+
+  std::vector<Band> bands;
+  SplitIntoBands(texture_info, decoded->data.data(), &bands);
+  for (const Band& band : bands)
+    DecodeBand(band);
+  DrawFormatOverlays(texture_info, decoded->data.data());
+
+  // The emulated CPU keeps running while the texture is decoded. Drop the texture if its data
+  // changed in the meantime, as the decoded texture might not match its hash.
+  if (Common::GetHash64(texture_info.GetData(), texture_info.GetTextureSize(), hash_samples) !=
+      hash)
+  {
+    return;
+  }
+
+  std::lock_guard lk(m_mutex);
+  if (m_prefetched.size() >= MAX_PREFETCHED_TEXTURES)
+    m_prefetched.pop_front();
+  m_prefetched.push_back(std::move(decoded));
+  AddRecent(recent_key);
+}
+
+std::unique_ptr<TextureDecodePool::DecodedTexture>
+TextureDecodePool::TakePrefetched(const TextureInfo& texture_info, u64 hash)
+{
+  if (!m_prefetch_enabled.load(std::memory_order_relaxed))
+    return nullptr;
+
+  std::lock_guard lk(m_mutex);
+  const auto iter = std::ranges::find_if(m_prefetched, [&](const auto& decoded) {
+    return decoded->address == texture_info.GetRawAddress() &&
+           decoded->format == texture_info.GetTextureFormat() &&
+           decoded->width == texture_info.GetRawWidth() &&
+           decoded->height == texture_info.GetRawHeight() &&
+           decoded->levels == texture_info.GetLevelCount() && decoded->hash == hash;
+  });
+  if (iter == m_prefetched.end())
+    return nullptr;
+
+  std::unique_ptr<DecodedTexture> decoded = std::move(*iter);
+  m_prefetched.erase(iter);
+  return decoded;
+}
+
+void TextureDecodePool::ClearPrefetched()
+{
+  std::lock_guard lk(m_mutex);
+  m_prefetch_queue.clear();
+  m_prefetched.clear();
+  m_recent.clear();
+  m_recent_order.clear();
+}
+
+void TextureDecodePool::WorkerThread()
+{
+  std::unique_lock lk(m_mutex);
+  while (true)
+  {
+    m_work_available.wait(lk, [this] {
+      return m_exit || m_next_band < m_bands.size() || !m_prefetch_queue.empty();
+    });
+    if (m_exit)
+      return;
+
+    if (m_next_band < m_bands.size())
+    {
+      const Band& band = m_bands[m_next_band++];
+      lk.unlock();
+      DecodeBand(band);
+      lk.lock();
+      if (--m_bands_remaining == 0)
+        m_bands_done.notify_all();
+      continue;
+    }
+
+    const TextureInfo texture_info = std::move(m_prefetch_queue.front());
+    m_prefetch_queue.pop_front();
+    lk.unlock();
+    DecodePrefetch(texture_info);
+    lk.lock();
+  }
+}
+}  // namespace VideoCommon
@@ -0,0 +1,122 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureDecoder.h"
+#include "VideoCommon/TextureInfo.h"
+
+namespace VideoCommon
+{
+// Decodes textures on the CPU with a pool of worker threads. Textures which the texture cache
+// needs right away are split into bands of block rows, which the workers and the calling thread
+// decode together. Textures which are about to be used can also be decoded ahead of time.
+//
+// Decoded textures are laid out the way the texture cache uploads them: the base level, followed
+// by each mip level with valid data, followed by scratch space for the arbitrary mipmap detection.
+class TextureDecodePool
+{
+public:
+  struct DecodedTexture
+  {
+    u32 address;
+    TextureFormat format;
+    u32 width;
+    u32 height;
+    u32 levels;
+    u64 hash;
+    std::vector<u8> data;
+  };
+
+  TextureDecodePool() = default;
+  ~TextureDecodePool();
+
+  TextureDecodePool(const TextureDecodePool&) = delete;
+  TextureDecodePool& operator=(const TextureDecodePool&) = delete;
+
+  // Without workers, textures are decoded on the calling thread and nothing is prefetched.
+  void SetNumWorkers(u32 num_workers);
+
+  // hash_samples must match the samples the texture cache hashes textures with, so that the hashes
+  // of prefetched textures can be compared to it.
+  void SetPrefetchEnabled(bool enabled, int hash_samples);
+  bool IsPrefetchEnabled() const { return m_prefetch_enabled.load(std::memory_order_relaxed); }
+
+  static size_t GetDecodedSize(const TextureInfo& texture_info);
+
+  // Decodes all levels of the texture into dst, which must hold GetDecodedSize() bytes. hash is
+  // the hash of the texture data, which keeps it from being prefetched again while it is cached.
+  void Decode(const TextureInfo& texture_info, u64 hash, u8* dst);
+
+  // Starts decoding a texture which is going to be used soon on a worker. This may be called from
+  // any thread. Only non-paletted textures from RAM are prefetched, as TMEM isn't loaded yet.
+  void Prefetch(const TextureInfo& texture_info);
+
+  // Returns the prefetched texture which matches the texture and the hash of its data, if any.
+  std::unique_ptr<DecodedTexture> TakePrefetched(const TextureInfo& texture_info, u64 hash);
+
+  void ClearPrefetched();
+
+private:
+  struct Band
+  {
+    u8* dst;
+    const u8* src;
+    u32 width;
+    u32 first_row;
+    u32 num_rows;
+    TextureFormat format;
+    const u8* tlut;
+    TLUTFormat tlut_format;
+  };
+
+  static u64 GetRecentKey(const TextureInfo& texture_info, u64 hash);
+
+  // Appends the bands which the levels of the texture are split into. The base level of RGBA8
+  // textures from TMEM can't be split and is decoded right away instead.
+  static void SplitIntoBands(const TextureInfo& texture_info, u8* dst, std::vector<Band>* bands);
+  static void DecodeBand(const Band& band);
+  static void DrawFormatOverlays(const TextureInfo& texture_info, u8* dst);
+
+  void StopWorkers();
+  void WorkerThread();
+  void DecodePrefetch(const TextureInfo& texture_info);
+  void AddRecent(u64 key);
+
+  std::vector<std::thread> m_workers;
+
+  std::mutex m_mutex;
+  std::condition_variable m_work_available;
+  std::condition_variable m_bands_done;
+  bool m_exit = false;
+  // m_workers is only accessed by the thread which owns the pool, unlike this.
+  bool m_has_workers = false;
+
+  // The bands of the texture which is being decoded by Decode(). These take priority over
+  // prefetches.
+  std::vector<Band> m_bands;
+  size_t m_next_band = 0;
+  size_t m_bands_remaining = 0;
+
+  std::deque<TextureInfo> m_prefetch_queue;
+  std::deque<std::unique_ptr<DecodedTexture>> m_prefetched;
+
+  // Textures which were decoded recently, which likely are still in the texture cache. Prefetching
+  // them again would be a waste.
+  std::deque<u64> m_recent_order;
+  std::unordered_set<u64> m_recent;
+
+  std::atomic<bool> m_prefetch_enabled = false;
+  std::atomic<int> m_hash_samples = 0;
+};
+}  // namespace VideoCommon
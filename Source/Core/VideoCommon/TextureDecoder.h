@@ -202,6 +202,9 @@ void TexDecoder_DecodeTexelRGBA8FromTmem(u8* dst, const u8* src_ar, const u8* sr
 void TexDecoder_DecodeXFB(u8* dst, const u8* src, u32 width, u32 height, u32 stride);
 
 void TexDecoder_SetTexFmtOverlayOptions(bool enable, bool center);
+// Draws the name of the format onto a decoded texture if the overlay is enabled. TexDecoder_Decode
+// already does this, this is for textures which are decoded piece by piece.
+void TexDecoder_DrawFormatOverlay(u8* dst, int width, int height, TextureFormat texformat);
 
 /* Internal method, implemented by TextureDecoder_Generic and TextureDecoder_x64. */
 void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, TextureFormat texformat,
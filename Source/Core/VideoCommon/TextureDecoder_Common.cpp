@@ -255,8 +255,11 @@ void TexDecoder_SetTexFmtOverlayOptions(bool enable, bool center)
   TexFmt_Overlay_Center = center;
 }
 
-static void TexDecoder_DrawOverlay(u8* dst, int width, int height, TextureFormat texformat)
+void TexDecoder_DrawFormatOverlay(u8* dst, int width, int height, TextureFormat texformat)
 {
+  if (!TexFmt_Overlay_Enable)
+    return;
+
   int w = std::min(width, 40);
   int h = std::min(height, 10);
 
@@ -301,9 +304,7 @@ void TexDecoder_Decode(u8* dst, const u8* src, int width, int height, TextureFor
                        const u8* tlut, TLUTFormat tlutfmt)
 {
   _TexDecoder_DecodeImpl((u32*)dst, src, width, height, texformat, tlut, tlutfmt);
-
-  if (TexFmt_Overlay_Enable)
-    TexDecoder_DrawOverlay(dst, width, height, texformat);
+  TexDecoder_DrawFormatOverlay(dst, width, height, texformat);
 }
 
 static inline u32 DecodePixel_IA8(u16 val)
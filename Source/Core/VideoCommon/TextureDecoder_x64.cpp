@@ -161,6 +161,113 @@ static inline void DecodeBytes_IA4(u32* dst, const u8* src)
   }
 }
 
+// The AVX2 decoders below work on 8 texels at a time, which is a full row of the 8 texel wide
+// blocks, or two rows of the 4 texel wide blocks. Colors which are converted arithmetically are
+// held in the low 16 bits of each 32-bit element, already byte swapped.
+
+FUNCTION_TARGET_AVX2
+static inline __m256i DecodePixels_IA8_AVX2(__m256i val)
+{
+  // The colors aren't byte swapped for IA8: (0 0 I A) -> (A I I I)
+  const __m256i mask = _mm256_set_epi8(12, 13, 13, 13, 8, 9, 9, 9, 4, 5, 5, 5, 0, 1, 1, 1,
+                                       12, 13, 13, 13, 8, 9, 9, 9, 4, 5, 5, 5, 0, 1, 1, 1);
+  return _mm256_shuffle_epi8(val, mask);
+}
+
+FUNCTION_TARGET_AVX2
+static inline __m256i ByteSwapPixels_AVX2(__m256i val)
+{
+  // Also clears the upper 16 bits, as the palette lookups leave the next entry there.
+  const __m256i mask = _mm256_set_epi8(-128, -128, 12, 13, -128, -128, 8, 9, -128, -128, 4, 5,
+                                       -128, -128, 0, 1, -128, -128, 12, 13, -128, -128, 8, 9,
+                                       -128, -128, 4, 5, -128, -128, 0, 1);
+  return _mm256_shuffle_epi8(val, mask);
+}
+
+FUNCTION_TARGET_AVX2
+static inline __m256i Convert5To8_AVX2(__m256i val)
+{
+  return _mm256_or_si256(_mm256_slli_epi32(val, 3), _mm256_srli_epi32(val, 2));
+}
+
+FUNCTION_TARGET_AVX2
+static inline __m256i DecodePixels_RGB565_AVX2(__m256i val)
+{
+  const __m256i mask_x1f = _mm256_set1_epi32(0x1f);
+  const __m256i r = Convert5To8_AVX2(_mm256_and_si256(_mm256_srli_epi32(val, 11), mask_x1f));
+  const __m256i g6 = _mm256_and_si256(_mm256_srli_epi32(val, 5), _mm256_set1_epi32(0x3f));
+  const __m256i g = _mm256_or_si256(_mm256_slli_epi32(g6, 2), _mm256_srli_epi32(g6, 4));
+  const __m256i b = Convert5To8_AVX2(_mm256_and_si256(val, mask_x1f));
+  return _mm256_or_si256(_mm256_or_si256(r, _mm256_slli_epi32(g, 8)),
+                         _mm256_or_si256(_mm256_slli_epi32(b, 16), _mm256_set1_epi32(0xFF000000)));
+}
+
+FUNCTION_TARGET_AVX2
+static inline __m256i DecodePixels_RGB5A3_AVX2(__m256i val)
+{
+  // Both encodings are decoded, and the top bit of each color picks one of them.
+  const __m256i mask_x1f = _mm256_set1_epi32(0x1f);
+  const __m256i r5 = Convert5To8_AVX2(_mm256_and_si256(_mm256_srli_epi32(val, 10), mask_x1f));
+  const __m256i g5 = Convert5To8_AVX2(_mm256_and_si256(_mm256_srli_epi32(val, 5), mask_x1f));
+  const __m256i b5 = Convert5To8_AVX2(_mm256_and_si256(val, mask_x1f));
+  const __m256i rgb555 =
+      _mm256_or_si256(_mm256_or_si256(r5, _mm256_slli_epi32(g5, 8)),
+                      _mm256_or_si256(_mm256_slli_epi32(b5, 16), _mm256_set1_epi32(0xFF000000)));
+
+  const __m256i mask_x0f = _mm256_set1_epi32(0x0f);
+  const __m256i r4 = _mm256_and_si256(_mm256_srli_epi32(val, 8), mask_x0f);
+  const __m256i g4 = _mm256_and_si256(_mm256_srli_epi32(val, 4), mask_x0f);
+  const __m256i b4 = _mm256_and_si256(val, mask_x0f);
+  const __m256i rgb4 =
+      _mm256_or_si256(_mm256_or_si256(r4, _mm256_slli_epi32(g4, 8)), _mm256_slli_epi32(b4, 16));
+  // Convert4To8 on all three channels at once
+  const __m256i rgb8 = _mm256_or_si256(rgb4, _mm256_slli_epi32(rgb4, 4));
+  const __m256i a3 = _mm256_and_si256(_mm256_srli_epi32(val, 12), _mm256_set1_epi32(0x7));
+  const __m256i a8 = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(a3, 5),
+                                                     _mm256_slli_epi32(a3, 2)),
+                                     _mm256_srli_epi32(a3, 1));
+  const __m256i rgb4443 = _mm256_or_si256(rgb8, _mm256_slli_epi32(a8, 24));
+
+  const __m256i is_rgb555 = _mm256_srai_epi32(_mm256_slli_epi32(val, 16), 31);
+  return _mm256_blendv_epi8(rgb4443, rgb555, is_rgb555);
+}
+
+FUNCTION_TARGET_AVX2
+static inline __m256i DecodePalettePixels_AVX2(__m256i val, TLUTFormat tlutfmt)
+{
+  switch (tlutfmt)
+  {
+  case TLUTFormat::IA8:
+    return DecodePixels_IA8_AVX2(val);
+  case TLUTFormat::RGB565:
+    return DecodePixels_RGB565_AVX2(ByteSwapPixels_AVX2(val));
+  case TLUTFormat::RGB5A3:
+  default:
+    return DecodePixels_RGB5A3_AVX2(ByteSwapPixels_AVX2(val));
+  }
+}
+
+// Converts the first num_entries entries of the TLUT to RGBA8, so that looking up a color doesn't
+// need to decode it every time.
+FUNCTION_TARGET_AVX2
+static void DecodePalette_AVX2(u32* palette, const u8* tlut, int num_entries, TLUTFormat tlutfmt)
+{
+  for (int i = 0; i < num_entries; i += 8)
+  {
+    const __m128i entries = _mm_loadu_si128((const __m128i*)(tlut + i * sizeof(u16)));
+    const __m256i colors = DecodePalettePixels_AVX2(_mm256_cvtepu16_epi32(entries), tlutfmt);
+    _mm256_store_si256((__m256i*)(palette + i), colors);
+  }
+}
+
+// Stores the two halves of a register to the same columns of two rows.
+FUNCTION_TARGET_AVX2
+static inline void StoreTwoRows_AVX2(u32* dst, int width, __m256i val)
+{
+  _mm_storeu_si128((__m128i*)dst, _mm256_castsi256_si128(val));
+  _mm_storeu_si128((__m128i*)(dst + width), _mm256_extracti128_si256(val, 1));
+}
+
 #ifdef CHECK
 static void DecodeDXTBlock(u32* dst, const DXTBlock* src, int pitch)
 {
@@ -250,6 +357,77 @@ static void TexDecoder_DecodeImpl_C4(u32* dst, const u8* src, int width, int hei
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_C4_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // With only 16 colors, the palette fits into two registers, which is faster than a gather.
+  alignas(32) u32 palette[16];
+  DecodePalette_AVX2(palette, tlut, 16, tlutfmt);
+  const __m256i palette_lo = _mm256_load_si256((const __m256i*)palette);
+  const __m256i palette_hi = _mm256_load_si256((const __m256i*)(palette + 8));
+
+  // The first texel of each byte is in the high nibble.
+  const __m256i nibble_shifts = _mm256_set_epi32(0, 4, 0, 4, 0, 4, 0, 4);
+  const __m256i kMask_x0f = _mm256_set1_epi32(0x0f);
+  const __m256i kMask_x07 = _mm256_set1_epi32(0x07);
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 8 * yStep; iy < 8; iy++, xStep++)
+      {
+        // (0000 0000 0000 dcba) -> (ddcc bbaa) -> 8x 32-bit indices
+        const __m128i bytes = _mm_loadu_si32(src + 4 * xStep);
+        const __m256i indices = _mm256_and_si256(
+            _mm256_srlv_epi32(_mm256_cvtepu8_epi32(_mm_unpacklo_epi8(bytes, bytes)), nibble_shifts),
+            kMask_x0f);
+
+        const __m256i lo = _mm256_permutevar8x32_epi32(palette_lo, indices);
+        const __m256i hi = _mm256_permutevar8x32_epi32(palette_hi, indices);
+        const __m256i colors = _mm256_blendv_epi8(lo, hi, _mm256_cmpgt_epi32(indices, kMask_x07));
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x), colors);
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_I4_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  const __m128i kMask_x0f = _mm_set1_epi32(0x0f0f0f0fL);
+  const __m128i kMask_xf0 = _mm_set1_epi32(0xf0f0f0f0L);
+
+  // Same as the SSSE3 version, except that a whole row is shuffled at once.
+  const __m256i mask_row0 = _mm256_set_epi8(11, 11, 11, 11, 3, 3, 3, 3, 10, 10, 10, 10, 2, 2, 2, 2,
+                                            9, 9, 9, 9, 1, 1, 1, 1, 8, 8, 8, 8, 0, 0, 0, 0);
+  const __m256i mask_row1 = _mm256_set_epi8(15, 15, 15, 15, 7, 7, 7, 7, 14, 14, 14, 14, 6, 6, 6, 6,
+                                            13, 13, 13, 13, 5, 5, 5, 5, 12, 12, 12, 12, 4, 4, 4, 4);
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 8; iy += 2, xStep++)
+      {
+        const __m128i r0 = _mm_loadl_epi64((const __m128i*)(src + 8 * xStep));
+        const __m128i i1 = _mm_and_si128(r0, kMask_xf0);
+        const __m128i i11 = _mm_or_si128(i1, _mm_srli_epi16(i1, 4));
+        const __m128i i2 = _mm_and_si128(r0, kMask_x0f);
+        const __m128i i22 = _mm_or_si128(i2, _mm_slli_epi16(i2, 4));
+
+        const __m256i base = _mm256_broadcastsi128_si256(_mm_unpacklo_epi64(i11, i22));
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x),
+                            _mm256_shuffle_epi8(base, mask_row0));
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy + 1) * width + x),
+                            _mm256_shuffle_epi8(base, mask_row1));
+      }
+    }
+  }
+}
+
 FUNCTION_TARGET_SSSE3
 static void TexDecoder_DecodeImpl_I4_SSSE3(u32* dst, const u8* src, int width, int height,
                                            TextureFormat texformat, const u8* tlut,
@@ -390,6 +568,28 @@ static void TexDecoder_DecodeImpl_I4(u32* dst, const u8* src, int width, int hei
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_I8_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  const __m256i mask = _mm256_set_epi8(7, 7, 7, 7, 6, 6, 6, 6, 5, 5, 5, 5, 4, 4, 4, 4,
+                                       3, 3, 3, 3, 2, 2, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; ++iy, xStep++)
+      {
+        // (0000 0000 hgfe dcba) -> (hhhh gggg ffff eeee dddd cccc bbbb aaaa)
+        const __m256i r =
+            _mm256_broadcastq_epi64(_mm_loadl_epi64((const __m128i*)(src + 8 * xStep)));
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x), _mm256_shuffle_epi8(r, mask));
+      }
+    }
+  }
+}
+
 FUNCTION_TARGET_SSSE3
 static void TexDecoder_DecodeImpl_I8_SSSE3(u32* dst, const u8* src, int width, int height,
                                            TextureFormat texformat, const u8* tlut,
@@ -521,6 +721,29 @@ static void TexDecoder_DecodeImpl_I8(u32* dst, const u8* src, int width, int hei
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_C8_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  alignas(32) u32 palette[256];
+  DecodePalette_AVX2(palette, tlut, 256, tlutfmt);
+
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+      {
+        const __m256i indices =
+            _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(src + 8 * xStep)));
+        const __m256i colors = _mm256_i32gather_epi32((const int*)palette, indices, 4);
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x), colors);
+      }
+    }
+  }
+}
+
 static void TexDecoder_DecodeImpl_C8(u32* dst, const u8* src, int width, int height,
                                      TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt,
                                      int Wsteps4, int Wsteps8)
@@ -559,6 +782,32 @@ static void TexDecoder_DecodeImpl_C8(u32* dst, const u8* src, int width, int hei
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_IA4_AVX2(u32* dst, const u8* src, int width, int height,
+                                           TextureFormat texformat, const u8* tlut,
+                                           TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  const __m256i kMask_x0f = _mm256_set1_epi32(0x0f);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+      {
+        const __m256i val =
+            _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(src + 8 * xStep)));
+        const __m256i a4 = _mm256_srli_epi32(val, 4);
+        const __m256i l4 = _mm256_and_si256(val, kMask_x0f);
+        const __m256i a = _mm256_or_si256(a4, _mm256_slli_epi32(a4, 4));
+        const __m256i l = _mm256_or_si256(l4, _mm256_slli_epi32(l4, 4));
+        const __m256i lla = _mm256_or_si256(_mm256_slli_epi32(l, 16), _mm256_slli_epi32(a, 24));
+        const __m256i alll = _mm256_or_si256(_mm256_or_si256(l, _mm256_slli_epi32(l, 8)), lla);
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x), alll);
+      }
+    }
+  }
+}
+
 static void TexDecoder_DecodeImpl_IA4(u32* dst, const u8* src, int width, int height,
                                       TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt,
                                       int Wsteps4, int Wsteps8)
@@ -575,6 +824,28 @@ static void TexDecoder_DecodeImpl_IA4(u32* dst, const u8* src, int width, int he
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_IA8_AVX2(u32* dst, const u8* src, int width, int height,
+                                           TextureFormat texformat, const u8* tlut,
+                                           TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  const __m256i mask = _mm256_set_epi8(14, 15, 15, 15, 12, 13, 13, 13, 10, 11, 11, 11, 8, 9, 9, 9,
+                                       6, 7, 7, 7, 4, 5, 5, 5, 2, 3, 3, 3, 0, 1, 1, 1);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 4, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy += 2, xStep += 2)
+      {
+        // Two rows at once: (ponm lkji hgfe dcba) -> (oppp mnnn klll ijjj | ghhh efff cddd abbb)
+        const __m256i r0 =
+            _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(src + 8 * xStep)));
+        StoreTwoRows_AVX2(dst + (y + iy) * width + x, width, _mm256_shuffle_epi8(r0, mask));
+      }
+    }
+  }
+}
+
 FUNCTION_TARGET_SSSE3
 static void TexDecoder_DecodeImpl_IA8_SSSE3(u32* dst, const u8* src, int width, int height,
                                             TextureFormat texformat, const u8* tlut,
@@ -661,6 +932,32 @@ static void TexDecoder_DecodeImpl_IA8(u32* dst, const u8* src, int width, int he
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_C14X2_AVX2(u32* dst, const u8* src, int width, int height,
+                                             TextureFormat texformat, const u8* tlut,
+                                             TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // Unlike for C8, the 16384 entry palette is too large to be decoded ahead of time. Instead, the
+  // raw entries are gathered and converted for every texel. Each gather reads two bytes past the
+  // entry, which stays within TMEM as TLUT addresses only reach its first half.
+  const __m256i kMask_x3fff = _mm256_set1_epi32(0x3fff);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 4, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy += 2, xStep += 2)
+      {
+        const __m128i r0 = _mm_loadu_si128((const __m128i*)(src + 8 * xStep));
+        const __m256i indices =
+            _mm256_and_si256(ByteSwapPixels_AVX2(_mm256_cvtepu16_epi32(r0)), kMask_x3fff);
+        const __m256i entries = _mm256_i32gather_epi32((const int*)tlut, indices, 2);
+        StoreTwoRows_AVX2(dst + (y + iy) * width + x, width,
+                          DecodePalettePixels_AVX2(entries, tlutfmt));
+      }
+    }
+  }
+}
+
 static void TexDecoder_DecodeImpl_C14X2(u32* dst, const u8* src, int width, int height,
                                         TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt,
                                         int Wsteps4, int Wsteps8)
@@ -699,6 +996,25 @@ static void TexDecoder_DecodeImpl_C14X2(u32* dst, const u8* src, int width, int
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_RGB565_AVX2(u32* dst, const u8* src, int width, int height,
+                                              TextureFormat texformat, const u8* tlut,
+                                              TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 4, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy += 2, xStep += 2)
+      {
+        const __m128i r0 = _mm_loadu_si128((const __m128i*)(src + 8 * xStep));
+        const __m256i val = ByteSwapPixels_AVX2(_mm256_cvtepu16_epi32(r0));
+        StoreTwoRows_AVX2(dst + (y + iy) * width + x, width, DecodePixels_RGB565_AVX2(val));
+      }
+    }
+  }
+}
+
 static void TexDecoder_DecodeImpl_RGB565(u32* dst, const u8* src, int width, int height,
                                          TextureFormat texformat, const u8* tlut,
                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
@@ -770,6 +1086,25 @@ static void TexDecoder_DecodeImpl_RGB565(u32* dst, const u8* src, int width, int
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_RGB5A3_AVX2(u32* dst, const u8* src, int width, int height,
+                                              TextureFormat texformat, const u8* tlut,
+                                              TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 4, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy += 2, xStep += 2)
+      {
+        const __m128i r0 = _mm_loadu_si128((const __m128i*)(src + 8 * xStep));
+        const __m256i val = ByteSwapPixels_AVX2(_mm256_cvtepu16_epi32(r0));
+        StoreTwoRows_AVX2(dst + (y + iy) * width + x, width, DecodePixels_RGB5A3_AVX2(val));
+      }
+    }
+  }
+}
+
 FUNCTION_TARGET_SSSE3
 static void TexDecoder_DecodeImpl_RGB5A3_SSSE3(u32* dst, const u8* src, int width, int height,
                                                TextureFormat texformat, const u8* tlut,
@@ -997,6 +1332,33 @@ static void TexDecoder_DecodeImpl_RGB5A3(u32* dst, const u8* src, int width, int
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_RGBA8_AVX2(u32* dst, const u8* src, int width, int height,
+                                             TextureFormat texformat, const u8* tlut,
+                                             TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  const __m256i mask0312 = _mm256_set_epi8(12, 15, 13, 14, 8, 11, 9, 10, 4, 7, 5, 6, 0, 3, 1, 2,
+                                           12, 15, 13, 14, 8, 11, 9, 10, 4, 7, 5, 6, 0, 3, 1, 2);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 4, yStep++)
+    {
+      // All AR components of the block, followed by all GB components. The unpacks work within
+      // each half, so they produce rows 0 and 2, and rows 1 and 3.
+      const u8* src2 = src + 64 * yStep;
+      const __m256i ar = _mm256_loadu_si256((const __m256i*)src2);
+      const __m256i gb = _mm256_loadu_si256((const __m256i*)src2 + 1);
+
+      const __m256i rgba02 = _mm256_shuffle_epi8(_mm256_unpacklo_epi8(ar, gb), mask0312);
+      const __m256i rgba13 = _mm256_shuffle_epi8(_mm256_unpackhi_epi8(ar, gb), mask0312);
+
+      u32* const dst_block = dst + y * width + x;
+      StoreTwoRows_AVX2(dst_block, width * 2, rgba02);
+      StoreTwoRows_AVX2(dst_block + width, width * 2, rgba13);
+    }
+  }
+}
+
 FUNCTION_TARGET_SSSE3
 static void TexDecoder_DecodeImpl_RGBA8_SSSE3(u32* dst, const u8* src, int width, int height,
                                               TextureFormat texformat, const u8* tlut,
@@ -1153,6 +1515,75 @@ static void TexDecoder_DecodeImpl_RGBA8(u32* dst, const u8* src, int width, int
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_CMPR_AVX2(u32* dst, const u8* src, int width, int height,
+                                            TextureFormat texformat, const u8* tlut,
+                                            TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // Each half of the registers handles one of two DXT blocks which are next to each other. The
+  // four colors of a block form a palette, which the 2-bit indices select from with a permute.
+
+  // (c2 c1 c2 c1) of each block, byte swapped
+  const __m256i colors_mask =
+      _mm256_set_epi8(-128, -128, 10, 11, -128, -128, 8, 9, -128, -128, 10, 11, -128, -128, 8, 9,
+                      -128, -128, 2, 3, -128, -128, 0, 1, -128, -128, 2, 3, -128, -128, 0, 1);
+  // The lines of each block, in all elements of its half
+  const __m256i lines_mask =
+      _mm256_set_epi8(15, 14, 13, 12, 15, 14, 13, 12, 15, 14, 13, 12, 15, 14, 13, 12,
+                      7, 6, 5, 4, 7, 6, 5, 4, 7, 6, 5, 4, 7, 6, 5, 4);
+  // The first texel of each line is in the top 2 bits.
+  const __m256i index_shifts = _mm256_set_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+  const __m256i block_offsets = _mm256_set_epi32(4, 4, 4, 4, 0, 0, 0, 0);
+  const __m256i kMask_x03 = _mm256_set1_epi32(0x03);
+  // color[3] is the same as color[2] when averaging, but transparent.
+  const __m256i kMask_transparent_color3 =
+      _mm256_set_epi32(-1, -1, 0x00FFFFFF, -1, -1, -1, 0x00FFFFFF, -1);
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int z = 0, xStep = 2 * yStep; z < 2; ++z, xStep++)
+      {
+        const __m256i dxt = _mm256_broadcastsi128_si256(
+            _mm_loadu_si128((const __m128i*)(src + sizeof(DXTBlock) * 2 * xStep)));
+
+        const __m256i c = _mm256_shuffle_epi8(dxt, colors_mask);
+        const __m256i rgb = DecodePixels_RGB565_AVX2(c);
+
+        // With 16 bits per channel, (RGB1 RGB0) and (RGB0 RGB1):
+        // RGB2 = (RGB0 * 5 + RGB1 * 3) / 8, RGB3 = (RGB0 * 3 + RGB1 * 5) / 8
+        const __m256i rgb01 = _mm256_unpacklo_epi8(rgb, _mm256_setzero_si256());
+        const __m256i rgb10 = _mm256_shuffle_epi32(rgb01, _MM_SHUFFLE(1, 0, 3, 2));
+        const __m256i rgb01x5 = _mm256_add_epi16(rgb01, _mm256_slli_epi16(rgb01, 2));
+        const __m256i rgb10x3 = _mm256_add_epi16(rgb10, _mm256_slli_epi16(rgb10, 1));
+        const __m256i rgb23_blend = _mm256_srli_epi16(_mm256_add_epi16(rgb01x5, rgb10x3), 3);
+        const __m256i rgb23_average = _mm256_srli_epi16(_mm256_add_epi16(rgb01, rgb10), 1);
+
+        const __m256i blended = _mm256_packus_epi16(rgb23_blend, rgb23_blend);
+        const __m256i averaged = _mm256_and_si256(
+            _mm256_packus_epi16(rgb23_average, rgb23_average), kMask_transparent_color3);
+
+        // Blend if color0 > color1, average otherwise.
+        const __m256i c_swapped = _mm256_shuffle_epi32(c, _MM_SHUFFLE(2, 3, 0, 1));
+        const __m256i use_blend = _mm256_shuffle_epi32(_mm256_cmpgt_epi32(c, c_swapped), 0);
+        const __m256i rgb23 = _mm256_blendv_epi8(averaged, blended, use_blend);
+        const __m256i palette = _mm256_unpacklo_epi64(rgb, rgb23);
+
+        __m256i lines = _mm256_shuffle_epi8(dxt, lines_mask);
+        u32* dst32 = dst + (y + z * 4) * width + x;
+        for (int row = 0; row < 4; row++)
+        {
+          const __m256i indices = _mm256_or_si256(
+              _mm256_and_si256(_mm256_srlv_epi32(lines, index_shifts), kMask_x03), block_offsets);
+          _mm256_storeu_si256((__m256i*)(dst32 + row * width),
+                              _mm256_permutevar8x32_epi32(palette, indices));
+          lines = _mm256_srli_epi32(lines, 8);
+        }
+      }
+    }
+  }
+}
+
 static void TexDecoder_DecodeImpl_CMPR(u32* dst, const u8* src, int width, int height,
                                        TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt,
                                        int Wsteps4, int Wsteps8)
@@ -1418,11 +1849,18 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
   switch (texformat)
   {
   case TextureFormat::C4:
-    TexDecoder_DecodeImpl_C4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_C4_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else
+      TexDecoder_DecodeImpl_C4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
     break;
 
   case TextureFormat::I4:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_I4_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_I4_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                      Wsteps8);
     else
@@ -1430,7 +1868,10 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::I8:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_I8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_I8_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                      Wsteps8);
     else
@@ -1438,15 +1879,27 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::C8:
-    TexDecoder_DecodeImpl_C8(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_C8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else
+      TexDecoder_DecodeImpl_C8(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
     break;
 
   case TextureFormat::IA4:
-    TexDecoder_DecodeImpl_IA4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_IA4_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                     Wsteps8);
+    else
+      TexDecoder_DecodeImpl_IA4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                Wsteps8);
     break;
 
   case TextureFormat::IA8:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_IA8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                     Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_IA8_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                       Wsteps8);
     else
@@ -1455,17 +1908,28 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::C14X2:
-    TexDecoder_DecodeImpl_C14X2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
-                                Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_C14X2_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                       Wsteps8);
+    else
+      TexDecoder_DecodeImpl_C14X2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                  Wsteps8);
     break;
 
   case TextureFormat::RGB565:
-    TexDecoder_DecodeImpl_RGB565(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
-                                 Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_RGB565_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                        Wsteps8);
+    else
+      TexDecoder_DecodeImpl_RGB565(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                   Wsteps8);
     break;
 
   case TextureFormat::RGB5A3:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_RGB5A3_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                        Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_RGB5A3_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                          Wsteps8);
     else
@@ -1474,7 +1938,10 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::RGBA8:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_RGBA8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                       Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_RGBA8_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                         Wsteps8);
     else
@@ -1483,7 +1950,12 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::CMPR:
-    TexDecoder_DecodeImpl_CMPR(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_CMPR_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                      Wsteps8);
+    else
+      TexDecoder_DecodeImpl_CMPR(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                 Wsteps8);
     break;
 
   case TextureFormat::XFB:
@@ -19,8 +19,11 @@
 
 TextureInfo TextureInfo::FromStage(u32 stage)
 {
-  const auto tex = bpmem.tex.GetUnit(stage);
+  return FromTexUnit(stage, bpmem.tex.GetUnit(stage));
+}
 
+TextureInfo TextureInfo::FromTexUnit(u32 stage, const TexUnit& tex)
+{
   const auto texture_format = tex.texImage0.format;
   const auto tlut_format = tex.texTlut.tlut_format;
 
@@ -12,11 +12,13 @@
 
 enum class TextureFormat;
 enum class TLUTFormat;
+struct TexUnit;
 
 class TextureInfo final
 {
 public:
   static TextureInfo FromStage(u32 stage);
+  static TextureInfo FromTexUnit(u32 stage, const TexUnit& tex);
   TextureInfo(u32 stage, std::span<const u8> data, std::span<const u8> tlut_data, u32 address,
               TextureFormat texture_format, TLUTFormat tlut_format, u32 width, u32 height,
               bool from_tmem, std::span<const u8> tmem_odd, std::span<const u8> tmem_even,
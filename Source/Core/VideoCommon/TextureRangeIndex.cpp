@@ -0,0 +1,60 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/TextureRangeIndex.h"
+
+#include <algorithm>
+
+void TextureRangeIndex::Add(u32 addr, u32 size)
+{
+  // Empty ranges don't contain any address.
+  if (size == 0)
+    return;
+
+  const u32 last_page = GetLastPage(addr, size);
+  if (last_page >= m_pages.size())
+    m_pages.resize(last_page + 1);
+
+  for (u32 page = GetFirstPage(addr); page <= last_page; page++)
+    m_pages[page].push_back({addr, size});
+}
+
+void TextureRangeIndex::Remove(u32 addr, u32 size)
+{
+  if (size == 0)
+    return;
+
+  const Range range{addr, size};
+  const u32 last_page = GetLastPage(addr, size);
+  for (u32 page = GetFirstPage(addr); page <= last_page && page < m_pages.size(); page++)
+  {
+    std::vector<Range>& ranges = m_pages[page];
+    const auto iter = std::ranges::find(ranges, range);
+    if (iter == ranges.end())
+      continue;
+
+    *iter = ranges.back();
+    ranges.pop_back();
+  }
+}
+
+void TextureRangeIndex::Clear()
+{
+  m_pages.clear();
+}
+
+u32 TextureRangeIndex::FindFirstAddress(u32 addr) const
+{
+  const u32 page = GetFirstPage(addr);
+  if (page >= m_pages.size())
+    return addr;
+
+  // Every range which contains addr also covers its page.
+  u32 first_addr = addr;
+  for (const Range& range : m_pages[page])
+  {
+    if (range.addr < first_addr && addr - range.addr < range.size)
+      first_addr = range.addr;
+  }
+  return first_addr;
+}
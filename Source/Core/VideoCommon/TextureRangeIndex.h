@@ -0,0 +1,45 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+// Keeps track of the memory ranges of the textures in the texture cache, bucketed by the pages
+// they cover. This finds the textures which reach into an address by looking at a single page,
+// no matter how large the other textures in the cache are.
+class TextureRangeIndex final
+{
+public:
+  void Add(u32 addr, u32 size);
+
+  // Removes one range which was added with the same address and size.
+  void Remove(u32 addr, u32 size);
+
+  void Clear();
+
+  // Returns the lowest start address of the ranges which contain addr, or addr if there is none.
+  u32 FindFirstAddress(u32 addr) const;
+
+private:
+  static constexpr u32 PAGE_SHIFT = 16;
+
+  struct Range
+  {
+    u32 addr;
+    u32 size;
+
+    bool operator==(const Range&) const = default;
+  };
+
+  static u32 GetFirstPage(u32 addr) { return addr >> PAGE_SHIFT; }
+  static u32 GetLastPage(u32 addr, u32 size)
+  {
+    return static_cast<u32>((u64{addr} + size - 1) >> PAGE_SHIFT);
+  }
+
+  // The ranges which cover each page, in no particular order
+  std::vector<std::vector<Range>> m_pages;
+};
@@ -19,10 +19,17 @@ class VertexLoaderARM64 : public VertexLoaderBase, public Arm64Gen::ARM64CodeBlo
 public:
   VertexLoaderARM64(const TVtxDesc& vtx_desc, const VAT& vtx_att);
 
+  // RunVerticesWithoutCaches() only writes the vertices.
+  bool SupportsConcurrentRuns() const override { return true; }
+
 protected:
   int RunVertices(const u8* src, u8* dst, int count) override;
+  int RunVerticesWithoutCaches(const u8* src, u8* dst, int count) override;
 
 private:
+  // The same loader is generated twice, with and without writing the caches.
+  const u8* m_run_without_caches = nullptr;
+  bool m_write_caches = true;
   u32 m_src_ofs = 0;
   u32 m_dst_ofs = 0;
   Arm64Gen::FixupBranch m_skip_vertex;
@@ -33,5 +40,5 @@ private:
                   AttributeFormat* native_format, Arm64Gen::ARM64Reg reg, u32 offset);
   void ReadColor(VertexComponentFormat attribute, ColorFormat format, Arm64Gen::ARM64Reg reg,
                  u32 offset);
-  void GenerateVertexLoader();
+  void GenerateVertexLoader(bool write_caches);
 };
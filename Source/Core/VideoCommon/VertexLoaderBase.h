@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <memory>
 #include <string>
 #include <vector>
@@ -12,6 +13,8 @@
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/NativeVertexFormat.h"
 
+enum class VertexLoaderType : int;
+
 class VertexLoaderUID
 {
   std::array<u32, 5> vid{};
@@ -32,6 +35,22 @@ public:
   bool operator==(const VertexLoaderUID& rh) const { return vid == rh.vid; }
   size_t GetHash() const { return hash; }
 
+  TVtxDesc GetVertexDesc() const
+  {
+    TVtxDesc vtx_desc;
+    vtx_desc.low.Hex = vid[0];
+    vtx_desc.high.Hex = vid[1];
+    return vtx_desc;
+  }
+  VAT GetVAT() const
+  {
+    VAT vat;
+    vat.g0.Hex = vid[2];
+    vat.g1.Hex = vid[3];
+    vat.g2.Hex = vid[4];
+    return vat;
+  }
+
 private:
   size_t CalculateHash() const
   {
@@ -59,8 +78,19 @@ public:
   static u32 GetVertexComponents(const TVtxDesc& vtx_desc, const VAT& vtx_attr);
   static std::unique_ptr<VertexLoaderBase> CreateVertexLoader(const TVtxDesc& vtx_desc,
                                                               const VAT& vtx_attr);
+  static std::unique_ptr<VertexLoaderBase>
+  CreateVertexLoader(const TVtxDesc& vtx_desc, const VAT& vtx_attr, VertexLoaderType loader_type);
   virtual ~VertexLoaderBase() {}
   virtual int RunVertices(const u8* src, u8* dst, int count) = 0;
+  // Whether RunVerticesWithoutCaches() may be called from several threads at once, on different
+  // vertices, while one other thread calls RunVertices().
+  virtual bool SupportsConcurrentRuns() const { return false; }
+  // Like RunVertices(), but doesn't update VertexLoaderManager's caches of the last vertices.
+  // Loaders which support concurrent runs must implement this.
+  virtual int RunVerticesWithoutCaches(const u8* src, u8* dst, int count)
+  {
+    return RunVertices(src, dst, count);
+  }
 
   // per loader public state
   PortableVertexDeclaration m_native_vtx_decl{};
@@ -69,7 +99,7 @@ public:
 
   // used by VertexLoaderManager
   NativeVertexFormat* m_native_vertex_format = nullptr;
-  int m_numLoadedVertices = 0;
+  std::atomic<int> m_numLoadedVertices = 0;
 
 protected:
   VertexLoaderBase(const TVtxDesc& vtx_desc, const VAT& vtx_attr)
@@ -4,10 +4,12 @@
 #include "VideoCommon/VertexLoaderManager.h"
 
 #include <algorithm>
+#include <atomic>
 #include <iterator>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
@@ -15,8 +17,12 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
+#include "Common/Thread.h"
 
+#include "Core/ConfigManager.h"
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
@@ -50,7 +56,26 @@ u32 g_current_components;
 typedef std::unordered_map<VertexLoaderUID, std::unique_ptr<VertexLoaderBase>> VertexLoaderMap;
 static std::mutex s_vertex_loader_map_lock;
 static VertexLoaderMap s_vertex_loader_map;
-// TODO - change into array of pointers. Keep a map of all seen so far.
+
+// Loaders which were recently switched to, indexed by the hash of their UID. Games often switch
+// between a few vertex formats, and this avoids going through the lock and the map for them.
+struct LoaderCacheEntry
+{
+  VertexLoaderUID uid;
+  VertexLoaderBase* loader = nullptr;
+};
+using LoaderCache = std::array<LoaderCacheEntry, 64>;
+static LoaderCache s_main_loader_cache;
+static LoaderCache s_preprocess_loader_cache;
+
+// The UIDs of all loaders the game has used, so that they can be generated ahead of time.
+// Written with s_vertex_loader_map_lock held.
+constexpr u32 UID_CACHE_FILE_MAGIC = 0x49554C56;  // VLUI
+constexpr u32 UID_CACHE_VERSION = 1;
+using SerializedVertexLoaderUID = std::array<u32, 5>;
+static File::IOFile s_uid_cache_file;
+static std::thread s_preload_thread;
+static std::atomic<bool> s_stop_preloading;
 
 Common::EnumMap<u8*, CPArray::TexCoord7> cached_arraybases;
 
@@ -71,11 +96,147 @@ void Init()
 
 void Clear()
 {
+  if (s_preload_thread.joinable())
+  {
+    s_stop_preloading.store(true, std::memory_order_relaxed);
+    s_preload_thread.join();
+  }
+
   std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+  s_uid_cache_file.Close();
+  s_main_loader_cache.fill({});
+  s_preprocess_loader_cache.fill({});
   s_vertex_loader_map.clear();
   s_native_vertex_map.clear();
 }
 
+static size_t GetLoaderCacheIndex(const VertexLoaderUID& uid)
+{
+  // The low bits of the hash only depend on the low bits of each word, so mix in the rest.
+  return static_cast<size_t>((uid.GetHash() * 0x9E3779B97F4A7C15ULL) >> 58);
+}
+
+static void AppendVertexLoaderUID(const VertexLoaderUID& uid)
+{
+  if (!s_uid_cache_file.IsOpen())
+    return;
+
+  const TVtxDesc vtx_desc = uid.GetVertexDesc();
+  const VAT vat = uid.GetVAT();
+  const SerializedVertexLoaderUID serialized_uid{vtx_desc.low.Hex, vtx_desc.high.Hex, vat.g0.Hex,
+                                                 vat.g1.Hex, vat.g2.Hex};
+  if (!s_uid_cache_file.WriteBytes(&serialized_uid, sizeof(serialized_uid)))
+  {
+    WARN_LOG_FMT(VIDEO, "Writing vertex loader UID to cache failed, closing file.");
+    s_uid_cache_file.Close();
+  }
+}
+
+static void PreloadVertexLoaders(std::vector<VertexLoaderUID> uids, VertexLoaderType loader_type)
+{
+  Common::SetCurrentThreadName("Vertex loader preloading");
+
+  for (const VertexLoaderUID& uid : uids)
+  {
+    if (s_stop_preloading.load(std::memory_order_relaxed))
+      return;
+
+    {
+      std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+      if (s_vertex_loader_map.contains(uid))
+        continue;
+    }
+
+    // Generate the code without holding the lock, so that the GPU thread isn't held up by it.
+    std::unique_ptr<VertexLoaderBase> loader =
+        VertexLoaderBase::CreateVertexLoader(uid.GetVertexDesc(), uid.GetVAT(), loader_type);
+
+    std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+    if (s_vertex_loader_map.try_emplace(uid, std::move(loader)).second)
+      INCSTAT(g_stats.num_vertex_loaders);
+  }
+}
+
+void LoadVertexLoaderUIDCache()
+{
+  if (!g_ActiveConfig.bShaderCache)
+    return;
+
+  constexpr size_t CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
+  const std::string filename =
+      File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".vtxuidcache";
+
+  std::vector<VertexLoaderUID> uids;
+  std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+  if (s_uid_cache_file.Open(filename, "rb+"))
+  {
+    u32 existing_magic;
+    u32 existing_version;
+    bool uid_file_valid = false;
+    if (s_uid_cache_file.ReadBytes(&existing_magic, sizeof(existing_magic)) &&
+        s_uid_cache_file.ReadBytes(&existing_version, sizeof(existing_version)) &&
+        existing_magic == UID_CACHE_FILE_MAGIC && existing_version == UID_CACHE_VERSION)
+    {
+      // A partially written entry at the end (e.g. from a crash) is dropped and overwritten.
+      const u64 file_size = s_uid_cache_file.GetSize();
+      const size_t uid_count =
+          static_cast<size_t>(file_size - CACHE_HEADER_SIZE) / sizeof(SerializedVertexLoaderUID);
+      uid_file_valid = true;
+      for (size_t i = 0; i < uid_count; i++)
+      {
+        SerializedVertexLoaderUID serialized_uid;
+        if (!s_uid_cache_file.ReadBytes(&serialized_uid, sizeof(serialized_uid)))
+        {
+          uid_file_valid = false;
+          break;
+        }
+
+        TVtxDesc vtx_desc;
+        vtx_desc.low.Hex = serialized_uid[0];
+        vtx_desc.high.Hex = serialized_uid[1];
+        VAT vat;
+        vat.g0.Hex = serialized_uid[2];
+        vat.g1.Hex = serialized_uid[3];
+        vat.g2.Hex = serialized_uid[4];
+        uids.emplace_back(vtx_desc, vat);
+      }
+
+      // We open the file for reading and writing, so we must seek to the end before writing.
+      if (uid_file_valid)
+      {
+        uid_file_valid = s_uid_cache_file.Seek(
+            CACHE_HEADER_SIZE + uid_count * sizeof(SerializedVertexLoaderUID),
+            File::SeekOrigin::Begin);
+      }
+    }
+
+    // If the file is invalid, close it. We re-open and truncate it below.
+    if (!uid_file_valid)
+    {
+      s_uid_cache_file.Close();
+      uids.clear();
+    }
+  }
+
+  if (!s_uid_cache_file.IsOpen() && s_uid_cache_file.Open(filename, "wb"))
+  {
+    s_uid_cache_file.WriteBytes(&UID_CACHE_FILE_MAGIC, sizeof(UID_CACHE_FILE_MAGIC));
+    s_uid_cache_file.WriteBytes(&UID_CACHE_VERSION, sizeof(UID_CACHE_VERSION));
+
+    // Keep the loaders which were already created.
+    for (const auto& it : s_vertex_loader_map)
+      AppendVertexLoaderUID(it.first);
+  }
+
+  INFO_LOG_FMT(VIDEO, "Read {} vertex loader UIDs from {}", uids.size(), filename);
+  if (uids.empty())
+    return;
+
+  s_stop_preloading.store(false, std::memory_order_relaxed);
+  s_preload_thread =
+      std::thread(PreloadVertexLoaders, std::move(uids), g_ActiveConfig.vertex_loader_type);
+}
+
 void UpdateVertexArrayPointers()
 {
   // Anything to update?
@@ -213,33 +374,41 @@ VertexLoaderBase* GetOrCreateLoader(int vtx_attr_group)
   constexpr BitSet8& attr_dirty = IsPreprocess ? g_preprocess_vat_dirty : g_main_vat_dirty;
   constexpr auto& vertex_loaders =
       IsPreprocess ? g_preprocess_vertex_loaders : g_main_vertex_loaders;
+  constexpr auto& loader_cache = IsPreprocess ? s_preprocess_loader_cache : s_main_loader_cache;
 
-  VertexLoaderBase* loader;
-
-  // We are not allowed to create a native vertex format on preprocessing as this is on the wrong
-  // thread
-  bool check_for_native_format = !IsPreprocess;
+  const VertexLoaderUID uid(state->vtx_desc, state->vtx_attr[vtx_attr_group]);
+  LoaderCacheEntry& cache_entry = loader_cache[GetLoaderCacheIndex(uid)];
 
-  VertexLoaderUID uid(state->vtx_desc, state->vtx_attr[vtx_attr_group]);
-  std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
-  VertexLoaderMap::iterator iter = s_vertex_loader_map.find(uid);
-  if (iter != s_vertex_loader_map.end())
-  {
-    loader = iter->second.get();
-    check_for_native_format &= !loader->m_native_vertex_format;
-  }
-  else
-  {
-    auto [it, added] = s_vertex_loader_map.try_emplace(
-        uid,
-        VertexLoaderBase::CreateVertexLoader(state->vtx_desc, state->vtx_attr[vtx_attr_group]));
-    loader = it->second.get();
-    INCSTAT(g_stats.num_vertex_loaders);
-  }
-  if (check_for_native_format)
+  // Loaders in the main cache always have a native vertex format already.
+  VertexLoaderBase* loader = cache_entry.loader;
+  if (!loader || cache_entry.uid != uid) [[unlikely]]
   {
-    // search for a cached native vertex format
-    loader->m_native_vertex_format = GetOrCreateMatchingFormat(loader->m_native_vtx_decl);
+    // We are not allowed to create a native vertex format on preprocessing as this is on the
+    // wrong thread
+    bool check_for_native_format = !IsPreprocess;
+
+    std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+    VertexLoaderMap::iterator iter = s_vertex_loader_map.find(uid);
+    if (iter != s_vertex_loader_map.end())
+    {
+      loader = iter->second.get();
+      check_for_native_format &= !loader->m_native_vertex_format;
+    }
+    else
+    {
+      auto [it, added] = s_vertex_loader_map.try_emplace(
+          uid,
+          VertexLoaderBase::CreateVertexLoader(state->vtx_desc, state->vtx_attr[vtx_attr_group]));
+      loader = it->second.get();
+      INCSTAT(g_stats.num_vertex_loaders);
+      AppendVertexLoaderUID(uid);
+    }
+    if (check_for_native_format)
+    {
+      // search for a cached native vertex format
+      loader->m_native_vertex_format = GetOrCreateMatchingFormat(loader->m_native_vtx_decl);
+    }
+    cache_entry = {uid, loader};
   }
   vertex_loaders[vtx_attr_group] = loader;
   attr_dirty[vtx_attr_group] = false;
@@ -445,13 +614,14 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
       DataReader dst = g_vertex_manager->PrepareForAdditionalData(primitive, run, stride,
                                                                   cullall || can_cpu_cull);
 
-      const int num_loaded = loader->RunVertices(src, dst.GetPointer(), run);
+      bool all_culled = false;
+      const bool check_culled = can_cpu_cull && !cullall;
+      const int num_loaded = g_vertex_manager->LoadVertices(
+          loader, primitive, src, dst.GetPointer(), run, check_culled ? &all_culled : nullptr);
       src += loader->m_vertex_size * max_vertices;
 
-      if (can_cpu_cull && !cullall)
+      if (check_culled)
       {
-        const bool all_culled =
-            g_vertex_manager->AreAllVerticesCulled(loader, primitive, dst.GetPointer(), num_loaded);
         if (!all_culled)
         {
           DataReader new_dst = g_vertex_manager->DisableCullAll(stride);
@@ -28,6 +28,10 @@ using NativeVertexFormatMap =
 void Init();
 void Clear();
 
+// Reads the vertex formats which the game used in earlier sessions, and generates their loaders on
+// a worker thread before the first draws which use them.
+void LoadVertexLoaderUIDCache();
+
 void MarkAllDirty();
 
 // Creates or obtains a pointer to a VertexFormat representing decl.
@@ -46,7 +50,8 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
 
 namespace detail
 {
-// This will look for an existing loader in the global hashmap or create a new one if there is none.
+// This will look for an existing loader in a small cache of recently used loaders, then in the
+// global hashmap, and create a new one if there is none.
 // It should not be used directly because RefreshLoaders() has another cache for fast lookups.
 template <bool IsPreprocess = false>
 VertexLoaderBase* GetOrCreateLoader(int vtx_attr_group);
@@ -0,0 +1,208 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/VertexLoaderPool.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#include <fmt/format.h>
+
+#include "Common/Align.h"
+#include "Common/Thread.h"
+#include "VideoCommon/VertexLoaderBase.h"
+
+// Chunks smaller than this aren't worth waking up a worker for.
+constexpr int MIN_VERTICES_PER_CHUNK = 3000;
+
+// Chunks start at a multiple of this, so that they contain whole triangles and quads, and triangle
+// strips in chunks start with the same winding as the whole strip.
+constexpr u32 CHUNK_ALIGNMENT = 12;
+
+// Space for the largest possible vertex (45 floats and 2 u32s), as well as the few bytes which the
+// vertex loaders may write past the last vertex.
+constexpr size_t VERTEX_SCRATCH_SIZE = 256;
+
+VertexLoaderPool::~VertexLoaderPool()
+{
+  StopWorkers();
+}
+
+void VertexLoaderPool::SetNumWorkers(u32 num_workers)
+{
+  if (num_workers == m_workers.size())
+    return;
+
+  StopWorkers();
+
+  {
+    std::lock_guard lk(m_mutex);
+    m_exit = false;
+  }
+  for (u32 i = 0; i < num_workers; i++)
+  {
+    m_workers.emplace_back([this, i] {
+      Common::SetCurrentThreadName(fmt::format("Vertex loader {}", i).c_str());
+      WorkerThread();
+    });
+  }
+}
+
+void VertexLoaderPool::StopWorkers()
+{
+  {
+    std::lock_guard lk(m_mutex);
+    m_exit = true;
+  }
+  m_work_available.notify_all();
+
+  for (std::thread& worker : m_workers)
+    worker.join();
+  m_workers.clear();
+}
+
+bool VertexLoaderPool::CanSplit(const VertexLoaderBase* loader, int count) const
+{
+  return !m_workers.empty() && count >= MIN_VERTICES_PER_CHUNK * 2 &&
+         loader->SupportsConcurrentRuns();
+}
+
+void VertexLoaderPool::LoadChunk(Chunk* chunk, CPUCull::TransformBuffer* transform_buffer)
+{
+  int num_loaded;
+  if (chunk == &m_chunks.back())
+  {
+    // Only the last chunk updates the caches of the last vertices, so that they end up like they
+    // would on one thread.
+    num_loaded = m_loader->RunVertices(chunk->src, chunk->dst, chunk->count);
+  }
+  else
+  {
+    // Whatever the loader writes past the last vertex would overwrite the start of the next chunk,
+    // which may already be loaded. Load the last vertex on its own to keep that out of the buffer.
+    const u32 stride = m_loader->m_native_vtx_decl.stride;
+    num_loaded = m_loader->RunVerticesWithoutCaches(chunk->src, chunk->dst, chunk->count - 1);
+
+    alignas(16) std::array<u8, VERTEX_SCRATCH_SIZE> last_vertex;
+    const int last_loaded = m_loader->RunVerticesWithoutCaches(
+        chunk->src + (chunk->count - 1) * m_loader->m_vertex_size, last_vertex.data(), 1);
+    std::memcpy(chunk->dst + num_loaded * stride, last_vertex.data(), last_loaded * stride);
+    num_loaded += last_loaded;
+  }
+  chunk->num_loaded = num_loaded;
+
+  // Once anything is visible, the whole batch is drawn.
+  if (m_cull_chunks && num_loaded == chunk->count &&
+      !m_any_visible.load(std::memory_order_relaxed))
+  {
+    if (!m_culler->AreAllVerticesCulled(chunk->dst, num_loaded, transform_buffer))
+      m_any_visible.store(true, std::memory_order_relaxed);
+  }
+}
+
+int VertexLoaderPool::RunVertices(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
+                                  const u8* src, u8* dst, int count,
+                                  const CPUCull::Culler* culler, bool* all_culled)
+{
+  using OpcodeDecoder::Primitive;
+
+  const u32 stride = loader->m_native_vtx_decl.stride;
+  const int num_chunks =
+      std::min(static_cast<int>(m_workers.size()) + 1, count / MIN_VERTICES_PER_CHUNK);
+  const int chunk_size = static_cast<int>(
+      Common::AlignUp(static_cast<u32>((count + num_chunks - 1) / num_chunks), CHUNK_ALIGNMENT));
+
+  {
+    std::unique_lock lk(m_mutex);
+    m_loader = loader;
+    m_culler = culler;
+    // All triangles of a fan share the first vertex, so those can only be culled as a whole.
+    m_cull_chunks = culler && primitive != Primitive::GX_DRAW_TRIANGLE_FAN;
+    m_any_visible.store(false, std::memory_order_relaxed);
+
+    m_chunks.clear();
+    for (int first = 0; first < count; first += chunk_size)
+    {
+      const int chunk_count = std::min(chunk_size, count - first);
+      m_chunks.push_back(
+          {src + first * loader->m_vertex_size, dst + first * stride, chunk_count, 0});
+    }
+    m_next_chunk = 0;
+    m_chunks_remaining = m_chunks.size();
+    m_work_available.notify_all();
+
+    // Help out instead of idling until the workers are done.
+    while (m_next_chunk < m_chunks.size())
+    {
+      Chunk* const chunk = &m_chunks[m_next_chunk++];
+      lk.unlock();
+      LoadChunk(chunk, &m_transform_buffer);
+      lk.lock();
+      m_chunks_remaining--;
+    }
+
+    m_chunks_done.wait(lk, [this] { return m_chunks_remaining == 0; });
+  }
+
+  const bool skipped_vertices = std::ranges::any_of(
+      m_chunks, [](const Chunk& chunk) { return chunk.num_loaded != chunk.count; });
+  if (skipped_vertices) [[unlikely]]
+  {
+    // The chunks don't line up anymore. This is rare enough to just load the batch again, without
+    // counting its vertices twice.
+    loader->m_numLoadedVertices -= count;
+    const int num_loaded = loader->RunVertices(src, dst, count);
+    if (culler)
+      *all_culled = culler->AreAllVerticesCulled(dst, num_loaded, &m_transform_buffer);
+    return num_loaded;
+  }
+
+  if (culler)
+  {
+    if (!m_cull_chunks)
+    {
+      *all_culled = culler->AreAllVerticesCulled(dst, count, &m_transform_buffer);
+    }
+    else if (m_any_visible.load(std::memory_order_relaxed))
+    {
+      *all_culled = false;
+    }
+    else
+    {
+      *all_culled = true;
+
+      // The chunks of a strip don't include the two triangles across each boundary.
+      if (primitive == Primitive::GX_DRAW_TRIANGLE_STRIP)
+      {
+        for (size_t i = 1; i < m_chunks.size() && *all_culled; i++)
+        {
+          *all_culled =
+              culler->AreAllVerticesCulled(m_chunks[i].dst - 2 * stride, 4, &m_transform_buffer);
+        }
+      }
+    }
+  }
+
+  return count;
+}
+
+void VertexLoaderPool::WorkerThread()
+{
+  CPUCull::TransformBuffer transform_buffer;
+
+  std::unique_lock lk(m_mutex);
+  while (true)
+  {
+    m_work_available.wait(lk, [this] { return m_exit || m_next_chunk < m_chunks.size(); });
+    if (m_exit)
+      return;
+
+    Chunk* const chunk = &m_chunks[m_next_chunk++];
+    lk.unlock();
+    LoadChunk(chunk, &transform_buffer);
+    lk.lock();
+    if (--m_chunks_remaining == 0)
+      m_chunks_done.notify_all();
+  }
+}
@@ -0,0 +1,71 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/CPUCull.h"
+#include "VideoCommon/OpcodeDecoding.h"
+
+class VertexLoaderBase;
+
+// Loads large batches of vertices with a pool of worker threads. The batch is split into chunks
+// of consecutive vertices, which the workers and the calling thread load into their place in the
+// vertex buffer at the same time, so the vertices end up in the same order as when loading them
+// on one thread. Chunks can be checked by CPUCull right after they are loaded.
+class VertexLoaderPool
+{
+public:
+  VertexLoaderPool() = default;
+  ~VertexLoaderPool();
+
+  VertexLoaderPool(const VertexLoaderPool&) = delete;
+  VertexLoaderPool& operator=(const VertexLoaderPool&) = delete;
+
+  void SetNumWorkers(u32 num_workers);
+
+  // Whether RunVertices() would split up the batch.
+  bool CanSplit(const VertexLoaderBase* loader, int count) const;
+
+  // Loads the vertices like loader->RunVertices(). If culler is set, all_culled is set to whether
+  // all of the vertices are culled.
+  int RunVertices(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive, const u8* src,
+                  u8* dst, int count, const CPUCull::Culler* culler, bool* all_culled);
+
+private:
+  struct Chunk
+  {
+    const u8* src;
+    u8* dst;
+    int count;
+    int num_loaded;
+  };
+
+  void LoadChunk(Chunk* chunk, CPUCull::TransformBuffer* transform_buffer);
+  void StopWorkers();
+  void WorkerThread();
+
+  std::vector<std::thread> m_workers;
+
+  std::mutex m_mutex;
+  std::condition_variable m_work_available;
+  std::condition_variable m_chunks_done;
+  bool m_exit = false;
+
+  // The batch which is being loaded.
+  VertexLoaderBase* m_loader = nullptr;
+  const CPUCull::Culler* m_culler = nullptr;
+  bool m_cull_chunks = false;
+  std::vector<Chunk> m_chunks;
+  size_t m_next_chunk = 0;
+  size_t m_chunks_remaining = 0;
+  std::atomic<bool> m_any_visible = false;
+
+  CPUCull::TransformBuffer m_transform_buffer;
+};
@@ -44,9 +44,11 @@ static OpArg MPIC(const void* ptr)
 VertexLoaderX64::VertexLoaderX64(const TVtxDesc& vtx_desc, const VAT& vtx_att)
     : VertexLoaderBase(vtx_desc, vtx_att)
 {
-  AllocCodeSpace(4096);
+  AllocCodeSpace(8192);
   ClearCodeSpace();
-  GenerateVertexLoader();
+  GenerateVertexLoader(true);
+  m_run_without_caches = AlignCode16();
+  GenerateVertexLoader(false);
   WriteProtect(true);
 
   Common::JitRegister::Register(region, GetCodePtr(), "VertexLoaderX64\nVtx desc: \n{}\nVAT:\n{}",
@@ -124,6 +126,9 @@ void VertexLoaderX64::ReadVertex(OpArg data, VertexComponentFormat attribute,
   X64Reg coords = XMM0;
 
   const auto write_zfreeze = [&] {  // zfreeze
+    if (!m_write_caches)
+      return;
+
     if (native_format == &m_native_vtx_decl.position)
     {
       CMP(32, R(remaining_reg), Imm8(3));
@@ -415,8 +420,12 @@ void VertexLoaderX64::ReadColor(OpArg data, VertexComponentFormat attribute, Col
     m_src_ofs += load_bytes;
 }
 
-void VertexLoaderX64::GenerateVertexLoader()
+void VertexLoaderX64::GenerateVertexLoader(bool write_caches)
 {
+  m_write_caches = write_caches;
+  m_src_ofs = 0;
+  m_dst_ofs = 0;
+
   BitSet32 regs = {src_reg,  dst_reg,       scratch1,    scratch2,
                    scratch3, remaining_reg, skipped_reg, base_reg};
   regs &= ABI_ALL_CALLEE_SAVED;
@@ -447,11 +456,15 @@ void VertexLoaderX64::GenerateVertexLoader()
     MOV(32, MDisp(dst_reg, m_dst_ofs), R(scratch1));
 
     // zfreeze
-    CMP(32, R(remaining_reg), Imm8(3));
-    FixupBranch dont_store = J_CC(CC_AE);
-    MOV(32, MPIC(VertexLoaderManager::position_matrix_index_cache.data(), remaining_reg, SCALE_4),
-        R(scratch1));
-    SetJumpTarget(dont_store);
+    if (m_write_caches)
+    {
+      CMP(32, R(remaining_reg), Imm8(3));
+      FixupBranch dont_store = J_CC(CC_AE);
+      MOV(32,
+          MPIC(VertexLoaderManager::position_matrix_index_cache.data(), remaining_reg, SCALE_4),
+          R(scratch1));
+      SetJumpTarget(dont_store);
+    }
 
     m_native_vtx_decl.posmtx.components = 4;
     m_native_vtx_decl.posmtx.enable = true;
@@ -610,3 +623,10 @@ int VertexLoaderX64::RunVertices(const u8* src, u8* dst, int count)
   return ((int (*)(const u8* src, u8* dst, int count, const void* base))region)(src, dst, count,
                                                                                 memory_base_ptr);
 }
+
+int VertexLoaderX64::RunVerticesWithoutCaches(const u8* src, u8* dst, int count)
+{
+  m_numLoadedVertices += count;
+  return ((int (*)(const u8* src, u8* dst, int count, const void* base))m_run_without_caches)(
+      src, dst, count, memory_base_ptr);
+}
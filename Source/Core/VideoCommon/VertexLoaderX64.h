@@ -17,10 +17,17 @@ class VertexLoaderX64 : public VertexLoaderBase, public Gen::X64CodeBlock
 public:
   VertexLoaderX64(const TVtxDesc& vtx_desc, const VAT& vtx_att);
 
+  // RunVerticesWithoutCaches() only writes the vertices.
+  bool SupportsConcurrentRuns() const override { return true; }
+
 protected:
   int RunVertices(const u8* src, u8* dst, int count) override;
+  int RunVerticesWithoutCaches(const u8* src, u8* dst, int count) override;
 
 private:
+  // The same loader is generated twice, with and without writing the caches.
+  const u8* m_run_without_caches = nullptr;
+  bool m_write_caches = true;
   u32 m_src_ofs = 0;
   u32 m_dst_ofs = 0;
   Gen::FixupBranch m_skip_vertex;
@@ -29,5 +36,5 @@ private:
                   int count_in, int count_out, bool dequantize, u8 scaling_exponent,
                   AttributeFormat* native_format);
   void ReadColor(Gen::OpArg data, VertexComponentFormat attribute, ColorFormat format);
-  void GenerateVertexLoader();
+  void GenerateVertexLoader(bool write_caches);
 };
@@ -6,6 +6,7 @@
 #include <array>
 #include <cmath>
 #include <memory>
+#include <optional>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
@@ -126,6 +127,7 @@ bool VertexManagerBase::Initialize()
   m_index_generator.Init();
   m_custom_shader_cache = std::make_unique<CustomShaderCache>();
   m_cpu_cull.Init();
+  m_vertex_loader_pool.SetNumWorkers(g_ActiveConfig.GetVertexLoadingThreads());
   return true;
 }
 
@@ -139,11 +141,22 @@ void VertexManagerBase::AddIndices(OpcodeDecoder::Primitive primitive, u32 num_v
   m_index_generator.AddIndices(primitive, num_vertices);
 }
 
-bool VertexManagerBase::AreAllVerticesCulled(VertexLoaderBase* loader,
-                                             OpcodeDecoder::Primitive primitive, const u8* src,
-                                             u32 count)
+int VertexManagerBase::LoadVertices(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
+                                    const u8* src, u8* dst, int count, bool* all_culled)
 {
-  return m_cpu_cull.AreAllVerticesCulled(loader, primitive, src, count);
+  if (!m_vertex_loader_pool.CanSplit(loader, count))
+  {
+    const int num_loaded = loader->RunVertices(src, dst, count);
+    if (all_culled)
+      *all_culled = m_cpu_cull.AreAllVerticesCulled(loader, primitive, dst, num_loaded);
+    return num_loaded;
+  }
+
+  std::optional<CPUCull::Culler> culler;
+  if (all_culled)
+    culler = m_cpu_cull.GetCuller(loader, primitive);
+  return m_vertex_loader_pool.RunVertices(loader, primitive, src, dst, count,
+                                          culler ? &*culler : nullptr, all_culled);
 }
 
 DataReader VertexManagerBase::PrepareForAdditionalData(OpcodeDecoder::Primitive primitive,
@@ -931,6 +944,8 @@ void VertexManagerBase::OnConfigChange()
 {
   // Reload index generator function tables in case VS expand config changed
   m_index_generator.Init();
+
+  m_vertex_loader_pool.SetNumWorkers(g_ActiveConfig.GetVertexLoadingThreads());
 }
 
 void VertexManagerBase::OnDraw()
@@ -13,6 +13,7 @@
 #include "VideoCommon/IndexGenerator.h"
 #include "VideoCommon/RenderState.h"
 #include "VideoCommon/ShaderCache.h"
+#include "VideoCommon/VertexLoaderPool.h"
 #include "VideoCommon/VideoEvents.h"
 
 struct CustomPixelShaderContents;
@@ -108,8 +109,10 @@ public:
 
   PrimitiveType GetCurrentPrimitiveType() const { return m_current_primitive_type; }
   void AddIndices(OpcodeDecoder::Primitive primitive, u32 num_vertices);
-  bool AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
-                            const u8* src, u32 count);
+  // Loads the vertices into dst, with the vertex loading threads for large batches. If all_culled
+  // is set, it is set to whether CPUCull culls all of the vertices.
+  int LoadVertices(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive, const u8* src,
+                   u8* dst, int count, bool* all_culled);
   virtual DataReader PrepareForAdditionalData(OpcodeDecoder::Primitive primitive, u32 count,
                                               u32 stride, bool cullall);
   /// Switch cullall off after a call to PrepareForAdditionalData with cullall true
@@ -218,6 +221,7 @@ protected:
 
   IndexGenerator m_index_generator;
   CPUCull m_cpu_cull;
+  VertexLoaderPool m_vertex_loader_pool;
 
 private:
   // Minimum number of draws per command buffer when attempting to preempt a readback operation.
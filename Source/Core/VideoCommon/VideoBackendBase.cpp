@@ -370,6 +370,7 @@ bool VideoBackendBase::InitializeShared(std::unique_ptr<AbstractGfx> gfx,
   }
 
   g_shader_cache->InitializeShaderCache();
+  VertexLoaderManager::LoadVertexLoaderUIDCache();
   system.GetCustomResourceManager().Initialize();
 
   return true;
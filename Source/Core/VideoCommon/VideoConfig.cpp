@@ -120,6 +120,9 @@ void VideoConfig::Refresh()
   bDumpEFBTarget = Config::Get(Config::GFX_DUMP_EFB_TARGET);
   bDumpXFBTarget = Config::Get(Config::GFX_DUMP_XFB_TARGET);
   bEnableGPUTextureDecoding = Config::Get(Config::GFX_ENABLE_GPU_TEXTURE_DECODING);
+  iTextureDecodingThreads = Config::Get(Config::GFX_TEXTURE_DECODING_THREADS);
+  bPrefetchTextures = Config::Get(Config::GFX_PREFETCH_TEXTURES);
+  iVertexLoadingThreads = Config::Get(Config::GFX_VERTEX_LOADING_THREADS);
   bPreferVSForLinePointExpansion = Config::Get(Config::GFX_PREFER_VS_FOR_LINE_POINT_EXPANSION);
   bEnablePixelLighting = Config::Get(Config::GFX_ENABLE_PIXEL_LIGHTING);
   bFastDepthCalc = Config::Get(Config::GFX_FAST_DEPTH_CALC);
@@ -284,6 +287,26 @@ u32 VideoConfig::GetShaderPrecompilerThreads() const
     return 1;
 }
 
+u32 VideoConfig::GetTextureDecodingThreads() const
+{
+  if (iTextureDecodingThreads >= 0)
+    return static_cast<u32>(iTextureDecodingThreads);
+
+  // Automatic number. The GPU thread decodes as well, so leave the threads of the CPU and the GPU
+  // and one more for the rest of the system alone.
+  return static_cast<u32>(std::clamp(cpu_info.num_cores - 3, 0, 4));
+}
+
+u32 VideoConfig::GetVertexLoadingThreads() const
+{
+  if (iVertexLoadingThreads >= 0)
+    return static_cast<u32>(iVertexLoadingThreads);
+
+  // Automatic number, like for texture decoding. Only large batches are split up, so a few
+  // threads are enough.
+  return static_cast<u32>(std::clamp(cpu_info.num_cores - 3, 0, 3));
+}
+
 void CheckForConfigChanges()
 {
   const ShaderHostConfig old_shader_host_config = ShaderHostConfig::GetCurrent();
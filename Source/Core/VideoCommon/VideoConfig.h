@@ -273,6 +273,14 @@ struct VideoConfig final
   bool bDumpXFBTarget = false;
   bool bBorderlessFullscreen = false;
   bool bEnableGPUTextureDecoding = false;
+  // Number of threads which decode textures on the CPU along with the GPU thread.
+  // -1 uses an automatic number based on the CPU threads.
+  int iTextureDecodingThreads = 0;
+  // Decode textures as soon as they are set in the FIFO. Requires the deterministic GPU thread.
+  bool bPrefetchTextures = false;
+  // Number of threads which load large batches of vertices along with the GPU thread.
+  // -1 uses an automatic number based on the CPU threads.
+  int iVertexLoadingThreads = 0;
   bool bPreferVSForLinePointExpansion = false;
   bool bGraphicMods = false;
   std::optional<GraphicsModGroupConfig> graphics_mod_config;
@@ -390,6 +398,8 @@ struct VideoConfig final
   bool UsingUberShaders() const;
   u32 GetShaderCompilerThreads() const;
   u32 GetShaderPrecompilerThreads() const;
+  u32 GetTextureDecodingThreads() const;
+  u32 GetVertexLoadingThreads() const;
 
   float GetCustomAspectRatio() const { return (float)custom_aspect_width / custom_aspect_height; }
 };
@@ -1,8 +1,11 @@
 // Copyright 2025 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <atomic>
+
 #include <gtest/gtest.h>
 
+#include "Common/Semaphore.h"
 #include "Common/WorkQueueThread.h"
 
 TEST(WorkQueueThread, Simple)
@@ -51,3 +54,32 @@ TEST(WorkQueueThread, Simple)
   // Still running after cancellation.
   EXPECT_EQ(x, 2);
 }
+
+TEST(WorkQueueThread, WaitForQueueSize)
+{
+  Common::WorkQueueThreadSP<int> worker;
+
+  std::atomic<int> processed = 0;
+  Common::Semaphore release(0, 4);
+  worker.Reset("test worker", [&](int) {
+    release.Wait();
+    ++processed;
+  });
+
+  for (int i = 0; i != 4; ++i)
+    worker.Push(i);
+
+  // The first item is being processed and blocks the rest.
+  worker.WaitForQueueSize(4);
+  EXPECT_EQ(processed, 0);
+
+  for (int i = 0; i != 2; ++i)
+    release.Post();
+  worker.WaitForQueueSize(2);
+  EXPECT_GE(processed, 2);
+
+  for (int i = 0; i != 2; ++i)
+    release.Post();
+  worker.WaitForQueueSize(0);
+  EXPECT_EQ(processed, 4);
+}
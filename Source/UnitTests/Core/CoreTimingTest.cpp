@@ -3,9 +3,14 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
 #include <bitset>
 #include <string>
+#include <tuple>
+#include <vector>
+
+#include <fmt/format.h>
 
 #include "Common/Config/Config.h"
 #include "Common/FileUtil.h"
@@ -393,3 +398,122 @@ TEST(CoreTiming, Overclocking)
   Config::SetCurrent(Config::MAIN_OVERCLOCK, 1.0f);
   AdvanceAndCheck(system, 4, MAX_SLICE_LENGTH);
 }
+
+namespace RemoveEventTest
+{
+static std::vector<u64> s_fired_events;
+
+static void RecordingCallback(Core::System& system, const u64 userdata, const s64 lateness)
+{
+  s_fired_events.push_back(userdata);
+}
+}  // namespace RemoveEventTest
+
+TEST(CoreTiming, RemoveEvent)
+{
+  using namespace RemoveEventTest;
+
+  auto& system = Core::System::GetInstance();
+
+  ScopeInit guard(system);
+  ASSERT_TRUE(guard.UserDirectoryExists());
+
+  auto& core_timing = system.GetCoreTiming();
+  auto& ppc_state = system.GetPPCState();
+
+  CoreTiming::EventType* cb_a = core_timing.RegisterEvent("callbackA", CallbackTemplate<0>);
+  CoreTiming::EventType* cb_b = core_timing.RegisterEvent("callbackB", CallbackTemplate<1>);
+  CoreTiming::EventType* cb_c = core_timing.RegisterEvent("callbackC", CallbackTemplate<2>);
+
+  // Enter slice 0
+  core_timing.Advance();
+
+  core_timing.ScheduleEvent(100, cb_a, CB_IDS[0]);
+  core_timing.ScheduleEvent(200, cb_b, CB_IDS[1]);
+  core_timing.ScheduleEvent(300, cb_c, CB_IDS[2]);
+  EXPECT_EQ(100, ppc_state.downcount);
+
+  // Removing the event at the front must not leave it there, and events of the same type which
+  // are scheduled afterwards must still fire.
+  core_timing.RemoveEvent(cb_a);
+  core_timing.RemoveEvent(cb_c);
+  core_timing.ScheduleEvent(250, cb_c, CB_IDS[2]);
+
+  AdvanceAndCheck(system, 1, 50, 0, -100);  // cb_b at 200 (cb_a was removed)
+  AdvanceAndCheck(system, 2, MAX_SLICE_LENGTH);
+}
+
+// Checks that removing events never changes the order in which the remaining events fire.
+TEST(CoreTiming, RemoveEventOrder)
+{
+  using namespace RemoveEventTest;
+
+  auto& system = Core::System::GetInstance();
+
+  ScopeInit guard(system);
+  ASSERT_TRUE(guard.UserDirectoryExists());
+
+  auto& core_timing = system.GetCoreTiming();
+  auto& ppc_state = system.GetPPCState();
+
+  constexpr size_t TYPE_COUNT = 8;
+  std::array<CoreTiming::EventType*, TYPE_COUNT> event_types;
+  for (size_t i = 0; i < TYPE_COUNT; ++i)
+    event_types[i] = core_timing.RegisterEvent(fmt::format("callback{}", i), RecordingCallback);
+
+  // Enter slice 0
+  core_timing.Advance();
+
+  struct ExpectedEvent
+  {
+    s64 time;
+    size_t order;
+    size_t type;
+    u64 id;
+  };
+
+  u32 random_state = 12345;
+  const auto random = [&random_state](u32 max) {
+    random_state = random_state * 1103515245 + 12345;
+    return (random_state >> 16) % max;
+  };
+
+  u64 next_id = 0;
+  for (int round = 0; round < 20; ++round)
+  {
+    std::vector<ExpectedEvent> expected_events;
+    const s64 now = static_cast<s64>(core_timing.GetTicks());
+
+    for (size_t i = 0; i < 200; ++i)
+    {
+      if (random(8) == 0)
+      {
+        const size_t type = random(TYPE_COUNT);
+        core_timing.RemoveEvent(event_types[type]);
+        std::erase_if(expected_events, [type](const ExpectedEvent& e) { return e.type == type; });
+        continue;
+      }
+
+      // Small time range to get plenty of events sharing the same time.
+      const s64 cycles_into_future = random(50) * 10;
+      const size_t type = random(TYPE_COUNT);
+      core_timing.ScheduleEvent(cycles_into_future, event_types[type], next_id);
+      expected_events.push_back({now + cycles_into_future, i, type, next_id});
+      ++next_id;
+    }
+
+    std::ranges::stable_sort(expected_events, {},
+                             [](const ExpectedEvent& e) { return std::tie(e.time, e.order); });
+
+    s_fired_events.clear();
+    for (size_t i = 0; i < expected_events.size(); ++i)
+    {
+      ppc_state.downcount = 0;
+      core_timing.Advance();
+    }
+
+    ASSERT_EQ(expected_events.size(), s_fired_events.size());
+    for (size_t i = 0; i < expected_events.size(); ++i)
+      EXPECT_EQ(expected_events[i].id, s_fired_events[i]);
+  }
+}
@@ -0,0 +1,166 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/DSP/DSPAnalyzer.h"
+#include "Core/DSP/DSPCodeUtil.h"
+#include "Core/DSP/DSPCore.h"
+#include "Core/DSP/DSPTables.h"
+
+namespace
+{
+// The address of the "poll" label in the code given to AnalyzeCode.
+constexpr u16 POLL_ADDRESS = 1;
+
+// Assembles the code into IRAM and analyzes it. The code must start with a NOP followed by the
+// "poll" label, so that the loop doesn't start at the first address.
+std::unique_ptr<DSP::Analyzer> AnalyzeCode(const std::string& text)
+{
+  std::vector<u16> code;
+  EXPECT_TRUE(DSP::Assemble(text, code)) << text;
+
+  // Fill the rest of the memory with HALT opcodes, like SDSP::Initialize does for IRAM.
+  std::vector<u16> iram(DSP::DSP_IRAM_SIZE, 0x0021);
+  std::vector<u16> irom(DSP::DSP_IROM_SIZE, 0x0021);
+  std::ranges::copy(code, iram.begin());
+
+  DSP::DSPCore core;
+  DSP::SDSP& dsp = core.DSPState();
+  dsp.iram = iram.data();
+  dsp.irom = irom.data();
+
+  auto analyzer = std::make_unique<DSP::Analyzer>();
+  analyzer->Analyze(dsp);
+
+  dsp.iram = nullptr;
+  dsp.irom = nullptr;
+  return analyzer;
+}
+
+std::string MakeLoop(std::string_view load, std::string_view reg, std::string_view mailbox,
+                     std::string_view test, std::string_view jump)
+{
+  return fmt::format("\tnop\n"
+                     "poll:\n"
+                     "\t{} {}, @{}\n"
+                     "\t{} {}, #0x8000\n"
+                     "\t{} poll\n"
+                     "\thalt\n",
+                     load, reg, mailbox, test, reg, jump);
+}
+
+struct LoopVariant
+{
+  std::string_view mailbox;
+  std::string_view test;
+  std::string_view jump;
+  bool is_wait_for_mail;
+  bool is_wait_for_mail_read;
+};
+
+// ANDCF sets LZ when the full bit is set, ANDF sets it when the bit is clear. Loops on the CPU
+// mailbox wait for mail while the mailbox is empty, loops on the DSP mailbox wait for the CPU to
+// read the mail while it is full. The other combinations don't wait for the CPU.
+constexpr std::array<LoopVariant, 8> LOOP_VARIANTS{{
+    {"CMBH", "andcf", "jlnz", true, false},
+    {"CMBH", "andf", "jlz", true, false},
+    {"CMBH", "andcf", "jlz", false, false},
+    {"CMBH", "andf", "jlnz", false, false},
+    {"DMBH", "andcf", "jlz", false, true},
+    {"DMBH", "andf", "jlnz", false, true},
+    {"DMBH", "andcf", "jlnz", false, false},
+    {"DMBH", "andf", "jlz", false, false},
+}};
+}  // namespace
+
+class DSPAnalyzerTest : public testing::Test
+{
+protected:
+  // The analyzer needs the opcode table to find the starts of the instructions.
+  static void SetUpTestSuite() { DSP::InitInstructionTable(); }
+};
+
+TEST_F(DSPAnalyzerTest, MailboxWaitLoops)
+{
+  for (const LoopVariant& variant : LOOP_VARIANTS)
+  {
+    for (const std::string_view load : {"lrs", "lr"})
+    {
+      for (const std::string_view reg : {"$ac0.m", "$ac1.m"})
+      {
+        const std::string text = MakeLoop(load, reg, variant.mailbox, variant.test, variant.jump);
+        const auto analyzer = AnalyzeCode(text);
+
+        EXPECT_EQ(analyzer->IsWaitForMail(POLL_ADDRESS), variant.is_wait_for_mail) << text;
+        EXPECT_EQ(analyzer->IsWaitForMailRead(POLL_ADDRESS), variant.is_wait_for_mail_read)
+            << text;
+        EXPECT_EQ(analyzer->IsIdleSkip(POLL_ADDRESS),
+                  variant.is_wait_for_mail || variant.is_wait_for_mail_read)
+            << text;
+      }
+    }
+  }
+}
+
+TEST_F(DSPAnalyzerTest, LoopsWhichDontPollTheMailboxAreNotFlagged)
+{
+  const std::array<std::string, 6> texts{
+      // Branches back to the test instead of the mailbox read.
+      "\tnop\n"
+      "poll:\n"
+      "\tlrs $ac0.m, @CMBH\n"
+      "test:\n"
+      "\tandcf $ac0.m, #0x8000\n"
+      "\tjlnz test\n",
+      // Branches back to before the mailbox read.
+      "loop:\n"
+      "\tnop\n"
+      "poll:\n"
+      "\tlrs $ac0.m, @CMBH\n"
+      "\tandcf $ac0.m, #0x8000\n"
+      "\tjlnz loop\n",
+      // Branches forward.
+      "\tnop\n"
+      "poll:\n"
+      "\tlrs $ac0.m, @CMBH\n"
+      "\tandcf $ac0.m, #0x8000\n"
+      "\tjlnz done\n"
+      "done:\n"
+      "\thalt\n",
+      // Tests a different register than the one the mail was read into.
+      "\tnop\n"
+      "poll:\n"
+      "\tlrs $ac0.m, @CMBH\n"
+      "\tandcf $ac1.m, #0x8000\n"
+      "\tjlnz poll\n",
+      // Tests a different bit.
+      "\tnop\n"
+      "poll:\n"
+      "\tlrs $ac0.m, @CMBH\n"
+      "\tandcf $ac0.m, #0x4000\n"
+      "\tjlnz poll\n",
+      // Reads the low half of the mailbox.
+      "\tnop\n"
+      "poll:\n"
+      "\tlr $ac0.m, @CMBL\n"
+      "\tandcf $ac0.m, #0x8000\n"
+      "\tjlnz poll\n",
+  };
+
+  for (const std::string& text : texts)
+  {
+    const auto analyzer = AnalyzeCode(text);
+    EXPECT_FALSE(analyzer->IsWaitForMail(POLL_ADDRESS)) << text;
+    EXPECT_FALSE(analyzer->IsWaitForMailRead(POLL_ADDRESS)) << text;
+  }
+}
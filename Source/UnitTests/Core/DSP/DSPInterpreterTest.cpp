@@ -0,0 +1,190 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/DSP/DSPCodeUtil.h"
+#include "Core/DSP/DSPCore.h"
+#include "Core/DSP/DSPTables.h"
+#include "Core/DSP/Interpreter/DSPIntTables.h"
+#include "Core/DSP/Interpreter/DSPInterpreter.h"
+
+namespace
+{
+constexpr int MAX_STEPS = 10000;
+
+// A DSP core with its memories backed by vectors, so that it can run code without ROM dumps.
+class TestDSP
+{
+public:
+  TestDSP() : m_iram(DSP::DSP_IRAM_SIZE), m_irom(DSP::DSP_IROM_SIZE), m_dram(DSP::DSP_DRAM_SIZE)
+  {
+    DSP::SDSP& state = m_core.DSPState();
+    state.iram = m_iram.data();
+    state.irom = m_irom.data();
+    state.dram = m_dram.data();
+
+    // Fill the memories with HALT opcodes and random data.
+    std::ranges::fill(m_iram, 0x0021);
+    std::ranges::fill(m_irom, 0x0021);
+    std::mt19937 rng(0xd5b);
+    std::ranges::generate(m_dram, [&rng] { return static_cast<u16>(rng()); });
+  }
+  ~TestDSP()
+  {
+    DSP::SDSP& state = m_core.DSPState();
+    state.iram = nullptr;
+    state.irom = nullptr;
+    state.dram = nullptr;
+  }
+
+  TestDSP(const TestDSP&) = delete;
+  TestDSP& operator=(const TestDSP&) = delete;
+
+  // Loads the code at the start of IRAM and resets the registers, like loading a ucode does.
+  void LoadCode(const std::string& text)
+  {
+    std::vector<u16> code;
+    ASSERT_TRUE(DSP::Assemble(text, code)) << text;
+    std::ranges::fill(m_iram, 0x0021);
+    std::ranges::copy(code, m_iram.begin());
+    m_core.ClearIRAM();
+
+    DSP::SDSP& state = m_core.DSPState();
+    std::memset(&state.r, 0, sizeof(state.r));
+    std::ranges::fill(state.r.wr, 0xffff);
+    std::ranges::fill(state.reg_stack_ptrs, 0);
+    state.pc = 0;
+    state.control_reg = 0;
+    state.GetAnalyzer().Analyze(state);
+  }
+
+  // Steps through decoded instructions, like the interpreter always does for IRAM and IROM.
+  void Step() { m_core.GetInterpreter().Step(); }
+
+  // Fetches and decodes the instruction at the PC, like the interpreter used to for every step.
+  void StepUndecoded()
+  {
+    DSP::SDSP& state = m_core.DSPState();
+    DSP::Interpreter::Interpreter& interpreter = m_core.GetInterpreter();
+
+    m_core.CheckExceptions();
+    state.AdvanceStepCounter();
+
+    const DSP::UDSPInstruction inst = state.FetchInstruction();
+    const bool extended = DSP::GetOpTemplate(inst)->extended;
+    if (extended)
+      (interpreter.*DSP::Interpreter::GetExtOp(inst))(inst);
+    (interpreter.*DSP::Interpreter::GetOp(inst))(inst);
+    if (extended)
+      interpreter.ApplyWriteBackLog();
+  }
+
+  bool IsHalted() const { return (m_core.DSPState().control_reg & DSP::CR_HALT) != 0; }
+  u16 GetPC() const { return m_core.DSPState().pc; }
+  u16 ReadRegister(size_t reg) const { return m_core.ReadRegister(reg); }
+  const std::vector<u16>& GetDRAM() const { return m_dram; }
+
+private:
+  DSP::DSPCore m_core;
+  std::vector<u16> m_iram;
+  std::vector<u16> m_irom;
+  std::vector<u16> m_dram;
+};
+
+// Mixes data memory into the accumulators with extended opcodes, in a loop with a call.
+constexpr char MIXING_LOOP[] = "\tlri $ar0, #0x0100\n"
+                               "\tlri $ar1, #0x0200\n"
+                               "\tlri $ar2, #0x0300\n"
+                               "\tlri $ax0.l, #0x1234\n"
+                               "\tlri $ax0.h, #0x2345\n"
+                               "\tlri $ax1.h, #0x0fed\n"
+                               "\tclr $acc1\n"
+                               "\tlri $ac0.m, #0x0020\n"
+                               "loop:\n"
+                               "\taddax'l $acc1, $ax0 : $ax1.l, @$ar0\n"
+                               "\tmulx'ir $ax0.l, $ax1.h : $ar1\n"
+                               "\taddp's $acc1 : @$ar1, $ac1.m\n"
+                               "\tmulmv'sn $ax0.l, $ax0.h, $acc1 : @$ar2, $ac1.m\n"
+                               "\taddaxl'mv $acc1, $ax1.l : $ax0.h, $ac1.m\n"
+                               "\tcall store\n"
+                               "\tdecm'dr $ac0.m : $ar0\n"
+                               "\tjnz loop\n"
+                               "\thalt\n"
+                               "store:\n"
+                               "\tsrrn @$ar2, $ac1.l\n"
+                               "\tret\n";
+}  // namespace
+
+class DSPInterpreterTest : public testing::Test
+{
+protected:
+  // The decoder needs the opcode table to find the templates of the instructions.
+  static void SetUpTestSuite() { DSP::InitInstructionTable(); }
+};
+
+TEST_F(DSPInterpreterTest, DecodedExecutionMatchesUndecoded)
+{
+  auto decoded = std::make_unique<TestDSP>();
+  auto undecoded = std::make_unique<TestDSP>();
+  decoded->LoadCode(MIXING_LOOP);
+  undecoded->LoadCode(MIXING_LOOP);
+
+  int steps = 0;
+  for (; steps < MAX_STEPS && !undecoded->IsHalted(); ++steps)
+  {
+    decoded->Step();
+    undecoded->StepUndecoded();
+
+    ASSERT_EQ(decoded->GetPC(), undecoded->GetPC()) << "step " << steps;
+    for (size_t reg = 0; reg < 32; ++reg)
+    {
+      ASSERT_EQ(decoded->ReadRegister(reg), undecoded->ReadRegister(reg))
+          << "step " << steps << ", register " << reg;
+    }
+  }
+
+  EXPECT_TRUE(undecoded->IsHalted());
+  EXPECT_TRUE(decoded->IsHalted());
+  EXPECT_GT(steps, 200);
+  EXPECT_EQ(decoded->GetDRAM(), undecoded->GetDRAM());
+}
+
+TEST_F(DSPInterpreterTest, LoadingCodeClearsDecodedInstructions)
+{
+  TestDSP dsp;
+  const auto run = [&dsp] {
+    for (int steps = 0; steps < MAX_STEPS && !dsp.IsHalted(); ++steps)
+      dsp.Step();
+    EXPECT_TRUE(dsp.IsHalted());
+  };
+
+  // The second program replaces instructions that were decoded for the first one, so running any
+  // of those would give different results.
+  dsp.LoadCode("\tlri $ac0.m, #0x1111\n"
+               "\tlri $ac1.m, #0x2222\n"
+               "\tjmp done\n"
+               "\tlri $ac1.m, #0x3333\n"
+               "done:\n"
+               "\thalt\n");
+  run();
+  EXPECT_EQ(dsp.ReadRegister(DSP::DSP_REG_ACM0), 0x1111);
+  EXPECT_EQ(dsp.ReadRegister(DSP::DSP_REG_ACM1), 0x2222);
+
+  dsp.LoadCode("\tlri $ac0.m, #0x4444\n"
+               "\tnop\n"
+               "\tnop\n"
+               "\tlri $ac1.m, #0x5555\n"
+               "\thalt\n");
+  run();
+  EXPECT_EQ(dsp.ReadRegister(DSP::DSP_REG_ACM0), 0x4444);
+  EXPECT_EQ(dsp.ReadRegister(DSP::DSP_REG_ACM1), 0x5555);
+}
@@ -0,0 +1,188 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/PowerPC/JitCommon/JitCache.h"
+#include "Core/PowerPC/PPCAnalyst.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+
+#include "../StubJit.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+class LinkCountingBlockCache final : public JitBaseBlockCache
+{
+public:
+  explicit LinkCountingBlockCache(JitBase& jit) : JitBaseBlockCache(jit) {}
+
+  void WriteLinkBlock(const JitBlock::LinkData&, const JitBlock* dest) override
+  {
+    if (dest)
+      ++link_count;
+  }
+
+  size_t link_count = 0;
+};
+
+class JitCacheTest : public ::testing::Test
+{
+protected:
+  JitCacheTest() : m_system(Core::System::GetInstance()), m_jit(m_system), m_cache(m_jit)
+  {
+    m_system.GetPPCState().msr.IR = 0;
+    m_cache.Init();
+  }
+
+  ~JitCacheTest() override { m_cache.Shutdown(); }
+
+  // Creates a block without any code, which is all the block cache needs.
+  JitBlock* CompileBlock(u32 address, u32 num_instructions, const std::vector<u32>& exits = {})
+  {
+    JitBlock* block = m_cache.AllocateBlock(address);
+    // The block cache only compares entry points, so any unique pointer will do.
+    m_fake_code.push_back(std::make_unique<u8>());
+    block->normalEntry = block->near_begin = block->near_end = m_fake_code.back().get();
+    block->far_begin = block->far_end = nullptr;
+
+    for (const u32 exit_address : exits)
+    {
+      JitBlock::LinkData link_data{};
+      link_data.exitAddress = exit_address;
+      block->linkData.push_back(link_data);
+    }
+
+    PPCAnalyst::CodeBlock code_block;
+    code_block.m_num_instructions = num_instructions;
+    for (u32 i = 0; i < num_instructions; ++i)
+      code_block.m_physical_addresses.insert(address + i * 4);
+
+    m_cache.FinalizeBlock(*block, true, code_block, {});
+    return block;
+  }
+
+  JitBlock* GetBlock(u32 address)
+  {
+    return m_cache.GetBlockFromStartAddress(address, m_system.GetPPCState().feature_flags);
+  }
+
+  Core::System& m_system;
+  StubJit m_jit;
+  LinkCountingBlockCache m_cache;
+  std::vector<std::unique_ptr<u8>> m_fake_code;
+};
+}  // namespace
+
+TEST_F(JitCacheTest, InvalidationDestroysOverlappingBlocks)
+{
+  CompileBlock(0x1000, 8);
+  // Spans several 0x100 byte macro blocks.
+  CompileBlock(0x10F0, 0x100);
+  CompileBlock(0x2000, 8);
+  EXPECT_EQ(3u, m_cache.GetBlockCount());
+
+  // Only touches the last cache line of the second block.
+  m_cache.InvalidateICache(0x14E0, 0x20, false);
+  EXPECT_NE(nullptr, GetBlock(0x1000));
+  EXPECT_EQ(nullptr, GetBlock(0x10F0));
+  EXPECT_NE(nullptr, GetBlock(0x2000));
+
+  // The destroyed block must not be found through any of the other macro blocks either.
+  m_cache.InvalidateICache(0x1000, 0x1000, false);
+  EXPECT_EQ(nullptr, GetBlock(0x1000));
+  EXPECT_NE(nullptr, GetBlock(0x2000));
+  EXPECT_EQ(1u, m_cache.GetBlockCount());
+
+  m_cache.InvalidateICache(0, 0xFFFFFFFF, true);
+  EXPECT_EQ(0u, m_cache.GetBlockCount());
+}
+
+TEST_F(JitCacheTest, LinksFollowDestinations)
+{
+  JitBlock* source = CompileBlock(0x1000, 4, {0x3000, 0x3000, 0x4000});
+  JitBlock* other_source = CompileBlock(0x2000, 4, {0x3000});
+  EXPECT_EQ(0u, m_cache.link_count);
+
+  CompileBlock(0x3000, 4);
+  EXPECT_TRUE(source->linkData[0].linkStatus);
+  EXPECT_TRUE(source->linkData[1].linkStatus);
+  EXPECT_FALSE(source->linkData[2].linkStatus);
+  EXPECT_TRUE(other_source->linkData[0].linkStatus);
+  EXPECT_EQ(3u, m_cache.link_count);
+
+  m_cache.InvalidateICache(0x3000, 0x20, false);
+  EXPECT_FALSE(source->linkData[0].linkStatus);
+  EXPECT_FALSE(source->linkData[1].linkStatus);
+  EXPECT_FALSE(other_source->linkData[0].linkStatus);
+
+  // Destroying a source must remove its links, so recompiling the destination only links the
+  // remaining one.
+  m_cache.InvalidateICache(0x1000, 0x20, false);
+  const size_t link_count = m_cache.link_count;
+  CompileBlock(0x3000, 4);
+  EXPECT_EQ(link_count + 1, m_cache.link_count);
+  EXPECT_TRUE(other_source->linkData[0].linkStatus);
+}
+
+TEST_F(JitCacheTest, InvalidationThroughput)
+{
+  // Roughly resembles a game which keeps loading code into the same region of memory: a few
+  // thousand small blocks which link to each other, of which random cache lines get invalidated
+  // and recompiled.
+  constexpr u32 CODE_BASE = 0x00100000;
+  constexpr u32 BLOCK_COUNT = 0x2000;
+  constexpr u32 BLOCK_INSTRUCTIONS = 16;
+  constexpr u32 BLOCK_STRIDE = BLOCK_INSTRUCTIONS * 4;
+  constexpr u32 ITERATIONS = 200000;
+
+  u32 random = 1;
+  const auto next_random = [&random] {
+    random = random * 1103515245 + 12345;
+    return random >> 8;
+  };
+  const auto compile_block = [&](u32 index) {
+    const u32 address = CODE_BASE + index * BLOCK_STRIDE;
+    const u32 next_index = (index + 1) % BLOCK_COUNT;
+    const u32 random_index = next_random() % BLOCK_COUNT;
+    CompileBlock(address, BLOCK_INSTRUCTIONS,
+                 {CODE_BASE + next_index * BLOCK_STRIDE, CODE_BASE + random_index * BLOCK_STRIDE});
+  };
+
+  const auto start = std::chrono::steady_clock::now();
+
+  for (u32 i = 0; i < BLOCK_COUNT; ++i)
+    compile_block(i);
+
+  const auto compiled = std::chrono::steady_clock::now();
+
+  for (u32 i = 0; i < ITERATIONS; ++i)
+  {
+    const u32 index = next_random() % BLOCK_COUNT;
+    const u32 address = CODE_BASE + index * BLOCK_STRIDE;
+    // Every block covers two whole cache lines.
+    m_cache.InvalidateICacheLine(address + (next_random() % 2) * 32);
+    if (!GetBlock(address))
+      compile_block(index);
+  }
+
+  const auto end = std::chrono::steady_clock::now();
+
+  EXPECT_EQ(BLOCK_COUNT, m_cache.GetBlockCount());
+
+  const auto microseconds = [](auto diff) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(diff).count();
+  };
+
+  fmt::print("block cache timing:\n");
+  fmt::print("compile {} blocks              {} us\n", BLOCK_COUNT,
+             microseconds(compiled - start));
+  fmt::print("{} invalidations + recompiles  {} us\n", ITERATIONS, microseconds(end - compiled));
+}
@@ -881,3 +881,70 @@ TEST_F(PageTableHostMappingTest, MemChecks)
   ExpectMapped(0x10320000, 0x00330000);
   ExpectMapped(0x10330000, 0x00320000);
 }
+
+TEST_F(PageTableHostMappingTest, FastTLB)
+{
+  auto& system = Core::System::GetInstance();
+  auto& mmu = system.GetMMU();
+  const auto& fast_tlb = system.GetPPCState().fast_tlb;
+
+  // Both pages use the same TLB set
+  constexpr u32 first_page = 0x10340000;
+  constexpr u32 second_page = 0x10380000;
+  constexpr u32 first_tag = first_page >> PowerPC::HW_PAGE_INDEX_SHIFT;
+  constexpr u32 second_tag = second_page >> PowerPC::HW_PAGE_INDEX_SHIFT;
+  const PowerPC::FastTLBEntry& entry = fast_tlb[first_tag & PowerPC::HW_PAGE_INDEX_MASK];
+
+  {
+    DisableDR disable_dr;
+    auto [pte1, pte2] = CreateMapping(first_page, 0x00340000);
+    pte2.C = 0;
+    SetPTE(pte1, pte2, first_page, 0);
+    AddMapping(second_page, 0x00350000, 0);
+  }
+
+  // Writes can only use the entry once the changed bit is set
+  mmu.Read<u32>(first_page);
+  EXPECT_EQ(entry.read_tag, first_tag);
+  EXPECT_EQ(entry.write_tag, PowerPC::FastTLBEntry::INVALID_TAG);
+  mmu.Write<u32>(0x12345678, first_page);
+  EXPECT_EQ(entry.read_tag, first_tag);
+  EXPECT_EQ(entry.write_tag, first_tag);
+  EXPECT_EQ(reinterpret_cast<u8*>(entry.host_offset + first_page),
+            system.GetMemory().GetRAM() + 0x00340000);
+
+  // The entry follows the most recently used way of the TLB set
+  mmu.Read<u32>(second_page);
+  EXPECT_EQ(entry.read_tag, second_tag);
+  EXPECT_EQ(reinterpret_cast<u8*>(entry.host_offset + second_page),
+            system.GetMemory().GetRAM() + 0x00350000);
+  mmu.Read<u32>(first_page);
+  EXPECT_EQ(entry.read_tag, first_tag);
+
+  // tlbie
+  mmu.InvalidateTLBEntry(first_page);
+  EXPECT_EQ(entry.read_tag, PowerPC::FastTLBEntry::INVALID_TAG);
+
+  // Changing SRs, BATs or memchecks invalidates everything
+  mmu.Read<u32>(first_page);
+  EXPECT_EQ(entry.read_tag, first_tag);
+  SetSR(1, 123);
+  EXPECT_EQ(entry.read_tag, PowerPC::FastTLBEntry::INVALID_TAG);
+
+  mmu.Read<u32>(first_page);
+  EXPECT_EQ(entry.read_tag, first_tag);
+  mmu.DBATUpdated();
+  EXPECT_EQ(entry.read_tag, PowerPC::FastTLBEntry::INVALID_TAG);
+
+  auto& memchecks = system.GetPowerPC().GetMemChecks();
+  TMemCheck memcheck;
+  memcheck.start_address = first_page + 0x100;
+  memcheck.end_address = first_page + 0x101;
+  memchecks.Add(std::move(memcheck));
+  mmu.Read<u32>(first_page);
+  EXPECT_EQ(entry.read_tag, PowerPC::FastTLBEntry::INVALID_TAG);
+  memchecks.Remove(first_page + 0x100);
+
+  RemoveMapping(first_page, 0x00340000, 0);
+  RemoveMapping(second_page, 0x00350000, 0);
+}
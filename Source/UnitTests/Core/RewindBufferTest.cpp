@@ -0,0 +1,159 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <span>
+#include <vector>
+
+#include "Common/Buffer.h"
+#include "Common/CommonTypes.h"
+#include "Core/RewindBuffer.h"
+
+namespace
+{
+constexpr size_t STATE_SIZE = 64 * State::RewindBuffer::PAGE_SIZE + 123;
+
+std::vector<u8> MakeState(u8 seed)
+{
+  std::vector<u8> state(STATE_SIZE);
+  for (size_t i = 0; i < state.size(); ++i)
+    state[i] = static_cast<u8>(i * 7 + seed);
+  return state;
+}
+
+void ExpectPopEquals(State::RewindBuffer& buffer, const std::vector<u8>& expected)
+{
+  Common::UniqueBuffer<u8> state;
+  ASSERT_TRUE(buffer.Pop(state));
+  ASSERT_EQ(expected.size(), state.size());
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), state.data()));
+}
+}  // namespace
+
+TEST(RewindBuffer, PopRestoresStatesInReverseOrder)
+{
+  State::RewindBuffer buffer;
+
+  std::vector<std::vector<u8>> states;
+  std::vector<u8> state = MakeState(1);
+  for (u32 i = 0; i < 8; ++i)
+  {
+    // Touch a couple of pages, including the partial final page.
+    state[i * State::RewindBuffer::PAGE_SIZE] ^= 0xFF;
+    state.back() = static_cast<u8>(i);
+    states.push_back(state);
+    buffer.Push(state);
+  }
+
+  EXPECT_EQ(states.size(), buffer.GetEntryCount());
+  for (auto it = states.rbegin(); it != states.rend(); ++it)
+    ExpectPopEquals(buffer, *it);
+
+  Common::UniqueBuffer<u8> empty;
+  EXPECT_FALSE(buffer.Pop(empty));
+  EXPECT_EQ(0u, buffer.GetMemoryUsage());
+}
+
+TEST(RewindBuffer, DeltasOnlyStoreChangedPages)
+{
+  State::RewindBuffer buffer;
+
+  std::vector<u8> state = MakeState(2);
+  buffer.Push(state);
+  const size_t keyframe_usage = buffer.GetMemoryUsage();
+
+  state[5 * State::RewindBuffer::PAGE_SIZE + 17] ^= 0x55;
+  buffer.Push(state);
+
+  const size_t delta_usage = buffer.GetMemoryUsage() - keyframe_usage;
+  EXPECT_LE(delta_usage, State::RewindBuffer::PAGE_SIZE + sizeof(u32));
+}
+
+TEST(RewindBuffer, StateSizeChanges)
+{
+  State::RewindBuffer buffer;
+
+  std::vector<u8> state = MakeState(3);
+  buffer.Push(state);
+
+  std::vector<u8> larger = state;
+  larger.resize(larger.size() + 3 * State::RewindBuffer::PAGE_SIZE, 0xAB);
+  buffer.Push(larger);
+
+  std::vector<u8> smaller = state;
+  smaller.resize(smaller.size() / 2);
+  buffer.Push(smaller);
+
+  ExpectPopEquals(buffer, smaller);
+  ExpectPopEquals(buffer, larger);
+  ExpectPopEquals(buffer, state);
+}
+
+TEST(RewindBuffer, MemoryBudgetDropsOldestKeyframes)
+{
+  // Room for a little more than two full states.
+  State::RewindBuffer buffer(STATE_SIZE * 5 / 2);
+
+  for (u8 i = 0; i < 10; ++i)
+  {
+    // Every state is completely different, so every state becomes a keyframe.
+    buffer.Push(MakeState(i));
+    EXPECT_LE(buffer.GetMemoryUsage(), buffer.GetMemoryBudget());
+  }
+
+  EXPECT_EQ(2u, buffer.GetEntryCount());
+  ExpectPopEquals(buffer, MakeState(9));
+  ExpectPopEquals(buffer, MakeState(8));
+  EXPECT_TRUE(buffer.IsEmpty());
+}
+
+TEST(RewindBuffer, EncodedDeltaRoundTrips)
+{
+  const std::vector<u8> base = MakeState(4);
+
+  std::vector<u8> state = base;
+  state[3 * State::RewindBuffer::PAGE_SIZE] ^= 0x01;
+  state.back() ^= 0x02;
+  state.resize(state.size() + State::RewindBuffer::PAGE_SIZE + 5, 0xCD);
+
+  const std::vector<u8> delta = State::RewindBuffer::EncodeDelta(base, state);
+  EXPECT_LT(delta.size(), 4 * State::RewindBuffer::PAGE_SIZE);
+
+  Common::UniqueBuffer<u8> result;
+  ASSERT_TRUE(State::RewindBuffer::ApplyDelta(base, delta, result));
+  ASSERT_EQ(state.size(), result.size());
+  EXPECT_TRUE(std::equal(state.begin(), state.end(), result.data()));
+
+  // Shrinking the state only needs the new size.
+  const std::vector<u8> smaller(base.begin(), base.begin() + base.size() / 3);
+  const std::vector<u8> shrink_delta = State::RewindBuffer::EncodeDelta(base, smaller);
+  ASSERT_TRUE(State::RewindBuffer::ApplyDelta(base, shrink_delta, result));
+  ASSERT_EQ(smaller.size(), result.size());
+  EXPECT_TRUE(std::equal(smaller.begin(), smaller.end(), result.data()));
+}
+
+TEST(RewindBuffer, MalformedDeltasAreRejected)
+{
+  const std::vector<u8> base = MakeState(5);
+  std::vector<u8> state = base;
+  state[7 * State::RewindBuffer::PAGE_SIZE + 1] ^= 0xFF;
+  const std::vector<u8> delta = State::RewindBuffer::EncodeDelta(base, state);
+
+  Common::UniqueBuffer<u8> result;
+  for (size_t size = 0; size < delta.size(); size += 97)
+  {
+    const std::span<const u8> truncated(delta.data(), size);
+    EXPECT_FALSE(State::RewindBuffer::ApplyDelta(base, truncated, result));
+  }
+
+  std::vector<u8> trailing = delta;
+  trailing.push_back(0);
+  EXPECT_FALSE(State::RewindBuffer::ApplyDelta(base, trailing, result));
+
+  // A page index beyond the end of the state.
+  std::vector<u8> bad_page = delta;
+  bad_page[sizeof(u64) + sizeof(u32)] = 0xFF;
+  EXPECT_FALSE(State::RewindBuffer::ApplyDelta(base, bad_page, result));
+}
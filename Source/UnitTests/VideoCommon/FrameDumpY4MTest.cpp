@@ -0,0 +1,51 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/FrameDumpY4M.h"
+
+TEST(FrameDumpY4M, ConvertFrame)
+{
+  struct Color
+  {
+    std::array<u8, 3> rgb;
+    std::array<u8, 3> ycbcr;
+  };
+  static constexpr std::array<Color, 6> colors{{
+      {{0, 0, 0}, {0, 128, 128}},
+      {{255, 255, 255}, {255, 128, 128}},
+      {{255, 0, 0}, {76, 85, 255}},
+      {{0, 255, 0}, {150, 44, 21}},
+      {{0, 0, 255}, {29, 255, 107}},
+      {{128, 128, 128}, {128, 128, 128}},
+  }};
+
+  // Three pixels per row, with some padding after each row.
+  constexpr int WIDTH = 3;
+  constexpr int HEIGHT = 2;
+  constexpr int STRIDE = 16;
+  std::vector<u8> rgba(STRIDE * HEIGHT, 0xcc);
+  for (std::size_t i = 0; i < colors.size(); ++i)
+  {
+    u8* const pixel = &rgba[(i / WIDTH) * STRIDE + (i % WIDTH) * 4];
+    pixel[0] = colors[i].rgb[0];
+    pixel[1] = colors[i].rgb[1];
+    pixel[2] = colors[i].rgb[2];
+  }
+
+  std::vector<u8> planes;
+  Y4MFrameDump::ConvertFrame({rgba.data(), WIDTH, HEIGHT, STRIDE, {}}, &planes);
+  ASSERT_EQ(planes.size(), colors.size() * 3);
+
+  for (std::size_t i = 0; i < colors.size(); ++i)
+  {
+    EXPECT_EQ(planes[i], colors[i].ycbcr[0]) << "Y of color " << i;
+    EXPECT_EQ(planes[colors.size() + i], colors[i].ycbcr[1]) << "Cb of color " << i;
+    EXPECT_EQ(planes[colors.size() * 2 + i], colors[i].ycbcr[2]) << "Cr of color " << i;
+  }
+}
@@ -0,0 +1,186 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/IndexGenerator.h"
+#include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/VideoConfig.h"
+
+using OpcodeDecoder::Primitive;
+
+namespace
+{
+using Triangle = std::array<u16, 3>;
+
+// Rotates the triangle to start with its smallest index, which keeps its winding.
+Triangle Normalize(const Triangle& triangle)
+{
+  Triangle normalized = triangle;
+  std::ranges::rotate(normalized, std::ranges::min_element(normalized));
+  return normalized;
+}
+
+// Decodes triangle strips separated by primitive restarts, or a triangle list.
+std::vector<Triangle> DecodeTriangles(const std::vector<u16>& indices, bool primitive_restart)
+{
+  std::vector<Triangle> triangles;
+  if (!primitive_restart)
+  {
+    for (size_t i = 0; i + 2 < indices.size(); i += 3)
+      triangles.push_back(Normalize({indices[i], indices[i + 1], indices[i + 2]}));
+    return triangles;
+  }
+
+  size_t strip_start = 0;
+  for (size_t i = 0; i <= indices.size(); i++)
+  {
+    if (i != indices.size() && indices[i] != UINT16_MAX)
+      continue;
+
+    for (size_t k = strip_start; k + 2 < i; k++)
+    {
+      const size_t n = k - strip_start;
+      if (n % 2 == 0)
+        triangles.push_back(Normalize({indices[k], indices[k + 1], indices[k + 2]}));
+      else
+        triangles.push_back(Normalize({indices[k + 1], indices[k], indices[k + 2]}));
+    }
+    strip_start = i + 1;
+  }
+  return triangles;
+}
+
+// The triangles GX draws for the primitive, with the winding it draws them in.
+std::vector<Triangle> ExpectedTriangles(Primitive primitive, u32 num_verts, u32 base)
+{
+  std::vector<Triangle> triangles;
+  const auto add = [&](u32 a, u32 b, u32 c) {
+    triangles.push_back(Normalize(
+        {static_cast<u16>(base + a), static_cast<u16>(base + b), static_cast<u16>(base + c)}));
+  };
+
+  switch (primitive)
+  {
+  case Primitive::GX_DRAW_QUADS:
+  case Primitive::GX_DRAW_QUADS_2:
+    for (u32 i = 0; i + 4 <= num_verts; i += 4)
+    {
+      add(i, i + 1, i + 2);
+      add(i, i + 2, i + 3);
+    }
+    if (num_verts % 4 == 3)
+      add(num_verts - 3, num_verts - 2, num_verts - 1);
+    break;
+  case Primitive::GX_DRAW_TRIANGLES:
+    for (u32 i = 0; i + 3 <= num_verts; i += 3)
+      add(i, i + 1, i + 2);
+    break;
+  case Primitive::GX_DRAW_TRIANGLE_STRIP:
+    for (u32 i = 0; i + 3 <= num_verts; i++)
+    {
+      if (i % 2 == 0)
+        add(i, i + 1, i + 2);
+      else
+        add(i + 1, i, i + 2);
+    }
+    break;
+  case Primitive::GX_DRAW_TRIANGLE_FAN:
+    for (u32 i = 2; i < num_verts; i++)
+      add(0, i - 1, i);
+    break;
+  default:
+    break;
+  }
+  return triangles;
+}
+
+constexpr std::array<u32, 12> VERTEX_COUNTS{0, 1, 2, 3, 4, 7, 8, 13, 26, 27, 64, 1000};
+}  // namespace
+
+class IndexGeneratorTest : public testing::TestWithParam<bool>
+{
+protected:
+  void SetUp() override
+  {
+    m_backend_info = g_backend_info;
+    g_backend_info.bSupportsPrimitiveRestart = GetParam();
+    g_backend_info.bSupportsVSLinePointExpand = false;
+    m_generator.Init();
+    m_generator.Start(m_buffer.data());
+  }
+
+  void TearDown() override { g_backend_info = m_backend_info; }
+
+  std::vector<u16> GetIndices() const
+  {
+    return {m_buffer.begin(), m_buffer.begin() + m_generator.GetIndexLen()};
+  }
+
+  BackendInfo m_backend_info;
+  IndexGenerator m_generator;
+  std::array<u16, 65536> m_buffer{};
+};
+
+TEST_P(IndexGeneratorTest, Triangles)
+{
+  for (const Primitive primitive :
+       {Primitive::GX_DRAW_QUADS, Primitive::GX_DRAW_QUADS_2, Primitive::GX_DRAW_TRIANGLES,
+        Primitive::GX_DRAW_TRIANGLE_STRIP, Primitive::GX_DRAW_TRIANGLE_FAN})
+  {
+    for (const u32 num_verts : VERTEX_COUNTS)
+    {
+      // Two primitives, so that the second one doesn't start at vertex 0.
+      m_generator.Start(m_buffer.data());
+      m_generator.AddIndices(primitive, 5);
+      m_generator.AddIndices(primitive, num_verts);
+
+      std::vector<Triangle> expected = ExpectedTriangles(primitive, 5, 0);
+      std::ranges::copy(ExpectedTriangles(primitive, num_verts, 5), std::back_inserter(expected));
+
+      EXPECT_EQ(DecodeTriangles(GetIndices(), GetParam()), expected)
+          << fmt::format("{} with {} vertices", primitive, num_verts);
+      EXPECT_EQ(m_generator.GetNumVerts(), num_verts + 5);
+    }
+  }
+}
+
+TEST_P(IndexGeneratorTest, LinesAndPoints)
+{
+  for (const u32 num_verts : VERTEX_COUNTS)
+  {
+    m_generator.Start(m_buffer.data());
+    m_generator.AddIndices(Primitive::GX_DRAW_POINTS, 3);
+    m_generator.AddIndices(Primitive::GX_DRAW_LINES, num_verts);
+    m_generator.AddIndices(Primitive::GX_DRAW_LINE_STRIP, num_verts);
+    m_generator.AddIndices(Primitive::GX_DRAW_POINTS, num_verts);
+
+    std::vector<u16> expected{0, 1, 2};
+    u32 base = 3;
+    for (u32 i = 1; i < num_verts; i += 2)
+    {
+      expected.push_back(base + i - 1);
+      expected.push_back(base + i);
+    }
+    base += num_verts;
+    for (u32 i = 1; i < num_verts; i++)
+    {
+      expected.push_back(base + i - 1);
+      expected.push_back(base + i);
+    }
+    base += num_verts;
+    for (u32 i = 0; i < num_verts; i++)
+      expected.push_back(base + i);
+
+    EXPECT_EQ(GetIndices(), expected) << fmt::format("{} vertices", num_verts);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(PrimitiveRestart, IndexGeneratorTest, testing::Bool());
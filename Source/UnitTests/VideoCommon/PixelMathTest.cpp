@@ -0,0 +1,251 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <random>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "VideoBackends/Software/PixelMath.h"
+
+namespace
+{
+enum class PixelMathLevel
+{
+  Scalar,
+  SSE41,
+  AVX2,
+};
+
+// Forces the implementations of the given level, and restores the detected CPU features and the
+// implementations picked for them afterwards.
+class ScopedPixelMathLevel
+{
+public:
+  explicit ScopedPixelMathLevel(PixelMathLevel level)
+      : m_sse41(cpu_info.bSSE4_1), m_avx2(cpu_info.bAVX2)
+  {
+    cpu_info.bSSE4_1 = m_sse41 && level >= PixelMathLevel::SSE41;
+    cpu_info.bAVX2 = m_avx2 && level >= PixelMathLevel::AVX2;
+    PixelMath::Init();
+  }
+  ~ScopedPixelMathLevel()
+  {
+    cpu_info.bSSE4_1 = m_sse41;
+    cpu_info.bAVX2 = m_avx2;
+    PixelMath::Init();
+  }
+
+  ScopedPixelMathLevel(const ScopedPixelMathLevel&) = delete;
+  ScopedPixelMathLevel& operator=(const ScopedPixelMathLevel&) = delete;
+
+private:
+  bool m_sse41;
+  bool m_avx2;
+};
+
+bool IsLevelSupported(PixelMathLevel level)
+{
+  switch (level)
+  {
+  case PixelMathLevel::SSE41:
+    return cpu_info.bSSE4_1;
+  case PixelMathLevel::AVX2:
+    return cpu_info.bAVX2;
+  default:
+    return true;
+  }
+}
+
+constexpr std::array<s32, 3> BIAS{0, 128, -128};
+constexpr std::array<s32, 4> LEFT_SHIFT{0, 1, 2, 0};
+constexpr std::array<s32, 4> RIGHT_SHIFT{0, 0, 0, 1};
+
+struct StageSettings
+{
+  u32 bias;
+  u32 scale;
+  bool subtract;
+};
+
+// One channel of a TEV stage's combiner, computed like the hardware does. Only the low 8 bits of
+// a, b and c and the low 11 bits of d are used.
+s32 ReferenceCombine(s32 a, s32 b, s32 c, s32 d, const StageSettings& settings, bool is_alpha)
+{
+  a &= 0xFF;
+  b &= 0xFF;
+  c &= 0xFF;
+  d = s32(u32(d) << 21) >> 21;
+
+  const s32 c_extended = c + (c >> 7);
+  s32 temp = a * (256 - c_extended) + b * c_extended;
+  temp <<= LEFT_SHIFT[settings.scale];
+  temp += settings.scale == 3 ? 0 : settings.subtract ? 127 : 128;
+  if (is_alpha)
+    temp = settings.subtract ? (-temp >> 8) : (temp >> 8);
+  else
+    temp = settings.subtract ? -(temp >> 8) : (temp >> 8);
+
+  const s32 result = ((d + BIAS[settings.bias]) << LEFT_SHIFT[settings.scale]) + temp;
+  return result >> RIGHT_SHIFT[settings.scale];
+}
+
+s32 RandomInput(std::mt19937* rng)
+{
+  static constexpr std::array<s32, 10> edges{0, 1, 127, 128, 255, 256, -1, 1023, -1024, 2047};
+  if ((*rng)() % 4 == 0)
+    return edges[(*rng)() % edges.size()];
+  return static_cast<s32>((*rng)() % 4096) - 2048;
+}
+
+u8 RandomTexel(std::mt19937* rng)
+{
+  static constexpr std::array<u8, 4> edges{0, 1, 0x80, 0xFF};
+  if ((*rng)() % 4 == 0)
+    return edges[(*rng)() % edges.size()];
+  return static_cast<u8>((*rng)());
+}
+
+// Fractions of 0 and the maximum are the most likely to expose rounding differences.
+s32 RandomFraction(std::mt19937* rng, s32 max)
+{
+  switch ((*rng)() % 4)
+  {
+  case 0:
+    return 0;
+  case 1:
+    return max;
+  default:
+    return static_cast<s32>((*rng)() % (max + 1));
+  }
+}
+}  // namespace
+
+class PixelMathTest : public testing::TestWithParam<PixelMathLevel>
+{
+};
+
+TEST_P(PixelMathTest, CombineMatchesReference)
+{
+  if (!IsLevelSupported(GetParam()))
+    GTEST_SKIP() << "Not supported by this CPU";
+
+  std::mt19937 rng(0x7e7);
+  const ScopedPixelMathLevel level(GetParam());
+
+  for (int iteration = 0; iteration < 200000; ++iteration)
+  {
+    // The alpha channel comes from the alpha combiner, the others from the color combiner.
+    const StageSettings alpha{u32(rng() % 3), u32(rng() % 4), rng() % 2 != 0};
+    const StageSettings color{u32(rng() % 3), u32(rng() % 4), rng() % 2 != 0};
+
+    PixelMath::CombinerInputs inputs;
+    PixelMath::CombinerParams params;
+    PixelMath::Channels expected;
+    for (size_t i = 0; i < 4; ++i)
+    {
+      const bool is_alpha = i == 0;
+      const StageSettings& settings = is_alpha ? alpha : color;
+
+      inputs.a[i] = RandomInput(&rng);
+      inputs.b[i] = RandomInput(&rng);
+      inputs.c[i] = RandomInput(&rng);
+      inputs.d[i] = RandomInput(&rng);
+
+      params.bias[i] = BIAS[settings.bias];
+      params.scale[i] = 1 << LEFT_SHIFT[settings.scale];
+      params.rounding[i] = settings.scale == 3 ? 0 : settings.subtract ? 127 : 128;
+      params.negate_before_shift[i] = is_alpha && settings.subtract ? -1 : 0;
+      params.negate_after_shift[i] = !is_alpha && settings.subtract ? -1 : 0;
+      params.divide_by_2[i] = RIGHT_SHIFT[settings.scale] != 0 ? -1 : 0;
+
+      expected[i] = ReferenceCombine(inputs.a[i], inputs.b[i], inputs.c[i], inputs.d[i], settings,
+                                     is_alpha);
+    }
+
+    PixelMath::Channels result;
+    PixelMath::Combine(inputs, params, &result);
+
+    // Only the low 16 bits of the result are meaningful, the caller clamps them to 11 bits.
+    for (size_t i = 0; i < 4; ++i)
+    {
+      EXPECT_EQ(s16(result[i]), s16(expected[i]))
+          << fmt::format("channel {}: a {} b {} c {} d {}", i, inputs.a[i], inputs.b[i],
+                         inputs.c[i], inputs.d[i]);
+    }
+  }
+}
+
+TEST_P(PixelMathTest, FilterBilinearMatchesReference)
+{
+  if (!IsLevelSupported(GetParam()))
+    GTEST_SKIP() << "Not supported by this CPU";
+
+  std::mt19937 rng(0x7e8);
+  const ScopedPixelMathLevel level(GetParam());
+
+  for (int iteration = 0; iteration < 200000; ++iteration)
+  {
+    u8 texels[4][4];
+    for (auto& texel : texels)
+    {
+      for (u8& channel : texel)
+        channel = RandomTexel(&rng);
+    }
+    const s32 fract_s = RandomFraction(&rng, 127);
+    const s32 fract_t = RandomFraction(&rng, 127);
+
+    const std::array<u32, 4> weights{u32((128 - fract_s) * (128 - fract_t)),
+                                     u32(fract_s * (128 - fract_t)), u32((128 - fract_s) * fract_t),
+                                     u32(fract_s * fract_t)};
+
+    std::array<u8, 4> expected;
+    for (size_t i = 0; i < 4; ++i)
+    {
+      u32 sum = 0;
+      for (size_t texel = 0; texel < 4; ++texel)
+        sum += texels[texel][i] * weights[texel];
+      expected[i] = static_cast<u8>(sum >> 14);
+    }
+
+    std::array<u8, 4> sample;
+    PixelMath::FilterBilinear(texels, fract_s, fract_t, sample.data());
+    EXPECT_EQ(sample, expected) << fmt::format("fractions {} {}", fract_s, fract_t);
+  }
+}
+
+TEST_P(PixelMathTest, BlendMipsMatchesReference)
+{
+  if (!IsLevelSupported(GetParam()))
+    GTEST_SKIP() << "Not supported by this CPU";
+
+  std::mt19937 rng(0x7e9);
+  const ScopedPixelMathLevel level(GetParam());
+
+  for (int iteration = 0; iteration < 200000; ++iteration)
+  {
+    std::array<u8, 4> sample0;
+    std::array<u8, 4> sample1;
+    for (size_t i = 0; i < 4; ++i)
+    {
+      sample0[i] = RandomTexel(&rng);
+      sample1[i] = RandomTexel(&rng);
+    }
+    const s32 fract = RandomFraction(&rng, 15);
+
+    std::array<u8, 4> expected;
+    for (size_t i = 0; i < 4; ++i)
+      expected[i] = static_cast<u8>((sample0[i] * (16 - fract) + sample1[i] * fract) >> 4);
+
+    std::array<u8, 4> sample;
+    PixelMath::BlendMips(sample0.data(), sample1.data(), fract, sample.data());
+    EXPECT_EQ(sample, expected) << fmt::format("fraction {}", fract);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(Levels, PixelMathTest,
+                         testing::Values(PixelMathLevel::Scalar, PixelMathLevel::SSE41,
+                                         PixelMathLevel::AVX2));
@@ -0,0 +1,262 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <cstring>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Core/Config/GraphicsSettings.h"
+#include "VideoBackends/Software/NativeVertexFormat.h"
+#include "VideoBackends/Software/Rasterizer.h"
+#include "VideoBackends/Software/SWEfbInterface.h"
+#include "VideoCommon/BPMemory.h"
+#include "VideoCommon/VideoCommon.h"
+#include "VideoCommon/XFMemory.h"
+
+namespace
+{
+// The GX SDK adds this to the scissor rectangle, and games position their viewports with it.
+constexpr u32 SCREEN_OFFSET = 342;
+
+// The EFB stores 3 bytes per pixel, these are read into the low bytes of u32s.
+constexpr u32 CLEAR_COLOR = 0x000000;
+constexpr u32 CLEAR_DEPTH = 0x800000;
+
+constexpr int NUM_BATCHES = 4;
+constexpr int TRIANGLES_PER_BATCH = 300;
+
+using Triangle = std::array<OutputVertexData, 3>;
+
+struct EFB
+{
+  std::vector<u32> colors;
+  std::vector<u32> depths;
+};
+
+// Sets up the pixel pipeline differently for each batch, so that the result depends on the order
+// of the depth tests, alpha tests and blends of every pixel.
+void SetUpBatch(int batch)
+{
+  std::memset(&bpmem, 0, sizeof(bpmem));
+
+  bpmem.scissorTL.x = SCREEN_OFFSET;
+  bpmem.scissorTL.y = SCREEN_OFFSET;
+  bpmem.scissorBR.x = SCREEN_OFFSET + EFB_WIDTH - 1;
+  bpmem.scissorBR.y = SCREEN_OFFSET + EFB_HEIGHT - 1;
+  bpmem.scissorOffset.x = SCREEN_OFFSET >> 1;
+  bpmem.scissorOffset.y = SCREEN_OFFSET >> 1;
+
+  // A single TEV stage which outputs the rasterized color.
+  bpmem.genMode.numcolchans = 1;
+  bpmem.tevorders[0].colorchan_even = RasColorChan::Color0;
+  TevStageCombiner& combiner = bpmem.combiners[0];
+  combiner.colorC.a = TevColorArg::Zero;
+  combiner.colorC.b = TevColorArg::Zero;
+  combiner.colorC.c = TevColorArg::Zero;
+  combiner.colorC.d = TevColorArg::RasColor;
+  combiner.colorC.clamp = true;
+  combiner.alphaC.a = TevAlphaArg::Zero;
+  combiner.alphaC.b = TevAlphaArg::Zero;
+  combiner.alphaC.c = TevAlphaArg::Zero;
+  combiner.alphaC.d = TevAlphaArg::RasAlpha;
+  combiner.alphaC.clamp = true;
+
+  bpmem.zcontrol.pixel_format = PixelFormat::RGBA6_Z24;
+  bpmem.blendmode.color_update = true;
+  bpmem.blendmode.alpha_update = true;
+  bpmem.alpha_test.comp0 = CompareMode::Always;
+  bpmem.alpha_test.comp1 = CompareMode::Always;
+  bpmem.alpha_test.logic = AlphaTestOp::And;
+
+  switch (batch)
+  {
+  case 0:
+    // Late depth test with blending.
+    bpmem.zmode.test_enable = true;
+    bpmem.zmode.func = CompareMode::LEqual;
+    bpmem.zmode.update_enable = true;
+    bpmem.blendmode.blend_enable = true;
+    bpmem.blendmode.src_factor = SrcBlendFactor::SrcAlpha;
+    bpmem.blendmode.dst_factor = DstBlendFactor::InvSrcAlpha;
+    break;
+  case 1:
+    // Early depth test, and an alpha test which discards some of the pixels which pass it.
+    bpmem.zcontrol.early_ztest = true;
+    bpmem.zmode.test_enable = true;
+    bpmem.zmode.func = CompareMode::Greater;
+    bpmem.zmode.update_enable = true;
+    bpmem.alpha_test.comp0 = CompareMode::GEqual;
+    bpmem.alpha_test.ref0 = 0x80;
+    break;
+  case 2:
+    // No depth test, with dithering and blending which depends on the destination alpha.
+    bpmem.blendmode.blend_enable = true;
+    bpmem.blendmode.dither = true;
+    bpmem.blendmode.src_factor = SrcBlendFactor::InvDstAlpha;
+    bpmem.blendmode.dst_factor = DstBlendFactor::DstAlpha;
+    break;
+  default:
+    // Without color channels, the TEV reads the rasterized color as zero.
+    bpmem.genMode.numcolchans = 0;
+    bpmem.zmode.test_enable = true;
+    bpmem.zmode.func = CompareMode::LEqual;
+    bpmem.zmode.update_enable = true;
+    break;
+  }
+}
+
+// Triangles of all sizes, from ones within a single tile to ones which cover most of the EFB.
+// Some of them reach past the edges of the EFB.
+std::vector<Triangle> GenerateTriangles(std::mt19937* rng)
+{
+  std::uniform_real_distribution<float> center_x(-32.0f, EFB_WIDTH + 32.0f);
+  std::uniform_real_distribution<float> center_y(-32.0f, EFB_HEIGHT + 32.0f);
+  std::uniform_real_distribution<float> depth(0.0f, 16777215.0f);
+  std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+  std::vector<Triangle> triangles(NUM_BATCHES * TRIANGLES_PER_BATCH);
+  for (Triangle& triangle : triangles)
+  {
+    const u32 size_class = (*rng)() % 20;
+    const float size = size_class == 0 ? 700.0f : size_class < 5 ? 200.0f : 40.0f;
+    const float x = center_x(*rng);
+    const float y = center_y(*rng);
+
+    for (OutputVertexData& vertex : triangle)
+    {
+      vertex.screenPosition.x = SCREEN_OFFSET + x + unit(*rng) * size;
+      vertex.screenPosition.y = SCREEN_OFFSET + y + unit(*rng) * size;
+      vertex.screenPosition.z = depth(*rng);
+      vertex.projectedPosition.w = 1.0f;
+      for (auto& channel : vertex.color)
+      {
+        for (u8& component : channel)
+          component = static_cast<u8>((*rng)());
+      }
+    }
+
+    // The rasterizer only draws triangles with their vertices in the order of front faces.
+    const Common::Vec3 edge1 = triangle[1].screenPosition - triangle[0].screenPosition;
+    const Common::Vec3 edge2 = triangle[2].screenPosition - triangle[0].screenPosition;
+    if (edge1.x * edge2.y - edge1.y * edge2.x > 0.0f)
+      std::swap(triangle[1], triangle[2]);
+  }
+  return triangles;
+}
+
+EFB ReadEFB()
+{
+  EFB efb;
+  efb.colors.reserve(EFB_WIDTH * EFB_HEIGHT);
+  efb.depths.reserve(EFB_WIDTH * EFB_HEIGHT);
+  for (u16 y = 0; y < EFB_HEIGHT; y++)
+  {
+    for (u16 x = 0; x < EFB_WIDTH; x++)
+    {
+      u32 color = 0;
+      u32 depth = 0;
+      std::memcpy(&color, EfbInterface::GetPixelPointer(x, y, false), 3);
+      std::memcpy(&depth, EfbInterface::GetPixelPointer(x, y, true), 3);
+      efb.colors.push_back(color);
+      efb.depths.push_back(depth);
+    }
+  }
+  return efb;
+}
+
+// Draws the triangles with the given number of worker threads, starting from a cleared EFB.
+EFB Render(int num_worker_threads, const std::vector<Triangle>& triangles)
+{
+  Config::SetCurrent(Config::GFX_SW_RASTERIZER_THREADS, num_worker_threads);
+  Rasterizer::Init();
+
+  for (u16 y = 0; y < EFB_HEIGHT; y++)
+  {
+    for (u16 x = 0; x < EFB_WIDTH; x++)
+    {
+      std::memcpy(EfbInterface::GetPixelPointer(x, y, false), &CLEAR_COLOR, 3);
+      std::memcpy(EfbInterface::GetPixelPointer(x, y, true), &CLEAR_DEPTH, 3);
+    }
+  }
+
+  for (int batch = 0; batch < NUM_BATCHES; batch++)
+  {
+    SetUpBatch(batch);
+    Rasterizer::ScissorChanged();
+    Rasterizer::SetTevState();
+
+    for (int i = 0; i < TRIANGLES_PER_BATCH; i++)
+    {
+      const Triangle& triangle = triangles[batch * TRIANGLES_PER_BATCH + i];
+      Rasterizer::DrawTriangleFrontFace(&triangle[0], &triangle[1], &triangle[2]);
+    }
+    Rasterizer::Flush();
+  }
+
+  Rasterizer::Shutdown();
+  return ReadEFB();
+}
+
+void ExpectSamePixels(const std::vector<u32>& expected, const std::vector<u32>& actual,
+                      const char* name)
+{
+  ASSERT_EQ(expected.size(), actual.size());
+
+  size_t num_different = 0;
+  size_t first_different = 0;
+  for (size_t i = 0; i < expected.size(); i++)
+  {
+    if (expected[i] != actual[i] && num_different++ == 0)
+      first_different = i;
+  }
+
+  EXPECT_EQ(num_different, 0u) << fmt::format(
+      "{} of pixel {}, {} is {:06x} instead of {:06x}", name, first_different % EFB_WIDTH,
+      first_different / EFB_WIDTH, actual[first_different], expected[first_different]);
+}
+}  // namespace
+
+class RasterizerTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    Config::Init();
+
+    xfmem.viewport.wd = EFB_WIDTH / 2.0f;
+    xfmem.viewport.ht = -(EFB_HEIGHT / 2.0f);
+    xfmem.viewport.xOrig = SCREEN_OFFSET + EFB_WIDTH / 2.0f;
+    xfmem.viewport.yOrig = SCREEN_OFFSET + EFB_HEIGHT / 2.0f;
+  }
+
+  void TearDown() override { Config::Shutdown(); }
+};
+
+TEST_F(RasterizerTest, WorkerThreadsMatchVideoThread)
+{
+  std::mt19937 rng(0x5a7);
+  const std::vector<Triangle> triangles = GenerateTriangles(&rng);
+
+  const EFB expected = Render(0, triangles);
+
+  // Make sure that the triangles cover enough of the EFB for the comparison to mean something.
+  size_t num_drawn = 0;
+  for (const u32 depth : expected.depths)
+    num_drawn += depth != CLEAR_DEPTH;
+  ASSERT_GT(num_drawn, EFB_WIDTH * EFB_HEIGHT / 2);
+
+  for (const int num_worker_threads : {1, 3, 7})
+  {
+    SCOPED_TRACE(fmt::format("{} worker threads", num_worker_threads));
+    const EFB actual = Render(num_worker_threads, triangles);
+    ExpectSamePixels(expected.colors, actual.colors, "Color");
+    ExpectSamePixels(expected.depths, actual.depths, "Depth");
+  }
+}
@@ -0,0 +1,200 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <chrono>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "Common/Hash.h"
+#include "VideoCommon/TextureDecoder.h"
+
+namespace
+{
+constexpr std::array<TextureFormat, 11> TEXTURE_FORMATS{
+    TextureFormat::I4,     TextureFormat::I8, TextureFormat::IA4, TextureFormat::IA8,
+    TextureFormat::RGB565, TextureFormat::RGB5A3, TextureFormat::RGBA8, TextureFormat::C4,
+    TextureFormat::C8,     TextureFormat::C14X2, TextureFormat::CMPR,
+};
+
+constexpr std::array<TLUTFormat, 3> TLUT_FORMATS{TLUTFormat::IA8, TLUTFormat::RGB565,
+                                                 TLUTFormat::RGB5A3};
+
+// Palettes are read from TMEM, like they are when emulating. The C14X2 decoders may read slightly
+// past the end of the palette, which is fine within TMEM.
+constexpr u32 TLUT_OFFSET = TMEM_SIZE / 2;
+constexpr u32 TLUT_SIZE = 0x8000;
+
+enum class DecoderLevel
+{
+  Generic,
+  SSSE3,
+  AVX2,
+};
+
+// Forces the decoders of the given level, and restores the detected CPU features afterwards.
+class ScopedDecoderLevel
+{
+public:
+  explicit ScopedDecoderLevel(DecoderLevel level)
+      : m_ssse3(cpu_info.bSSSE3), m_avx2(cpu_info.bAVX2)
+  {
+    cpu_info.bSSSE3 = m_ssse3 && level >= DecoderLevel::SSSE3;
+    cpu_info.bAVX2 = m_avx2 && level >= DecoderLevel::AVX2;
+  }
+  ~ScopedDecoderLevel()
+  {
+    cpu_info.bSSSE3 = m_ssse3;
+    cpu_info.bAVX2 = m_avx2;
+  }
+
+  ScopedDecoderLevel(const ScopedDecoderLevel&) = delete;
+  ScopedDecoderLevel& operator=(const ScopedDecoderLevel&) = delete;
+
+private:
+  bool m_ssse3;
+  bool m_avx2;
+};
+
+bool IsLevelSupported(DecoderLevel level)
+{
+  switch (level)
+  {
+  case DecoderLevel::SSSE3:
+    return cpu_info.bSSSE3;
+  case DecoderLevel::AVX2:
+    return cpu_info.bAVX2;
+  default:
+    return true;
+  }
+}
+
+std::vector<u8> RandomBytes(std::mt19937* rng, size_t size)
+{
+  std::vector<u8> bytes(size);
+  for (u8& byte : bytes)
+    byte = static_cast<u8>((*rng)());
+  return bytes;
+}
+
+u8* FillTlut(std::mt19937* rng)
+{
+  u8* const tlut = s_tex_mem.data() + TLUT_OFFSET;
+  for (u32 i = 0; i < TLUT_SIZE; i++)
+    tlut[i] = static_cast<u8>((*rng)());
+  return tlut;
+}
+}  // namespace
+
+class TextureDecoderTest : public testing::TestWithParam<DecoderLevel>
+{
+};
+
+TEST_P(TextureDecoderTest, MatchesTexelDecoder)
+{
+  if (!IsLevelSupported(GetParam()))
+    GTEST_SKIP() << "Not supported by this CPU";
+
+  std::mt19937 rng(0x7e57);
+  const u8* const tlut = FillTlut(&rng);
+  const ScopedDecoderLevel level(GetParam());
+
+  for (const TextureFormat format : TEXTURE_FORMATS)
+  {
+    for (const TLUTFormat tlut_format : TLUT_FORMATS)
+    {
+      for (const u32 width : {8u, 16u, 24u, 64u})
+      {
+        for (const u32 height : {8u, 16u, 32u})
+        {
+          const std::vector<u8> src =
+              RandomBytes(&rng, TexDecoder_GetTextureSizeInBytes(width, height, format));
+
+          std::vector<u32> expected(width * height);
+          for (u32 t = 0; t < height; t++)
+          {
+            for (u32 s = 0; s < width; s++)
+            {
+              TexDecoder_DecodeTexel(reinterpret_cast<u8*>(&expected[t * width + s]), src, s, t,
+                                     width - 1, format, std::span(tlut, TLUT_SIZE), tlut_format);
+            }
+          }
+
+          std::vector<u32> decoded(width * height, 0xcdcdcdcd);
+          _TexDecoder_DecodeImpl(decoded.data(), src.data(), width, height, format, tlut,
+                                 tlut_format);
+
+          EXPECT_EQ(decoded, expected) << fmt::format("{} {}x{}, palette format {}", format,
+                                                      width, height, tlut_format);
+        }
+      }
+    }
+  }
+}
+
+// Reports how quickly each format is decoded, to compare the decoders of each level.
+TEST_P(TextureDecoderTest, Throughput)
+{
+  if (!IsLevelSupported(GetParam()))
+    GTEST_SKIP() << "Not supported by this CPU";
+
+  constexpr u32 WIDTH = 512;
+  constexpr u32 HEIGHT = 512;
+  constexpr int ITERATIONS = 16;
+
+  std::mt19937 rng(0x7e57);
+  const u8* const tlut = FillTlut(&rng);
+  const ScopedDecoderLevel level(GetParam());
+
+  std::vector<u32> decoded(WIDTH * HEIGHT);
+  for (const TextureFormat format : TEXTURE_FORMATS)
+  {
+    const std::vector<u8> src =
+        RandomBytes(&rng, TexDecoder_GetTextureSizeInBytes(WIDTH, HEIGHT, format));
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+      _TexDecoder_DecodeImpl(decoded.data(), src.data(), WIDTH, HEIGHT, format, tlut,
+                             TLUTFormat::RGB5A3);
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    const double texels_per_second = double(WIDTH) * HEIGHT * ITERATIONS / elapsed.count();
+    fmt::println("{}: {:.1f} Mtexels/s", format, texels_per_second / 1e6);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(Levels, TextureDecoderTest,
+                         testing::Values(DecoderLevel::Generic, DecoderLevel::SSSE3,
+                                         DecoderLevel::AVX2));
+
+TEST(TextureHash, Throughput)
+{
+  constexpr u32 SIZE = 1024 * 1024;
+  constexpr int ITERATIONS = 16;
+
+  std::mt19937 rng(0x7e57);
+  const std::vector<u8> data = RandomBytes(&rng, SIZE);
+
+  // 0 hashes the whole texture, like the texture cache does by default.
+  for (const u32 samples : {0u, 1024u})
+  {
+    u64 hash = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; i++)
+      hash += Common::GetHash64(data.data(), SIZE, samples);
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_EQ(Common::GetHash64(data.data(), SIZE, samples),
+              Common::GetHash64(data.data(), SIZE, samples));
+    fmt::println("{} samples: {:.1f} MB/s (hash {:016x})", samples,
+                 double(SIZE) * ITERATIONS / elapsed.count() / 1e6, hash);
+  }
+}
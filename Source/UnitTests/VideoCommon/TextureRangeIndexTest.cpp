@@ -0,0 +1,239 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureRangeIndex.h"
+
+namespace
+{
+struct Range
+{
+  u32 addr;
+  u32 size;
+};
+
+// The lookback TextureCacheBase used before it had an index: 1024 x 1024 texels times 8 nibbles
+// per texel, the size of the largest texture.
+constexpr u32 MAX_TEXTURE_SIZE = 1024 * 1024 * 4;
+
+u32 RandomSize(std::mt19937* rng)
+{
+  switch ((*rng)() % 8)
+  {
+  case 0:
+    return 0;
+  case 1:
+    // Large enough to cover many pages, like XFB copies.
+    return 0x100000 + (*rng)() % 0x300000;
+  default:
+    return 32 << ((*rng)() % 12);
+  }
+}
+
+u32 RandomAddress(std::mt19937* rng)
+{
+  // Close together, so that there are plenty of overlaps, with a few at the end of the address
+  // space to make sure nothing overflows.
+  if ((*rng)() % 16 == 0)
+    return 0xFFFFFFFF - (*rng)() % 0x400000;
+  return 0x10000000 + ((*rng)() % 0x400000 & ~31u);
+}
+
+u32 FindFirstAddressBruteForce(const std::vector<Range>& ranges, u32 addr)
+{
+  u32 first_addr = addr;
+  for (const Range& range : ranges)
+  {
+    if (range.addr < first_addr && addr - range.addr < range.size)
+      first_addr = range.addr;
+  }
+  return first_addr;
+}
+
+// A texture cache which only keeps track of the memory ranges of its textures, like
+// TextureCacheBase::m_textures_by_address.
+class RangeCache
+{
+public:
+  explicit RangeCache(bool use_index) : m_use_index(use_index) {}
+
+  void Load(u32 addr, u32 size)
+  {
+    auto [begin, end] = m_textures.equal_range(addr);
+    if (std::any_of(begin, end, [size](const auto& texture) { return texture.second == size; }))
+      return;
+
+    m_textures.emplace(addr, size);
+    m_ranges.Add(addr, size);
+  }
+
+  // Invalidates the textures which overlap an EFB copy and adds the copy, like
+  // TextureCacheBase::CopyRenderTargetToTexture does. Returns the textures which were invalidated,
+  // in the order they were found.
+  std::vector<Range> Copy(u32 addr, u32 size)
+  {
+    std::vector<Range> invalidated;
+    const u32 lower_addr = m_use_index            ? m_ranges.FindFirstAddress(addr) :
+                           addr > MAX_TEXTURE_SIZE ? addr - MAX_TEXTURE_SIZE :
+                                                     0;
+    auto iter = m_textures.lower_bound(lower_addr);
+    const auto end = m_textures.upper_bound(addr + size);
+    while (iter != end)
+    {
+      m_num_visited++;
+      const auto [texture_addr, texture_size] = *iter;
+      if (texture_addr + texture_size > addr && texture_addr < addr + size)
+      {
+        invalidated.push_back({texture_addr, texture_size});
+        m_ranges.Remove(texture_addr, texture_size);
+        iter = m_textures.erase(iter);
+        continue;
+      }
+      ++iter;
+    }
+
+    m_textures.emplace(addr, size);
+    m_ranges.Add(addr, size);
+    return invalidated;
+  }
+
+  u64 GetNumVisited() const { return m_num_visited; }
+
+private:
+  bool m_use_index;
+  std::multimap<u32, u32> m_textures;
+  TextureRangeIndex m_ranges;
+  u64 m_num_visited = 0;
+};
+
+struct Operation
+{
+  bool is_copy;
+  Range range;
+};
+
+// A few hundred frames of a game which loads textures from a large set, renders to a handful of
+// EFB copies at fixed addresses and keeps a large XFB copy around.
+std::vector<Operation> GenerateTrace(std::mt19937* rng)
+{
+  constexpr u32 MEM1_SIZE = 0x1800000;
+  std::vector<Range> textures(4000);
+  for (Range& texture : textures)
+  {
+    texture.size = 512 << ((*rng)() % 10);
+    texture.addr = (*rng)() % (MEM1_SIZE - texture.size) & ~31u;
+  }
+
+  std::vector<Range> copies(8);
+  for (Range& copy : copies)
+  {
+    copy.size = 0x8000 + ((*rng)() % 0x90000 & ~31u);
+    copy.addr = (*rng)() % (MEM1_SIZE - copy.size) & ~31u;
+  }
+  const Range xfb_copy{MEM1_SIZE - 0x200000, 640 * 574 * 4};
+
+  std::vector<Operation> trace;
+  for (int frame = 0; frame < 300; frame++)
+  {
+    for (int i = 0; i < 400; i++)
+      trace.push_back({false, textures[(*rng)() % textures.size()]});
+    for (const Range& copy : copies)
+      trace.push_back({true, copy});
+    trace.push_back({true, xfb_copy});
+  }
+  return trace;
+}
+
+std::pair<std::vector<Range>, u64> Replay(const std::vector<Operation>& trace, bool use_index)
+{
+  RangeCache cache(use_index);
+  std::vector<Range> invalidated;
+
+  const auto start = std::chrono::steady_clock::now();
+  for (const Operation& operation : trace)
+  {
+    if (!operation.is_copy)
+    {
+      cache.Load(operation.range.addr, operation.range.size);
+      continue;
+    }
+
+    const std::vector<Range> copy_invalidated =
+        cache.Copy(operation.range.addr, operation.range.size);
+    invalidated.insert(invalidated.end(), copy_invalidated.begin(), copy_invalidated.end());
+  }
+  const auto duration = std::chrono::steady_clock::now() - start;
+
+  fmt::print("{}: {} textures visited, {} us\n", use_index ? "Index" : "Fixed lookback",
+             cache.GetNumVisited(),
+             std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+  return {std::move(invalidated), cache.GetNumVisited()};
+}
+}  // namespace
+
+TEST(TextureRangeIndex, FindFirstAddressMatchesBruteForce)
+{
+  std::mt19937 rng(0x7a1);
+  TextureRangeIndex index;
+  std::vector<Range> ranges;
+
+  for (int iteration = 0; iteration < 20000; iteration++)
+  {
+    if (ranges.empty() || rng() % 3 != 0)
+    {
+      // Some ranges are added more than once.
+      const Range range = !ranges.empty() && rng() % 8 == 0 ?
+                              ranges[rng() % ranges.size()] :
+                              Range{RandomAddress(&rng), RandomSize(&rng)};
+      index.Add(range.addr, range.size);
+      ranges.push_back(range);
+    }
+    else
+    {
+      const size_t i = rng() % ranges.size();
+      index.Remove(ranges[i].addr, ranges[i].size);
+      ranges.erase(ranges.begin() + i);
+    }
+
+    // Query both inside of and around the ranges.
+    for (int query = 0; query < 4; query++)
+    {
+      const Range& range = ranges.empty() ? Range{} : ranges[rng() % ranges.size()];
+      const u32 addr = query == 0 ? RandomAddress(&rng) : range.addr + rng() % (range.size + 64);
+      ASSERT_EQ(index.FindFirstAddress(addr), FindFirstAddressBruteForce(ranges, addr))
+          << fmt::format("address {:08x}, {} ranges", addr, ranges.size());
+    }
+  }
+
+  index.Clear();
+  EXPECT_EQ(index.FindFirstAddress(0x10100000), 0x10100000u);
+}
+
+TEST(TextureRangeIndex, ReplaySpeed)
+{
+  std::mt19937 rng(0x7a2);
+  const std::vector<Operation> trace = GenerateTrace(&rng);
+
+  const auto [fixed_invalidated, fixed_visited] = Replay(trace, false);
+  const auto [index_invalidated, index_visited] = Replay(trace, true);
+
+  // The index must find the same textures in the same order, without looking at as many.
+  ASSERT_EQ(index_invalidated.size(), fixed_invalidated.size());
+  for (size_t i = 0; i < index_invalidated.size(); i++)
+  {
+    ASSERT_EQ(index_invalidated[i].addr, fixed_invalidated[i].addr) << i;
+    ASSERT_EQ(index_invalidated[i].size, fixed_invalidated[i].size) << i;
+  }
+  EXPECT_GT(index_invalidated.size(), 0u);
+  EXPECT_LT(index_visited * 4, fixed_visited);
+}
@@ -1,20 +1,29 @@
 // Copyright 2014 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <bit>
 #include <limits>
 #include <memory>
 #include <tuple>
 #include <unordered_set>
+#include <vector>
 
+#include <fmt/format.h>
 #include <gtest/gtest.h>  // NOLINT
 
 #include "Common/MathUtil.h"
+#include "Core/System.h"
+#include "VideoCommon/BPMemory.h"
 #include "VideoCommon/CPMemory.h"
+#include "VideoCommon/CPUCull.h"
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/OpcodeDecoding.h"
 #include "VideoCommon/VertexLoaderBase.h"
 #include "VideoCommon/VertexLoaderManager.h"
+#include "VideoCommon/VertexLoaderPool.h"
+#include "VideoCommon/XFMemory.h"
+#include "VideoCommon/XFStateManager.h"
 
 TEST(VertexLoaderUID, UniqueEnough)
 {
@@ -36,6 +45,23 @@ TEST(VertexLoaderUID, UniqueEnough)
   uids.insert(VertexLoaderUID(vtx_desc, vat));
 }
 
+TEST(VertexLoaderUID, RoundTrip)
+{
+  TVtxDesc vtx_desc;
+  vtx_desc.low.Hex = 0x76543210;
+  vtx_desc.high.Hex = 0xFEDCBA98;
+  VAT vat;
+  vat.g0.Hex = 0x01234567;
+  vat.g1.Hex = 0x89ABCDEF;
+  vat.g2.Hex = 0x13579BDF;
+
+  // The UID cache file rebuilds UIDs from these.
+  const VertexLoaderUID uid(vtx_desc, vat);
+  const VertexLoaderUID rebuilt(uid.GetVertexDesc(), uid.GetVAT());
+  EXPECT_EQ(uid, rebuilt);
+  EXPECT_EQ(uid.GetHash(), rebuilt.GetHash());
+}
+
 static u8 input_memory[16 * 1024 * 1024];
 static u8 output_memory[16 * 1024 * 1024];
 
@@ -367,6 +393,197 @@ TEST_F(VertexLoaderTest, LargeFloatVertexSpeed)
     RunVertices(100000);
 }
 
+TEST_F(VertexLoaderTest, PoolMatchesSingleThread)
+{
+  m_vtx_desc.low.Position = VertexComponentFormat::Direct;
+  m_vtx_desc.low.Color0 = VertexComponentFormat::Direct;
+  m_vtx_attr.g0.PosElements = CoordComponentCount::XYZ;
+  m_vtx_attr.g0.PosFormat = ComponentFormat::Float;
+  m_vtx_attr.g0.Color0Elements = ColorComponentCount::RGBA;
+  m_vtx_attr.g0.Color0Comp = ColorFormat::RGBA8888;
+  CreateAndCheckSizes(3 * sizeof(float) + sizeof(u32), 3 * sizeof(float) + sizeof(u32));
+
+  VertexLoaderPool pool;
+  pool.SetNumWorkers(3);
+  constexpr int count = 20000;
+  if (!pool.CanSplit(m_loader.get(), count))
+    GTEST_SKIP() << "The vertex loader can't be run on several threads";
+
+  for (int i = 0; i < count; i++)
+  {
+    Input(i * 1.0f);
+    Input(i * -2.0f);
+    Input(i * 0.5f);
+    Input<u32>(0x11223344u * i);
+  }
+
+  RunVertices(count);
+  const std::vector<u8> expected(output_memory, output_memory + count * 16);
+  const auto expected_cache = VertexLoaderManager::position_cache;
+  VertexLoaderManager::position_cache = {};
+  const int loaded_before = m_loader->m_numLoadedVertices;
+
+  std::vector<u8> loaded(count * 16);
+  EXPECT_EQ(pool.RunVertices(m_loader.get(), OpcodeDecoder::Primitive::GX_DRAW_TRIANGLES,
+                             input_memory, loaded.data(), count, nullptr, nullptr),
+            count);
+  EXPECT_EQ(loaded, expected);
+  EXPECT_EQ(VertexLoaderManager::position_cache, expected_cache);
+  EXPECT_EQ(m_loader->m_numLoadedVertices, loaded_before + count);
+}
+
+// Loads vertices with indexed positions, so that they can be skipped, and culls them with a
+// projection which keeps the positions inside of [-1, 1] on the x and y axes.
+class VertexLoaderPoolCullTest : public VertexLoaderTest
+{
+protected:
+  static constexpr int COUNT = 20000;
+  static constexpr u32 STRIDE = 3 * sizeof(float);
+
+  void SetUp() override
+  {
+    VertexLoaderTest::SetUp();
+
+    m_vtx_desc.low.Position = VertexComponentFormat::Index16;
+    m_vtx_attr.g0.PosElements = CoordComponentCount::XYZ;
+    m_vtx_attr.g0.PosFormat = ComponentFormat::Float;
+    CreateAndCheckSizes(sizeof(u16), STRIDE);
+    m_pool.SetNumWorkers(3);
+
+    for (int i = 0; i < COUNT; i++)
+      Input<u16>(i);
+    m_positions = m_src.GetPointer();
+    VertexLoaderManager::cached_arraybases[CPArray::Position] = m_positions;
+    g_main_cp_state.array_strides[CPArray::Position] = STRIDE;
+    for (int i = 0; i < COUNT; i++)
+      ResetPosition(i);
+
+    xfmem.projection.type = ProjectionType::Orthographic;
+    xfmem.projection.rawProjection = {1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f};
+    std::ranges::fill(xfmem.posMatrices, 0.0f);
+    xfmem.posMatrices[0] = xfmem.posMatrices[5] = xfmem.posMatrices[10] = 1.0f;
+    xfmem.viewport.ht = -1.0f;
+    g_main_cp_state.matrix_index_a.PosNormalMtxIdx = 0;
+    bpmem.genMode.cull_mode = CullMode::None;
+    Core::System::GetInstance().GetXFStateManager().SetProjectionChanged();
+    m_cpu_cull.Init();
+  }
+
+  void SetPosition(int i, float x, float y)
+  {
+    DataReader dst(m_positions + i * STRIDE, m_positions + (i + 1) * STRIDE);
+    dst.Write<float, true>(x);
+    dst.Write<float, true>(y);
+    dst.Write<float, true>(0.0f);
+  }
+
+  // Moves the vertex off the screen to the top right. None of the triangles of three consecutive
+  // vertices there are degenerate, so they are only culled for being off the screen.
+  void ResetPosition(int i)
+  {
+    const float offset = static_cast<float>(i % 3);
+    SetPosition(i, 10.0f + offset, 10.0f + offset * offset);
+  }
+
+  // Moves the first vertex to the left and the last one to the bottom, so that the triangle
+  // between them reaches across the screen. The other triangles with one of them stay culled.
+  void MakeVisible(int first, int last)
+  {
+    SetPosition(first, -10.0f, 10.0f);
+    SetPosition(last, 10.0f, -10.0f);
+  }
+
+  // Loads and culls the vertices with the pool, and checks that the results are the same as when
+  // loading and culling them on one thread.
+  void CheckPool(OpcodeDecoder::Primitive primitive, int expected_count, bool expected_culled)
+  {
+    const CPUCull::Culler culler = m_cpu_cull.GetCuller(m_loader.get(), primitive);
+
+    RunVertices(COUNT, expected_count);
+    const std::vector<u8> expected(output_memory, output_memory + expected_count * STRIDE);
+    CPUCull::TransformBuffer transform_buffer;
+    ASSERT_EQ(culler.AreAllVerticesCulled(output_memory, expected_count, &transform_buffer),
+              expected_culled);
+    const int loaded_before = m_loader->m_numLoadedVertices;
+
+    std::vector<u8> loaded(COUNT * STRIDE);
+    bool all_culled = !expected_culled;
+    EXPECT_EQ(m_pool.RunVertices(m_loader.get(), primitive, input_memory, loaded.data(), COUNT,
+                                 &culler, &all_culled),
+              expected_count);
+    loaded.resize(expected_count * STRIDE);
+    EXPECT_EQ(loaded, expected);
+    EXPECT_EQ(all_culled, expected_culled);
+    EXPECT_EQ(m_loader->m_numLoadedVertices, loaded_before + COUNT);
+  }
+
+  VertexLoaderPool m_pool;
+  CPUCull m_cpu_cull;
+  u8* m_positions = nullptr;
+};
+
+TEST_F(VertexLoaderPoolCullTest, Triangles)
+{
+  if (!m_pool.CanSplit(m_loader.get(), COUNT))
+    GTEST_SKIP() << "The vertex loader can't be run on several threads";
+
+  CheckPool(OpcodeDecoder::Primitive::GX_DRAW_TRIANGLES, COUNT, true);
+
+  for (int first = 0; first + 2 < COUNT && !HasFailure(); first += 3 * 101)
+  {
+    SCOPED_TRACE(fmt::format("Visible triangle at {}", first));
+    MakeVisible(first, first + 2);
+    CheckPool(OpcodeDecoder::Primitive::GX_DRAW_TRIANGLES, COUNT, false);
+    ResetPosition(first);
+    ResetPosition(first + 2);
+  }
+}
+
+TEST_F(VertexLoaderPoolCullTest, TriangleStripAcrossChunks)
+{
+  if (!m_pool.CanSplit(m_loader.get(), COUNT))
+    GTEST_SKIP() << "The vertex loader can't be run on several threads";
+
+  CheckPool(OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_STRIP, COUNT, true);
+
+  // Chunks start at multiples of 12 vertices. Make each of the two triangles which would reach
+  // across a chunk starting there the only visible one.
+  for (int start = 12; start + 1 < COUNT && !HasFailure(); start += 12)
+  {
+    for (const int first : {start - 2, start - 1})
+    {
+      SCOPED_TRACE(fmt::format("Visible triangle at {}", first));
+      MakeVisible(first, first + 2);
+      CheckPool(OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_STRIP, COUNT, false);
+      ResetPosition(first);
+      ResetPosition(first + 2);
+    }
+  }
+}
+
+TEST_F(VertexLoaderPoolCullTest, SkippedVertices)
+{
+  if (!m_pool.CanSplit(m_loader.get(), COUNT))
+    GTEST_SKIP() << "The vertex loader can't be run on several threads";
+
+  // Vertices with an index of 0xFFFF are skipped, which shifts the ones after them.
+  DataReader(input_memory + 7000 * sizeof(u16), input_memory + COUNT * sizeof(u16))
+      .Write<u16, true>(0xFFFF);
+
+  for (const auto primitive : {OpcodeDecoder::Primitive::GX_DRAW_TRIANGLES,
+                               OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_STRIP})
+  {
+    SCOPED_TRACE(fmt::format("Primitive {}", primitive));
+    CheckPool(primitive, COUNT - 1, true);
+
+    // With the vertex before them skipped, these start and end a triangle of both primitives.
+    MakeVisible(12001, 12003);
+    CheckPool(primitive, COUNT - 1, false);
+    ResetPosition(12001);
+    ResetPosition(12003);
+  }
+}
+
 TEST_F(VertexLoaderTest, DirectAllComponents)
 {
   m_vtx_desc.low.PosMatIdx = true;